@@ -0,0 +1,84 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+
+#include "ofMain.h"
+#include "ofApp.h"
+#include "ofAppGLFWWindow.h"
+
+//========================================================================
+// micro-benchmark suite for the core objects and the link transport, after a set of
+// regression checks ( check_* names, a failed check sets the exit code )
+//
+// usage: example_benchmark [options]
+//   --iterations N     timed iterations for every benchmark ( default 1000 )
+//   --out FILE         results JSON ( default benchmark_results.json )
+//   --filter NAME      run only the checks and benchmarks whose name contains NAME
+//
+// build with make DSP_NO_SIMD=1 to run check_dsp on the scalar DSP kernels too
+int main(int argc, char *argv[]){
+
+    shared_ptr<ofApp> benchmarkApp(new ofApp);
+    benchmarkApp->iterations    = 1000;
+    benchmarkApp->resultsFile   = ofFilePath::getAbsolutePath("benchmark_results.json",false);
+    benchmarkApp->filter        = "";
+
+    for(int i=1;i<argc-1;i+=2){
+        string option = argv[i];
+        string value = argv[i+1];
+        if(option == "--iterations"){
+            benchmarkApp->iterations = std::max(1,ofToInt(value));
+        }else if(option == "--out"){
+            benchmarkApp->resultsFile = ofFilePath::getAbsolutePath(value,false);
+        }else if(option == "--filter"){
+            benchmarkApp->filter = value;
+        }else{
+            ofLog(OF_LOG_WARNING,"Unknown option %s",option.c_str());
+        }
+    }
+
+    // hidden window, the texture objects need a GL context
+    ofGLFWWindowSettings settings;
+    settings.setGLVersion(OFXVP_GL_VERSION_MAJOR,OFXVP_GL_VERSION_MINOR);
+    settings.stencilBits = 0;
+    settings.visible = false;
+    settings.setSize(64,64);
+
+    shared_ptr<ofAppBaseWindow> benchmarkWindow = ofCreateWindow(settings);
+
+    ofRunApp(benchmarkWindow,benchmarkApp);
+
+    // exit code from ofExit ( EXIT_FAILURE if a check fails, the results can't be written or a CPU budget is exceeded )
+    return ofRunMainLoop();
+
+}
@@ -0,0 +1,662 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#include "ofApp.h"
+
+//--------------------------------------------------------------
+void ofApp::setup(){
+    ofSetFrameRate(0);
+
+    exitCode = EXIT_SUCCESS;
+    patchLoaded = false;
+    samples.reserve(static_cast<size_t>(iterations));
+
+    visualProgramming = new ofxVisualProgramming();
+    visualProgramming->setupHeadless();
+
+    // benchmark objects are created in a temp copy of the empty patch
+    visualProgramming->newTempPatchFromFile(ofToDataPath("empty_patch.xml",true));
+}
+
+//--------------------------------------------------------------
+void ofApp::update(){
+
+    if(!patchLoaded){
+        visualProgramming->update();
+        if(!visualProgramming->clearingObjectsMap && !visualProgramming->bLoadingNewPatch){
+            patchLoaded = true;
+
+            runChecks();
+            runBenchmarks();
+
+            if(!writeResults()){
+                exitCode = EXIT_FAILURE;
+            }
+            ofExit(exitCode);
+        }
+    }
+
+}
+
+//--------------------------------------------------------------
+void ofApp::runChecks(){
+    ofLog(OF_LOG_NOTICE,"Running checks");
+
+    // regression checks, a failed check sets the exit code
+    checkLazyEvaluation();
+    checkDspKernels();
+    checkAutoCorrelation(1024);
+    checkAutoCorrelation(2048);
+    checkPitchDetectors(1024);
+    checkPitchDetectors(2048);
+}
+
+//--------------------------------------------------------------
+void ofApp::checkLazyEvaluation(){
+    if(!isEnabled("check_lazy")) return;
+
+    map<int,shared_ptr<PatchObject>> checkObjects;
+
+    // inverter ( always updated ) -> clamp ( pure object, updated only when its inlets change )
+    shared_ptr<PatchObject> source = newBenchObject("inverter",checkObjects);
+    shared_ptr<PatchObject> dest = newBenchObject("clamp",checkObjects);
+    if(source == nullptr || dest == nullptr) return;
+
+    visualProgramming->connect(source->getId(),0,dest->getId(),0,VP_LINK_NUMERIC);
+    source->inletsConnected[0] = true;
+
+    // every new upstream number must reach the lazy object, two frames for every value
+    pdsp::Engine &engine = *visualProgramming->engine;
+    bool passed = true;
+    for(int i=0;i<8;i++){
+        float input = static_cast<float>(i%2);
+        *ofxVP_CAST_PIN_PTR<float>(source->_inletParams[0]) = input;
+        for(int frame=0;frame<2;frame++){
+            source->update(checkObjects,engine,true);
+            dest->update(checkObjects,engine,true);
+        }
+        float expected = input < 1.0f ? 1.0f : 0.0f;
+        if(*ofxVP_CAST_PIN_PTR<float>(dest->_outletParams[0]) != expected){
+            passed = false;
+        }
+    }
+
+    checkResult("check_lazy",passed);
+}
+
+//--------------------------------------------------------------
+// scalar references of the ofxVPDsp reductions, same association ( 4 lanes partial sums, lanes summed in pairs, tail in order )
+static float referenceDot(const float *a, const float *b, size_t n){
+    float lanes[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    size_t i = 0;
+    for(;i+4<=n;i+=4){
+        for(int l=0;l<4;l++) lanes[l] += a[i+l]*b[i+l];
+    }
+    float sum = (lanes[0]+lanes[1]) + (lanes[2]+lanes[3]);
+    for(;i<n;i++) sum += a[i]*b[i];
+    return sum;
+}
+
+//--------------------------------------------------------------
+static float referencePeak(const float *in, size_t n){
+    float lanes[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    size_t i = 0;
+    for(;i+4<=n;i+=4){
+        for(int l=0;l<4;l++) lanes[l] = std::fabs(in[i+l]) > lanes[l] ? std::fabs(in[i+l]) : lanes[l];
+    }
+    float m = lanes[0];
+    for(int l=1;l<4;l++) m = lanes[l] > m ? lanes[l] : m;
+    for(;i<n;i++) m = std::fabs(in[i]) > m ? std::fabs(in[i]) : m;
+    return m;
+}
+
+//--------------------------------------------------------------
+static bool sameBits(const float *a, const float *b, size_t n){
+    return memcmp(a,b,n*sizeof(float)) == 0;
+}
+
+//--------------------------------------------------------------
+void ofApp::checkDspKernels(){
+    if(!isEnabled("check_dsp")) return;
+
+#if defined(OFXVP_DSP_SSE)
+    ofLog(OF_LOG_NOTICE,"DSP kernels: SSE");
+#elif defined(OFXVP_DSP_NEON)
+    ofLog(OF_LOG_NOTICE,"DSP kernels: NEON");
+#else
+    ofLog(OF_LOG_NOTICE,"DSP kernels: scalar");
+#endif
+
+    // the kernels must give the same bits as the scalar references, on every path ( sizes with and without a tail )
+    ofSeedRandom(1234);
+    bool passed = true;
+    size_t sizes[] = { 1, 3, 4, 7, 64, 257, 1023, 2048 };
+    for(size_t n : sizes){
+        vector<float> a(n), b(n), state(n), out(n), expected(n);
+        for(size_t i=0;i<n;i++){
+            a[i]        = ofRandom(-2.0f,2.0f);
+            b[i]        = ofRandom(-2.0f,2.0f);
+            state[i]    = ofRandom(-1.0f,1.0f);
+        }
+
+        float dot = ofxVPDsp::dot(a.data(),b.data(),n);
+        float expectedDot = referenceDot(a.data(),b.data(),n);
+        float rms = ofxVPDsp::rms(a.data(),n);
+        float expectedRms = std::sqrt(referenceDot(a.data(),a.data(),n)/static_cast<float>(n));
+        float peak = ofxVPDsp::peak(a.data(),n);
+        float expectedPeak = referencePeak(a.data(),n);
+        bool ok = sameBits(&dot,&expectedDot,1) && sameBits(&rms,&expectedRms,1) && sameBits(&peak,&expectedPeak,1);
+
+        ofxVPDsp::clip(a.data(),out.data(),n);
+        for(size_t i=0;i<n;i++) expected[i] = a[i] < -1.0f ? -1.0f : (a[i] > 1.0f ? 1.0f : a[i]);
+        ok = ok && sameBits(out.data(),expected.data(),n);
+
+        ofxVPDsp::scale(a.data(),out.data(),0.3f,n);
+        for(size_t i=0;i<n;i++) expected[i] = a[i]*0.3f;
+        ok = ok && sameBits(out.data(),expected.data(),n);
+
+        ofxVPDsp::power(a.data(),b.data(),out.data(),n);
+        for(size_t i=0;i<n;i++) expected[i] = a[i]*a[i] + b[i]*b[i];
+        ok = ok && sameBits(out.data(),expected.data(),n);
+
+        expected = state;
+        ofxVPDsp::smooth(state.data(),a.data(),0.9f,n);
+        for(size_t i=0;i<n;i++) expected[i] = expected[i]*0.9f + a[i]*(1.0f-0.9f);
+        ok = ok && sameBits(state.data(),expected.data(),n);
+
+        if(!ok){
+            ofLog(OF_LOG_ERROR,"DSP kernels [%i] differ from the scalar reference",static_cast<int>(n));
+            passed = false;
+        }
+    }
+
+    checkResult("check_dsp",passed);
+}
+
+//--------------------------------------------------------------
+void ofApp::checkAutoCorrelation(int windowSize){
+    if(!isEnabled("check_autocorrelation")) return;
+
+    int sampleRate = visualProgramming->audioSampleRate > 0 ? visualProgramming->audioSampleRate : 44100;
+
+    // one window of 220Hz harmonic tone plus noise ( hop = window, one analysis frame )
+    ofxVPAnalysisEngine analysis;
+    analysis.setup(windowSize,windowSize,sampleRate);
+
+    ofSeedRandom(1234);
+    ofSoundBuffer signal;
+    signal.allocate(static_cast<size_t>(windowSize),1);
+    signal.setSampleRate(sampleRate);
+    for(size_t i=0;i<signal.getNumFrames();i++){
+        float phase = TWO_PI*220.0f*i/sampleRate;
+        signal.getBuffer()[i] = 0.5f*sin(phase) + 0.25f*sin(2.0f*phase) + ofRandomf()*0.05f;
+    }
+    analysis.process(signal,1);
+
+    // FFT autocorrelation against the direct O(N^2) sum, relative to the signal energy ( lag 0 )
+    const float *x = analysis.getSignal();
+    const float *r = analysis.getAutoCorrelation();
+    double energy = 0.0;
+    for(int n=0;n<windowSize;n++) energy += static_cast<double>(x[n])*x[n];
+
+    double maxError = 0.0;
+    for(int lag=0;lag<windowSize;lag++){
+        double direct = 0.0;
+        for(int n=0;n+lag<windowSize;n++) direct += static_cast<double>(x[n])*x[n+lag];
+        maxError = std::max(maxError,std::fabs(r[lag]-direct));
+    }
+    double relativeError = energy > 0.0 ? maxError/energy : 1.0;
+    ofLog(OF_LOG_NOTICE,"Autocorrelation [%i] max relative error %g",windowSize,relativeError);
+
+    checkResult("check_autocorrelation",relativeError < 1e-4);
+}
+
+//--------------------------------------------------------------
+void ofApp::checkPitchDetectors(int windowSize){
+    if(!isEnabled("check_pitch")) return;
+
+    int sampleRate = visualProgramming->audioSampleRate > 0 ? visualProgramming->audioSampleRate : 44100;
+
+    // harmonic tones plus noise, then noise only ( 0 ) and silence ( -1 ), three analysis frames each
+    float frequencies[] = { 82.41f, 110.0f, 196.0f, 261.63f, 440.0f, 1046.5f, 0.0f, -1.0f };
+    int detectors[] = { Pitch_Detector_YIN, Pitch_Detector_MPM };
+    string detectorNames[] = { "YIN", "MPM" };
+
+    ofSeedRandom(1234);
+    bool passed = true;
+    for(float f0 : frequencies){
+        ofxVPAnalysisEngine analysis;
+        analysis.setup(windowSize,windowSize,sampleRate);
+
+        ofSoundBuffer signal;
+        signal.allocate(static_cast<size_t>(windowSize),1);
+        signal.setSampleRate(sampleRate);
+        double phase = 0.0;
+        for(uint64_t block=1;block<=3;block++){
+            for(size_t i=0;i<signal.getNumFrames();i++){
+                float noise = f0 < 0.0f ? 0.0f : ofRandomf()*(f0 > 0.0f ? 0.017f : 0.5f);
+                signal.getBuffer()[i] = f0 > 0.0f ? static_cast<float>(0.5*sin(phase) + 0.25*sin(2.0*phase) + 0.12*sin(3.0*phase)) + noise : noise;
+                phase += TWO_PI*f0/sampleRate;
+            }
+            analysis.process(signal,block);
+        }
+
+        for(int d=0;d<2;d++){
+            float pitch = analysis.getPitch(detectors[d]);
+            float confidence = analysis.getPitchConfidence(detectors[d]);
+            bool ok;
+            if(f0 <= 0.0f){
+                // unvoiced
+                ok = confidence < 0.5f;
+            }else if(sampleRate/f0 >= windowSize/2-1){
+                // the period does not fit in the lags of this window
+                ok = confidence == 0.0f;
+            }else{
+                float cents = pitch > 0.0f ? 1200.0f*std::log2(pitch/f0) : 1200.0f;
+                ok = std::fabs(cents) < 1.0f && confidence > 0.9f;
+            }
+            if(!ok){
+                ofLog(OF_LOG_ERROR,"Pitch %s [%i] %.2f Hz: detected %.2f Hz, confidence %.2f",detectorNames[d].c_str(),windowSize,f0,pitch,confidence);
+                passed = false;
+            }
+        }
+    }
+
+    checkResult("check_pitch",passed);
+}
+
+//--------------------------------------------------------------
+void ofApp::runBenchmarks(){
+    ofLog(OF_LOG_NOTICE,"Running benchmarks, %i iterations",iterations);
+
+    // benchmark objects are updated directly, outside the patch execution plan
+    for(int fanOut : {1,8,64,512}){
+        benchmarkLinksFanOut(fanOut);
+    }
+    for(int numSenders : {1,8,64,512}){
+        benchmarkWirelessLinks(numSenders);
+    }
+    for(int bufferSize : {256,512,1024,2048}){
+        benchmarkAudioAnalyzer(bufferSize);
+    }
+    for(int windowSize : {256,1024,4096}){
+        benchmarkAudioFeatures(windowSize);
+    }
+    for(int vectorSize : {1024,65536,1048576}){
+        benchmarkVectorObjects(vectorSize);
+    }
+    for(int numObjects : {1000,10000}){
+        benchmarkXmlEngine(numObjects);
+    }
+    for(int dataSize : {1024,9216,65536}){
+        benchmarkPixelLoops(dataSize);
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::benchmarkLinksFanOut(int fanOut){
+    if(!isEnabled("links_fanout")) return;
+
+    map<int,shared_ptr<PatchObject>> benchObjects;
+
+    shared_ptr<PatchObject> source = newBenchObject("number",benchObjects);
+    if(source == nullptr) return;
+
+    for(int i=0;i<fanOut;i++){
+        shared_ptr<PatchObject> dest = newBenchObject("inverter",benchObjects);
+        if(dest == nullptr) return;
+        visualProgramming->connect(source->getId(),0,dest->getId(),0,VP_LINK_NUMERIC);
+    }
+
+    pdsp::Engine &engine = *visualProgramming->engine;
+    measure("links_fanout",fanOut,[&](){
+        source->update(benchObjects,engine);
+    });
+}
+
+//--------------------------------------------------------------
+void ofApp::benchmarkWirelessLinks(int numSenders){
+    if(!isEnabled("wireless_links")) return;
+
+    map<int,shared_ptr<PatchObject>> benchObjects;
+    vector<PatchObject*> senders;
+
+    // one channel for every sender/receiver couple
+    for(int i=0;i<numSenders;i++){
+        shared_ptr<PatchObject> sender = newBenchObject("number",benchObjects);
+        shared_ptr<PatchObject> receiver = newBenchObject("inverter",benchObjects);
+        if(sender == nullptr || receiver == nullptr) return;
+
+        string channel = "bench_"+ofToString(i);
+        sender->setOutletWirelessSend(0,true);
+        sender->setOutletID(0,channel);
+        receiver->setInletWirelessReceive(0,true);
+        receiver->setInletID(0,channel);
+        // open wireless transport
+        receiver->inletsConnected[0] = true;
+
+        senders.push_back(sender.get());
+    }
+
+    getWirelessBus().rebuild(benchObjects);
+
+    measure("wireless_links",numSenders,[&](){
+        for(size_t i=0;i<senders.size();i++){
+            senders[i]->updateWirelessLinks(benchObjects);
+        }
+    });
+
+    getWirelessBus().clear();
+}
+
+//--------------------------------------------------------------
+void ofApp::benchmarkAudioAnalyzer(int bufferSize){
+    if(!isEnabled("audio_analyzer")) return;
+
+    map<int,shared_ptr<PatchObject>> benchObjects;
+
+    // the analyzer reads the buffer size from the patch settings
+    visualProgramming->setPatchVariable("buffer_size",bufferSize);
+    shared_ptr<PatchObject> analyzer = newBenchObject("audio analyzer",benchObjects);
+    visualProgramming->setPatchVariable("buffer_size",visualProgramming->audioBufferSize);
+    if(analyzer == nullptr) return;
+
+    // 440Hz sine plus noise
+    ofSoundBuffer *signal = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(analyzer->_inletParams[0]);
+    signal->allocate(static_cast<size_t>(bufferSize),1);
+    signal->setSampleRate(visualProgramming->audioSampleRate);
+    for(size_t i=0;i<signal->getNumFrames();i++){
+        signal->getBuffer()[i] = 0.5f*sin(TWO_PI*440.0f*i/visualProgramming->audioSampleRate) + ofRandomf()*0.05f;
+    }
+    analyzer->inletsConnected[0] = true;
+
+    // the analyzer starts analyzing 500 ms after a new connection
+    pdsp::Engine &engine = *visualProgramming->engine;
+    analyzer->update(benchObjects,engine);
+    ofSleepMillis(600);
+    analyzer->update(benchObjects,engine);
+
+    // a new audio block every run ( the shared analysis engine computes once per block )
+    ofSoundBuffer outputBuffer;
+    measure("audio_analyzer",bufferSize,[&](){
+        getAudioClock().beginBlock(bufferSize,visualProgramming->audioSampleRate);
+        analyzer->audioOutObject(outputBuffer);
+    });
+}
+
+//--------------------------------------------------------------
+void ofApp::benchmarkAudioFeatures(int windowSize){
+    if(!isEnabled("audio_features")) return;
+
+    int binSize = windowSize/2 + 1;
+    int sampleRate = visualProgramming->audioSampleRate > 0 ? visualProgramming->audioSampleRate : 44100;
+
+    ofxVPAudioFeatures features;
+    features.setup(binSize,static_cast<float>(sampleRate)/2.0f/(binSize-1));
+
+    // two random spectrums, alternated ( the flux always has something to measure )
+    vector<float> spectrums[2];
+    vector<float> melBands(MEL_SCALE_CRITICAL_BANDS-1);
+    for(int s=0;s<2;s++){
+        spectrums[s].resize(static_cast<size_t>(binSize));
+        for(size_t i=0;i<spectrums[s].size();i++){
+            spectrums[s][i] = ofRandom(0.0f,1.0f);
+        }
+    }
+    for(size_t i=0;i<melBands.size();i++){
+        melBands[i] = ofRandom(0.0f,10.0f);
+    }
+
+    int run = 0;
+    measure("audio_features",windowSize,[&](){
+        features.process(spectrums[run++ % 2].data(),melBands.data());
+    });
+
+    // fixed CPU budget per analysis frame
+    if(!results.empty() && results.back().name == "audio_features" && results.back().p95Ns > AUDIO_FEATURES_BUDGET_NS){
+        ofLog(OF_LOG_ERROR,"Audio features [%i] p95 %.3f us, over the %.3f us budget",windowSize,results.back().p95Ns*1e-3,AUDIO_FEATURES_BUDGET_NS*1e-3);
+        exitCode = EXIT_FAILURE;
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::benchmarkVectorObjects(int vectorSize){
+    if(!isEnabled("vector")) return;
+
+    map<int,shared_ptr<PatchObject>> benchObjects;
+
+    vector<float> data(static_cast<size_t>(vectorSize));
+    for(size_t i=0;i<data.size();i++){
+        data[i] = ofRandomf();
+    }
+
+    shared_ptr<PatchObject> vecOperator = newBenchObject("vector operator",benchObjects);
+    shared_ptr<PatchObject> vecConcat = newBenchObject("vector concat",benchObjects);
+    shared_ptr<PatchObject> vecExtract = newBenchObject("vector extract",benchObjects);
+    if(vecOperator == nullptr || vecConcat == nullptr || vecExtract == nullptr) return;
+
+    // data + value
+    *ofxVP_CAST_PIN_PTR<vector<float>>(vecOperator->_inletParams[0]) = data;
+    *ofxVP_CAST_PIN_PTR<float>(vecOperator->_inletParams[1]) = 0.5f;
+    vecOperator->inletsConnected[0] = true;
+    vecOperator->inletsConnected[1] = true;
+
+    // two vectors
+    for(int i=0;i<2;i++){
+        *ofxVP_CAST_PIN_PTR<vector<float>>(vecConcat->_inletParams[i]) = data;
+        vecConcat->inletsConnected[i] = true;
+    }
+
+    // whole vector range ( start/end are applied from the second update )
+    *ofxVP_CAST_PIN_PTR<vector<float>>(vecExtract->_inletParams[0]) = data;
+    *ofxVP_CAST_PIN_PTR<float>(vecExtract->_inletParams[1]) = 0.0f;
+    *ofxVP_CAST_PIN_PTR<float>(vecExtract->_inletParams[2]) = static_cast<float>(vectorSize);
+    for(int i=0;i<3;i++){
+        vecExtract->inletsConnected[i] = true;
+    }
+
+    pdsp::Engine &engine = *visualProgramming->engine;
+    measure("vector_operator",vectorSize,[&](){
+        vecOperator->update(benchObjects,engine);
+    });
+    measure("vector_concat",vectorSize,[&](){
+        vecConcat->update(benchObjects,engine);
+    });
+    measure("vector_extract",vectorSize,[&](){
+        vecExtract->update(benchObjects,engine);
+    });
+}
+
+//--------------------------------------------------------------
+void ofApp::benchmarkXmlEngine(int numObjects){
+    if(!isEnabled("xml")) return;
+
+    // chain patch built in memory, saved and loaded back from the temp folder
+    ofxVPXmlEngine xmlEngine;
+    ofxVPXmlBenchmark xmlBench = xmlEngine.benchmarkObjectsLookup(numObjects,ofToDataPath("temp/xml_benchmark.xml",true),false);
+
+    if(xmlBench.found != numObjects){
+        ofLog(OF_LOG_ERROR,"XML benchmark found %i of %i objects",xmlBench.found,numObjects);
+        exitCode = EXIT_FAILURE;
+    }
+
+    // single run timings, microseconds
+    auto addSingleResult = [&](string name, uint64_t us){
+        if(!isEnabled(name)) return;
+        vector<uint64_t> runSamples(1,us*1000);
+        addResult(name,numObjects,runSamples);
+    };
+    addSingleResult("xml_build",xmlBench.buildTime);
+    addSingleResult("xml_save",xmlBench.saveTime);
+    addSingleResult("xml_load",xmlBench.loadTime);
+    addSingleResult("xml_index",xmlBench.indexTime);
+    addSingleResult("xml_lookup",xmlBench.lookupTime);
+    addSingleResult("xml_xpath",xmlBench.xpathTime);
+}
+
+//--------------------------------------------------------------
+void ofApp::benchmarkPixelLoops(int dataSize){
+    if(!isEnabled("texture")) return;
+
+    map<int,shared_ptr<PatchObject>> benchObjects;
+
+    vector<float> data(static_cast<size_t>(dataSize));
+    for(size_t i=0;i<data.size();i++){
+        data[i] = ofRandom(-0.5f,0.5f);
+    }
+
+    shared_ptr<PatchObject> toTexture = newBenchObject("data to texture",benchObjects);
+    shared_ptr<PatchObject> toData = newBenchObject("texture to data",benchObjects);
+    if(toTexture == nullptr || toData == nullptr) return;
+
+    // red, green, blue
+    for(int i=0;i<3;i++){
+        *ofxVP_CAST_PIN_PTR<vector<float>>(toTexture->_inletParams[i]) = data;
+        toTexture->inletsConnected[i] = true;
+    }
+    visualProgramming->connect(toTexture->getId(),0,toData->getId(),0,VP_LINK_TEXTURE);
+
+    pdsp::Engine &engine = *visualProgramming->engine;
+    measure("data_to_texture",dataSize,[&](){
+        toTexture->update(benchObjects,engine);
+    });
+    measure("texture_to_data",dataSize,[&](){
+        toData->update(benchObjects,engine);
+    });
+}
+
+//--------------------------------------------------------------
+shared_ptr<PatchObject> ofApp::newBenchObject(string name, map<int,shared_ptr<PatchObject>> &benchObjects){
+    // same object creation path as the GUI
+    int lastID = visualProgramming->lastAddedObjectID;
+    visualProgramming->addObject(name,ofVec2f(0,0));
+
+    shared_ptr<PatchObject> obj = visualProgramming->getLastAddedObject();
+    if(obj == nullptr || visualProgramming->lastAddedObjectID == lastID){
+        ofLog(OF_LOG_ERROR,"Can't create benchmark object %s",name.c_str());
+        exitCode = EXIT_FAILURE;
+        return nullptr;
+    }
+
+    benchObjects[obj->getId()] = obj;
+    return obj;
+}
+
+//--------------------------------------------------------------
+bool ofApp::isEnabled(string name){
+    // match both ways, so a group runs its setup when filtering a single benchmark of the group
+    return filter == "" || name.find(filter) != string::npos || filter.find(name) != string::npos;
+}
+
+//--------------------------------------------------------------
+void ofApp::checkResult(string name, bool passed){
+    if(passed){
+        ofLog(OF_LOG_NOTICE,"%s: passed",name.c_str());
+    }else{
+        ofLog(OF_LOG_ERROR,"%s: FAILED",name.c_str());
+        exitCode = EXIT_FAILURE;
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::measure(string name, int size, std::function<void()> run){
+    if(!isEnabled(name)) return;
+
+    // warm up ( first update loading of custom vars, lazy allocations, caches )
+    for(int i=0;i<std::max(1,iterations/10);i++){
+        run();
+    }
+
+    samples.clear();
+    for(int i=0;i<iterations;i++){
+        uint64_t startNs = ofxVPTimingRing::now();
+        run();
+        samples.push_back(ofxVPTimingRing::now()-startNs);
+    }
+
+    addResult(name,size,samples);
+}
+
+//--------------------------------------------------------------
+void ofApp::addResult(string name, int size, vector<uint64_t> &runSamples){
+    if(runSamples.empty()) return;
+
+    uint64_t sum = 0;
+    for(size_t i=0;i<runSamples.size();i++){
+        sum += runSamples[i];
+    }
+    std::sort(runSamples.begin(),runSamples.end());
+
+    BenchmarkResult res;
+    res.name        = name;
+    res.size        = size;
+    res.iterations  = static_cast<int>(runSamples.size());
+    res.minNs       = runSamples.front();
+    res.meanNs      = sum/runSamples.size();
+    res.p95Ns       = runSamples[std::min(runSamples.size()-1,static_cast<size_t>(runSamples.size()*0.95))];
+    res.maxNs       = runSamples.back();
+    results.push_back(res);
+
+    ofLog(OF_LOG_NOTICE,"%s [%i]: mean %.3f us, p95 %.3f us",name.c_str(),size,res.meanNs*1e-3,res.p95Ns*1e-3);
+}
+
+//--------------------------------------------------------------
+bool ofApp::writeResults(){
+    std::ostringstream json;
+    json << "{\"release\":\"" << VERSION_OFXVP << "\",\"date\":\"" << ofGetTimestampString("%Y-%m-%dT%H:%M:%S") << "\",\"iterations\":" << iterations << ",\"results\":[";
+    for(size_t i=0;i<results.size();i++){
+        json << (i > 0 ? "," : "") << "{\"name\":\"" << results[i].name << "\",\"size\":" << results[i].size << ",\"iterations\":" << results[i].iterations;
+        json << ",\"min_ns\":" << results[i].minNs << ",\"mean_ns\":" << results[i].meanNs << ",\"p95_ns\":" << results[i].p95Ns << ",\"max_ns\":" << results[i].maxNs << "}";
+    }
+    json << "]}";
+
+    // one line on stdout, easy to grep on the build servers
+    std::cout << json.str() << std::endl;
+
+    ofFile resultsOut(resultsFile,ofFile::WriteOnly);
+    if(!resultsOut.is_open()){
+        ofLog(OF_LOG_ERROR,"Can't write benchmark results to %s",resultsFile.c_str());
+        return false;
+    }
+    resultsOut << json.str() << std::endl;
+    resultsOut.close();
+
+    ofLog(OF_LOG_NOTICE,"Benchmark results saved to %s",resultsFile.c_str());
+
+    return true;
+}
+
+//--------------------------------------------------------------
+void ofApp::exit(){
+    visualProgramming->exit();
+}
@@ -0,0 +1,94 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxVisualProgramming.h"
+#include "ofxVPAudioFeatures.h"
+#include "ofxVPAnalysisEngine.h"
+
+struct BenchmarkResult{
+    string      name;
+    int         size;
+    int         iterations;
+    uint64_t    minNs;
+    uint64_t    meanNs;
+    uint64_t    p95Ns;
+    uint64_t    maxNs;
+};
+
+class ofApp : public ofBaseApp{
+
+public:
+    void setup();
+    void update();
+    void exit();
+
+    void runChecks();
+    void checkLazyEvaluation();
+    void checkDspKernels();
+    void checkAutoCorrelation(int windowSize);
+    void checkPitchDetectors(int windowSize);
+
+    void runBenchmarks();
+    void benchmarkLinksFanOut(int fanOut);
+    void benchmarkWirelessLinks(int numSenders);
+    void benchmarkAudioAnalyzer(int bufferSize);
+    void benchmarkAudioFeatures(int windowSize);
+    void benchmarkVectorObjects(int vectorSize);
+    void benchmarkXmlEngine(int numObjects);
+    void benchmarkPixelLoops(int dataSize);
+
+    shared_ptr<PatchObject> newBenchObject(string name, map<int,shared_ptr<PatchObject>> &benchObjects);
+    bool    isEnabled(string name);
+    void    checkResult(string name, bool passed);
+    void    measure(string name, int size, std::function<void()> run);
+    void    addResult(string name, int size, vector<uint64_t> &runSamples);
+    bool    writeResults();
+
+    ofxVisualProgramming    *visualProgramming;
+
+    // BENCHMARK
+    string                  resultsFile;
+    string                  filter;
+    int                     iterations;
+    int                     exitCode;
+    bool                    patchLoaded;
+
+    vector<BenchmarkResult> results;
+    vector<uint64_t>        samples;    // nanoseconds, reused by every benchmark
+
+};
@@ -0,0 +1,114 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#include "ofMain.h"
+#include "ofApp.h"
+#include "ofAppNoWindow.h"
+
+//========================================================================
+// headless patch runner: no window, no GL, no audio devices
+//
+// usage: example_headless patch.xml [options]
+//   --frames N         frames to run ( default 600 )
+//   --fps F            fixed step clock and control rate ( default 60 )
+//   --timings FILE     per object timings JSON ( default headless_timings.json )
+//   --render FILE.wav  offline render of the audio device outputs, as fast as possible
+//   --seconds S        render length ( overrides --frames )
+//   --sr SAMPLERATE    offline sample rate ( default from the patch )
+//   --bs BUFFERSIZE    offline block size ( default from the patch )
+//   --generate TOPO    write a synthetic patch to patch.xml before running it ( chain, fanout, dag, wireless )
+//   --objects N        generated patch objects ( default 1000 )
+//   --fanout N         children by object in fanout, receivers by channel in wireless ( default 8 )
+//   --links N          incoming links by object in dag ( default 2 )
+//   --seed S           generator seed ( default 0 )
+int main(int argc, char *argv[]){
+
+    if(argc < 2){
+        ofLog(OF_LOG_ERROR,"usage: %s patch.xml [--frames N] [--fps F] [--timings FILE] [--render FILE.wav] [--seconds S] [--sr SAMPLERATE] [--bs BUFFERSIZE] [--generate TOPO] [--objects N] [--fanout N] [--links N] [--seed S]",argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    ofApp *runner = new ofApp();
+    runner->patchFile       = ofFilePath::getAbsolutePath(argv[1],false);
+    runner->totalFrames     = 600;
+    runner->frameRate       = 60;
+    runner->timingsFile     = ofFilePath::getAbsolutePath("headless_timings.json",false);
+    runner->renderFile      = "";
+    runner->renderSeconds   = 0.0;
+    runner->sampleRate      = 0;
+    runner->bufferSize      = 0;
+    runner->generateTopology = "";
+
+    for(int i=2;i<argc-1;i+=2){
+        string option = argv[i];
+        string value = argv[i+1];
+        if(option == "--frames"){
+            runner->totalFrames = ofToInt(value);
+        }else if(option == "--fps"){
+            runner->frameRate = std::max(1,ofToInt(value));
+        }else if(option == "--timings"){
+            runner->timingsFile = ofFilePath::getAbsolutePath(value,false);
+        }else if(option == "--render"){
+            runner->renderFile = ofFilePath::getAbsolutePath(value,false);
+        }else if(option == "--seconds"){
+            runner->renderSeconds = ofToDouble(value);
+        }else if(option == "--sr"){
+            runner->sampleRate = ofToInt(value);
+        }else if(option == "--bs"){
+            runner->bufferSize = ofToInt(value);
+        }else if(option == "--generate"){
+            runner->generateTopology = value;
+        }else if(option == "--objects"){
+            runner->generatorSettings.numObjects = ofToInt(value);
+        }else if(option == "--fanout"){
+            runner->generatorSettings.fanOut = ofToInt(value);
+        }else if(option == "--links"){
+            runner->generatorSettings.linksPerObject = ofToInt(value);
+        }else if(option == "--seed"){
+            runner->generatorSettings.seed = static_cast<unsigned int>(ofToInt(value));
+        }else{
+            ofLog(OF_LOG_WARNING,"Unknown option %s",option.c_str());
+        }
+    }
+
+    if(runner->renderSeconds > 0.0){
+        runner->totalFrames = static_cast<int>(ceil(runner->renderSeconds*runner->frameRate));
+    }
+
+    ofAppNoWindow window;
+    ofSetupOpenGL(&window,1280,720,OF_WINDOW);
+
+    // exit code from ofExit ( EXIT_FAILURE if the patch can't be loaded or the results can't be written )
+    return ofRunApp(runner);
+
+}
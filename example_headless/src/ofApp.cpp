@@ -0,0 +1,170 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#include "ofApp.h"
+
+//--------------------------------------------------------------
+void ofApp::setup(){
+    // fixed step clock ( time dependent objects see exactly 1/fps per frame ), no frame rate limit
+    ofSetFrameRate(0);
+    ofSetTimeModeFixedRate(ofGetFixedStepForFps(frameRate));
+
+    exitCode = EXIT_SUCCESS;
+    frame = 0;
+    patchLoaded = false;
+    pendingAudioSamples = 0.0;
+    renderFrames = 0;
+    frameTimings.reserve(static_cast<size_t>(totalFrames));
+
+    visualProgramming = new ofxVisualProgramming();
+    visualProgramming->setupHeadless();
+    visualProgramming->setOfflineAudio(sampleRate,bufferSize);
+
+    // stress inputs: generate the patch first, same seed same patch
+    if(generateTopology != ""){
+        generatorSettings.topology = ofxVPPatchGenerator::topologyFromString(generateTopology);
+        ofxVPPatchGenerator generator;
+        if(!generator.generate(ofToDataPath("empty_patch.xml",true),patchFile,generatorSettings)){
+            exitCode = EXIT_FAILURE;
+            ofExit(exitCode);
+            return;
+        }
+    }
+
+    if(!ofFile::doesFileExist(patchFile)){
+        ofLog(OF_LOG_ERROR,"Patch file not found: %s",patchFile.c_str());
+        exitCode = EXIT_FAILURE;
+        ofExit(exitCode);
+        return;
+    }
+
+    // run on a temp copy, objects write their custom vars to the patch file
+    loadTime = ofxVPTimingRing::now();
+    visualProgramming->newTempPatchFromFile(patchFile);
+}
+
+//--------------------------------------------------------------
+void ofApp::update(){
+
+    if(!patchLoaded){
+        visualProgramming->update();
+        // the temp patch is opened by the objects map cleaning, after the reset wait
+        if(!visualProgramming->clearingObjectsMap && !visualProgramming->bLoadingNewPatch){
+            patchLoaded = true;
+            loadTime = ofxVPTimingRing::now()-loadTime;
+            audioBlock.allocate(static_cast<size_t>(visualProgramming->audioBufferSize),static_cast<size_t>(visualProgramming->audioGUIOUTChannels));
+            audioBlock.setSampleRate(visualProgramming->audioSampleRate);
+            ofLog(OF_LOG_NOTICE,"Patch loaded: %zu objects, running %i frames at %i fps",visualProgramming->patchObjects.size(),totalFrames,frameRate);
+
+            // offline render of the audio device outputs
+            renderFrames = 0;
+            if(renderFile != ""){
+                if(!wavWriter.open(renderFile,visualProgramming->audioSampleRate,visualProgramming->audioGUIOUTChannels)){
+                    exitCode = EXIT_FAILURE;
+                    ofExit(exitCode);
+                }else if(renderSeconds > 0.0){
+                    renderFrames = static_cast<uint64_t>(renderSeconds*visualProgramming->audioSampleRate);
+                }
+            }
+        }
+        return;
+    }
+
+    uint64_t startNs = ofxVPTimingRing::now();
+
+    visualProgramming->update();
+
+    // offline audio, as many blocks as the fixed step needs
+    pendingAudioSamples += static_cast<double>(visualProgramming->audioSampleRate)/static_cast<double>(frameRate);
+    while(pendingAudioSamples >= visualProgramming->audioBufferSize){
+        visualProgramming->processOfflineAudio(audioBlock);
+        if(wavWriter.isOpen() && (renderFrames == 0 || wavWriter.getFramesWritten() < renderFrames)){
+            wavWriter.write(audioBlock);
+        }
+        pendingAudioSamples -= visualProgramming->audioBufferSize;
+    }
+
+    frameTimings.push_back(ofxVPTimingRing::now()-startNs);
+
+    frame++;
+    if(frame >= totalFrames){
+        writeSummary();
+        ofExit(exitCode);
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::writeSummary(){
+
+    uint64_t renderedFrames = 0;
+    if(wavWriter.isOpen()){
+        // complete the requested length ( the fixed step leaves less than a block pending )
+        while(renderFrames > 0 && wavWriter.getFramesWritten() < renderFrames){
+            visualProgramming->processOfflineAudio(audioBlock);
+            wavWriter.write(audioBlock);
+        }
+        renderedFrames = wavWriter.getFramesWritten();
+        ofLog(OF_LOG_NOTICE,"Rendered %llu frames to %s",static_cast<unsigned long long>(renderedFrames),renderFile.c_str());
+        wavWriter.close();
+    }
+
+    // per object min/mean/p95/max
+    if(!visualProgramming->exportProfilerTimings(timingsFile,true)){
+        exitCode = EXIT_FAILURE;
+    }
+
+    if(frameTimings.empty()) return;
+
+    uint64_t sum = 0;
+    for(size_t i=0;i<frameTimings.size();i++){
+        sum += frameTimings[i];
+    }
+    double mean = static_cast<double>(sum)/static_cast<double>(frameTimings.size());
+    std::sort(frameTimings.begin(),frameTimings.end());
+    uint64_t p95 = frameTimings[std::min(frameTimings.size()-1,static_cast<size_t>(frameTimings.size()*0.95))];
+
+    // one line summary on stdout, easy to grep on the build servers
+    std::cout << "{\"patch\":\"" << patchFile << "\",\"frames\":" << frameTimings.size() << ",\"fps\":" << frameRate << ",\"objects\":" << visualProgramming->patchObjects.size();
+    if(renderFile != ""){
+        // DSP throughput: rendered audio seconds per wall clock second
+        double realtimeFactor = sum > 0 ? (static_cast<double>(renderedFrames)/visualProgramming->audioSampleRate)/(sum*1e-9) : 0.0;
+        std::cout << ",\"render\":\"" << renderFile << "\",\"sample_rate\":" << visualProgramming->audioSampleRate << ",\"buffer_size\":" << visualProgramming->audioBufferSize << ",\"rendered_frames\":" << renderedFrames << ",\"realtime_factor\":" << realtimeFactor;
+    }
+    std::cout << ",\"load_ns\":" << loadTime << ",\"frame_min_ns\":" << frameTimings.front() << ",\"frame_mean_ns\":" << static_cast<uint64_t>(mean) << ",\"frame_p95_ns\":" << p95 << ",\"frame_max_ns\":" << frameTimings.back() << "}" << std::endl;
+
+}
+
+//--------------------------------------------------------------
+void ofApp::exit(){
+    visualProgramming->exit();
+}
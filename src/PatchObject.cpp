@@ -60,6 +60,9 @@ PatchObject::PatchObject(const std::string& _customUID ) : ofxVPHasUID(_customUI
     isTextureObject         = false;
     isSharedContextObject   = false;
     isHardwareObject        = false;
+    isPureObject            = false;
+    isThreadSafeObject      = false;
+    isLockFreeAudioObject   = false;
     isResizable             = false;
     willErase               = false;
 
@@ -67,6 +70,20 @@ PatchObject::PatchObject(const std::string& _customUID ) : ofxVPHasUID(_customUI
     resetWirelessLink       = false;
     resetWirelessPin        = -1;
 
+    needsUpdate             = true;
+    linksDeactivatedVersion = 0;
+    linksDeactivatedCount   = 0;
+    for(int i=0;i<MAX_OUTLETS;i++){
+        outletsGeneration[i]    = 1;
+        outletsLastValue[i]     = 0;
+        outletsForward[i]       = -1;
+        outletsEventTime[i]     = 0;
+        outletsEventStamp[i]    = 0;
+    }
+    for(int i=0;i<MAX_INLETS;i++){
+        inletsEventTime[i]      = 0;
+    }
+
     wirelessName            = "";
     wirelessType            = -1;
 
@@ -142,100 +159,179 @@ void PatchObject::setupDSP(pdsp::Engine &engine){
 }
 
 //--------------------------------------------------------------
-void PatchObject::update(map<int,shared_ptr<PatchObject>> &patchObjects, pdsp::Engine &engine){
+void PatchObject::update(map<int,shared_ptr<PatchObject>> &patchObjects, pdsp::Engine &engine, bool lazyEvaluation){
 
     if(willErase) return;
 
-    // update links
-    for(int out=0;out<getNumOutlets();out++){
-        for(int i=0;i<static_cast<int>(outPut.size());i++){
-            if(!outPut[i]->isDisabled && outPut[i]->fromOutletID == out && patchObjects[outPut[i]->toObjectID]!=nullptr && !patchObjects[outPut[i]->toObjectID]->getWillErase()){
-                outPut[i]->posFrom = getOutletPosition(out);
-                outPut[i]->posTo = patchObjects[outPut[i]->toObjectID]->getInletPosition(outPut[i]->toInletID);
-
-                // check first if link is deactivated by shift click
-                outPut[i]->isDeactivated = false;
-                for(size_t di=0;di<linksDeactivated.size();di++){
-                    if(outPut[i]->id == linksDeactivated.at(di)){
-                        outPut[i]->isDeactivated = true;
-                        break;
-                    }
+    // outlets events of the previous frame were already sent
+    for(int out=0;out<getNumOutlets() && out<MAX_OUTLETS;out++){
+        outletsEvents[out].clear();
+    }
+
+    // lazy evaluation: pure objects are computed only when some inlet or custom var changed
+    if(!lazyEvaluation || !isPureObject || needsUpdate){
+        needsUpdate = false;
+
+        updateObjectContent(patchObjects);
+
+        if(this->isPDSPPatchableObject){
+            updateAudioObjectContent(engine);
+        }
+
+        // update outlets generation ( numeric outlets only when the value really changed, or on events )
+        uint64_t updateTime = 0;
+        for(int out=0;out<getNumOutlets() && out<MAX_OUTLETS;out++){
+            bool changed = true;
+            if(getOutletType(out) == VP_LINK_NUMERIC){
+                // compare the value bits ( the outlet pointer never changes, and NaN compares equal to itself )
+                uint32_t valueBits = 0;
+                if(_outletParams[out] != nullptr){
+                    memcpy(&valueBits,_outletParams[out],sizeof(float));
                 }
-                // send data through links
-                if(!outPut[i]->isDeactivated){
-                    if(!patchObjects[outPut[i]->toObjectID]->inletsConnected[outPut[i]->toInletID]){
-                        patchObjects[outPut[i]->toObjectID]->inletsConnected[outPut[i]->toInletID] = true;
-                        if(outPut[i]->type == VP_LINK_AUDIO && patchObjects[outPut[i]->toObjectID]->getIsPDSPPatchableObject()){
-                            if(this->getIsPDSPPatchableObject()){ //  || this->getName() == "audio device"
-                                this->pdspOut[outPut[i]->fromOutletID] >> patchObjects[outPut[i]->toObjectID]->pdspIn[outPut[i]->toInletID];
-                            }
-                        }
-                        patchObjects[outPut[i]->toObjectID]->_inletParams[outPut[i]->toInletID] = _outletParams[out];
-                    }else{
-                        patchObjects[outPut[i]->toObjectID]->_inletParams[outPut[i]->toInletID] = _outletParams[out];
-                    }
+                changed = valueBits != outletsLastValue[out] || !outletsEvents[out].empty();
+                outletsLastValue[out] = valueBits;
+            }
+            if(changed){
+                outletsGeneration[out]++;
 
-                }else{
-                    patchObjects[outPut[i]->toObjectID]->inletsConnected[outPut[i]->toInletID] = false;
-                    if(outPut[i]->type == VP_LINK_AUDIO){
-                        if(patchObjects[outPut[i]->toObjectID]->getIsPDSPPatchableObject() && patchObjects[outPut[i]->toObjectID]->pdspIn[outPut[i]->toInletID].getInputsList().size() > 0){
-                            patchObjects[outPut[i]->toObjectID]->pdspIn[outPut[i]->toInletID].disconnectIn();
+                // numeric events time ( added by the object, stamped by the object, or now )
+                if(getOutletType(out) == VP_LINK_NUMERIC){
+                    if(!outletsEvents[out].empty()){
+                        outletsEventTime[out] = outletsEvents[out].back().timeNs;
+                    }else{
+                        if(outletsEventStamp[out] == 0 && updateTime == 0){
+                            updateTime = getControlClock().now();
                         }
+                        outletsEventTime[out] = outletsEventStamp[out] != 0 ? outletsEventStamp[out] : updateTime;
+                        // a plain value change is one event
+                        float value = 0.0f;
+                        memcpy(&value,&outletsLastValue[out],sizeof(float));
+                        outletsEvents[out].push(outletsEventTime[out],value);
                     }
                 }
-
+                outletsEventStamp[out] = 0;
             }
+            // unchanged numeric values keep the stamp until the value changes ( the event is applied, not lost )
         }
     }
 
-    updateObjectContent(patchObjects);
-
-    if(this->isPDSPPatchableObject){
-        updateAudioObjectContent(engine);
+    // update links ( after computing, so downstream objects read this frame outlets values )
+    int numOutlets = getNumOutlets();
+    for(size_t i=0;i<outPut.size();i++){
+        PatchLink *link = outPut[i].get();
+        int out = link->fromOutletID;
+        if(link->isDisabled || out < 0 || out >= numOutlets) continue;
+
+        // one lookup by link, and no empty entries inserted by map operator[] ( parallel update )
+        map<int,shared_ptr<PatchObject>>::iterator target = patchObjects.find(link->toObjectID);
+        if(target == patchObjects.end() || target->second == nullptr || target->second->getWillErase()) continue;
+        PatchObject *to = target->second.get();
+        int in = link->toInletID;
+
+        link->posFrom = getOutletPosition(out);
+        link->posTo = to->getInletPosition(in);
+
+        // send data through links ( if not deactivated by shift click )
+        if(!link->isDeactivated){
+            if(!to->inletsConnected[in]){
+                // audio objects pins, read by the audio thread ( lock-free objects update outside the lock )
+                std::unique_lock<std::recursive_mutex> lck(getAudioGraphMutex(),std::defer_lock);
+                if(to->getIsAudioINObject() || to->getIsAudioOUTObject() || to->getIsPDSPPatchableObject()){
+                    lck.lock();
+                }
+                to->_inletParams[in] = getOutletData(out);
+                to->inletsConnected[in] = true;
+                to->setNeedsUpdate(true);
+                if(link->type == VP_LINK_AUDIO && to->getIsPDSPPatchableObject()){
+                    if(this->getIsPDSPPatchableObject()){ //  || this->getName() == "audio device"
+                        this->pdspOut[out] >> to->pdspIn[in];
+                    }
+                }
+            }
+            to->_inletParams[in] = getOutletData(out);
+            to->inletsEventTime[in] = getOutletEventTime(out);
+            to->inletsEvents[in].copyFrom(getOutletEvents(out));
+            // notify downstream object about new data
+            if(link->generation != outletsGeneration[out]){
+                link->generation = outletsGeneration[out];
+                to->setNeedsUpdate(true);
+            }
+        }else{
+            bool pdspConnected = link->type == VP_LINK_AUDIO && to->getIsPDSPPatchableObject() && to->pdspIn[in].getInputsList().size() > 0;
+            if(to->inletsConnected[in] || pdspConnected){
+                std::unique_lock<std::recursive_mutex> lck(getAudioGraphMutex(),std::defer_lock);
+                if(to->getIsAudioINObject() || to->getIsAudioOUTObject() || to->getIsPDSPPatchableObject()){
+                    lck.lock();
+                }
+                if(to->inletsConnected[in]){
+                    to->setNeedsUpdate(true);
+                }
+                to->inletsConnected[in] = false;
+                to->inletsEvents[in].clear();
+                if(pdspConnected){
+                    to->pdspIn[in].disconnectIn();
+                }
+            }
+        }
     }
 
 }
 
 //--------------------------------------------------------------
 void PatchObject::updateWirelessLinks(map<int,shared_ptr<PatchObject>> &patchObjects){
+    unusedArgs(patchObjects);
 
     if(willErase) return;
 
-    // Continuosly update float type ONLY wireless links
-    for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-        if(it->second != nullptr){
-            for(int in=0;in<it->second->getNumInlets();in++){
-                for(int out=0;out<this->getNumOutlets();out++){
-                    if(outletsIDs.size() > out){
-                        if(it->second->getInletWirelessReceive(in) && this->getOutletWirelessSend(out) && this->getOutletType(out) == it->second->getInletType(in) && this->getOutletType(out) == VP_LINK_NUMERIC && this->getOutletID(out) == it->second->getInletID(in)){
-                            if(it->second->inletsConnected[in]){
-                                it->second->_inletParams[in] = this->_outletParams[out];
-                            }
-                        }
-                    }
+    // wireless names/types just changed, wait for the routing table rebuild ( next frame )
+    if(getWirelessBus().isDirty()) return;
+
+    // wireless routes from this object outlets ( same channel and type )
+    const vector<ofxVPWirelessRoute> *routes = getWirelessBus().getRoutes(this);
+    if(routes == nullptr){
+        initWirelessLink    = false;
+        resetWirelessLink   = false;
+        resetWirelessPin    = -1;
+        return;
+    }
+
+    // Continuosly update float type and pass-through wireless links
+    for(size_t r=0;r<routes->size();r++){
+        int out = routes->at(r).outlet;
+        void *data = this->getOutletData(out);
+        bool forward = this->getOutletType(out) == VP_LINK_NUMERIC || outletsForward[out] != -1;
+        for(size_t i=0;i<routes->at(r).receivers.size();i++){
+            PatchObject *receiver = routes->at(r).receivers[i].object;
+            int in = routes->at(r).receivers[i].pin;
+            if(receiver->inletsConnected[in] && (forward || receiver->_inletParams[in] != this->_outletParams[out])){
+                if(receiver->_inletParams[in] != data){
+                    receiver->setNeedsUpdate(true);
                 }
+                receiver->_inletParams[in] = data;
+                receiver->inletsEventTime[in] = this->getOutletEventTime(out);
+                receiver->inletsEvents[in].copyFrom(this->getOutletEvents(out));
             }
         }
-
     }
 
     // manually send data through wireless links ( if var ID, transport data )
     if(initWirelessLink && resetWirelessPin != -1){
         initWirelessLink = false;
         if(this->getOutletWirelessSend(resetWirelessPin)){
-            for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-                if(it->second != nullptr){
-                    for(int in=0;in<it->second->getNumInlets();in++){
-                        if(this->getOutletType(resetWirelessPin) == it->second->getInletType(in) && this->getOutletID(resetWirelessPin) == it->second->getInletID(in) && it->second->getInletWirelessReceive(in)){
-                            if(!it->second->inletsConnected[in]){ // open wireless transport
-                                it->second->inletsConnected[in] = true;
-                                if(this->getOutletType(resetWirelessPin) == VP_LINK_AUDIO && this->getIsPDSPPatchableObject() && it->second->getIsPDSPPatchableObject()){
-                                    this->pdspOut[resetWirelessPin] >> it->second->pdspIn[in];
-                                }
-                                it->second->_inletParams[in] = this->_outletParams[resetWirelessPin];
-                                //std::cout << "Wireless connection ON between " << this->getName() << " and " << it->second->getName() << std::endl;
-                            }
+            for(size_t r=0;r<routes->size();r++){
+                if(routes->at(r).outlet != resetWirelessPin) continue;
+                for(size_t i=0;i<routes->at(r).receivers.size();i++){
+                    PatchObject *receiver = routes->at(r).receivers[i].object;
+                    int in = routes->at(r).receivers[i].pin;
+                    if(!receiver->inletsConnected[in]){ // open wireless transport
+                        receiver->inletsConnected[in] = true;
+                        receiver->setNeedsUpdate(true);
+                        if(this->getOutletType(resetWirelessPin) == VP_LINK_AUDIO && this->getIsPDSPPatchableObject() && receiver->getIsPDSPPatchableObject()){
+                            std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
+                            this->pdspOut[resetWirelessPin] >> receiver->pdspIn[in];
                         }
+                        receiver->_inletParams[in] = this->getOutletData(resetWirelessPin);
+                        //std::cout << "Wireless connection ON between " << this->getName() << " and " << receiver->getName() << std::endl;
                     }
                 }
             }
@@ -247,20 +343,19 @@ void PatchObject::updateWirelessLinks(map<int,shared_ptr<PatchObject>> &patchObj
     // Manually close wireless link from internal object code ( GUI )
     if(resetWirelessLink && resetWirelessPin != -1){
         resetWirelessLink = false;
-        for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-            if(it->second != nullptr){
-                if(this->getId() != it->first){
-                    for(int in=0;in<it->second->getNumInlets();in++){
-                        if(this->getOutletType(resetWirelessPin) == it->second->getInletType(in) && this->getOutletID(resetWirelessPin) == it->second->getInletID(in)){
-                            if(it->second->inletsConnected[in]){ // close wireless transport
-                                it->second->inletsConnected[in] = false;
-                                if(this->getOutletType(resetWirelessPin) == VP_LINK_AUDIO && this->getIsPDSPPatchableObject() && it->second->getIsPDSPPatchableObject() && it->second->pdspIn[in].getInputsList().size() > 0){
-                                    it->second->pdspIn[in].disconnectIn();
-                                }
-                                //std::cout << "Wireless connection OFF between " << this->getName() << " and " << it->second->getName() << std::endl;
-                            }
-                        }
+        for(size_t r=0;r<routes->size();r++){
+            if(routes->at(r).outlet != resetWirelessPin) continue;
+            for(size_t i=0;i<routes->at(r).receivers.size();i++){
+                PatchObject *receiver = routes->at(r).receivers[i].object;
+                int in = routes->at(r).receivers[i].pin;
+                if(receiver != this && receiver->inletsConnected[in]){ // close wireless transport
+                    receiver->inletsConnected[in] = false;
+                    receiver->setNeedsUpdate(true);
+                    if(this->getOutletType(resetWirelessPin) == VP_LINK_AUDIO && this->getIsPDSPPatchableObject() && receiver->getIsPDSPPatchableObject() && receiver->pdspIn[in].getInputsList().size() > 0){
+                        std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
+                        receiver->pdspIn[in].disconnectIn();
                     }
+                    //std::cout << "Wireless connection OFF between " << this->getName() << " and " << receiver->getName() << std::endl;
                 }
             }
         }
@@ -435,8 +530,15 @@ void PatchObject::drawImGuiNode(ImGuiEx::NodeCanvas& _nodeCanvas, map<int,shared
         // Refresh links to eventually disconnect ( backspace key )
         linksToDisconnect   = _nodeCanvas.getSelectedLinks();
 
-        // Refresh links deactivated
-        linksDeactivated    = _nodeCanvas.getDeactivatedLinks();
+        // Refresh links deactivated bit ( only when the canvas list or the links change )
+        if(_nodeCanvas.getDeactivatedLinksVersion() != linksDeactivatedVersion || outPut.size() != linksDeactivatedCount){
+            linksDeactivatedVersion = _nodeCanvas.getDeactivatedLinksVersion();
+            linksDeactivatedCount   = outPut.size();
+            const std::vector<int> &deactivated = _nodeCanvas.getDeactivatedLinks();
+            for(size_t i=0;i<outPut.size();i++){
+                outPut[i]->isDeactivated = std::find(deactivated.begin(),deactivated.end(),outPut[i]->id) != deactivated.end();
+            }
+        }
 
         // Refresh objects selected to eventually duplicate or delete ( cmd-d or backsapce )
         objectsSelected = _nodeCanvas.getSelectedNodesId();
@@ -481,6 +583,23 @@ void PatchObject::move(int _x, int _y){
     this->y = py;
 }
 
+//--------------------------------------------------------------
+bool PatchObject::addOutletBang(int outlet, uint64_t timeNs, uint64_t maxGateNs){
+    // on/off event pair, open for one frame as a latched bang value ( maxGateNs at most )
+    if(outletsEvents[outlet].available() < 2) return false;
+    uint64_t gateNs = std::min(static_cast<uint64_t>(ofGetLastFrameTime()*1000000000.0),maxGateNs);
+    outletsEvents[outlet].push(timeNs,1.0f);
+    outletsEvents[outlet].push(timeNs+gateNs,0.0f);
+    return true;
+}
+
+//--------------------------------------------------------------
+const ofxVPEventList<>& PatchObject::getInletEvents(int iid) const{
+    // a removed link leaves its last events behind, they are not sent again
+    static const ofxVPEventList<> noEvents;
+    return inletsConnected[iid] ? inletsEvents[iid] : noEvents;
+}
+
 //--------------------------------------------------------------
 ImVec2 PatchObject::getInletPosition(int iid){
     return ImVec2((inletsPositions[iid].x - canvasTranslation.x)/canvasScale, (inletsPositions[iid].y - canvasTranslation.y)/canvasScale);
@@ -513,7 +632,7 @@ bool PatchObject::connectTo(map<int,shared_ptr<PatchObject>> &patchObjects, int
 
         //cout << "Mosaic :: "<< "Connect object " << getName().c_str() << ":" << ofToString(getId()) << " to object " << getName().c_str() << ":" << ofToString(this->getId()) << endl;
 
-        shared_ptr<PatchLink> tempLink = shared_ptr<PatchLink>(new PatchLink());
+        shared_ptr<PatchLink> tempLink = makePatchLink();
 
         string tmpID = ofToString(fromObjectID)+ofToString(fromOutlet)+ofToString(this->getId())+ofToString(toInlet);
 
@@ -524,12 +643,14 @@ bool PatchObject::connectTo(map<int,shared_ptr<PatchObject>> &patchObjects, int
         tempLink->fromOutletID  = fromOutlet;
         tempLink->toObjectID    = this->getId();
         tempLink->toInletID     = toInlet;
+        tempLink->generation    = 0;
         tempLink->isDisabled    = false;
         tempLink->isDeactivated = false;
 
         patchObjects[fromObjectID]->outPut.push_back(tempLink);
 
         inletsConnected[toInlet] = true;
+        needsUpdate = true;
 
         if(tempLink->type == VP_LINK_NUMERIC){
             _inletParams[toInlet] = new float();
@@ -544,6 +665,7 @@ bool PatchObject::connectTo(map<int,shared_ptr<PatchObject>> &patchObjects, int
         }else if(tempLink->type == VP_LINK_FBO){
             _inletParams[toInlet] = new ofxPingPong();
         }else if(tempLink->type == VP_LINK_AUDIO){
+            std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
             _inletParams[toInlet] = new ofSoundBuffer();
             if(patchObjects[fromObjectID]->getIsPDSPPatchableObject() && getIsPDSPPatchableObject()){
                 patchObjects[fromObjectID]->pdspOut[fromOutlet] >> pdspIn[toInlet];
@@ -565,6 +687,8 @@ bool PatchObject::connectTo(map<int,shared_ptr<PatchObject>> &patchObjects, int
         }
 
         connected = true;
+
+        ofNotifyEvent(linksChangedEvent, nId);
     }
 
     return connected;
@@ -596,7 +720,9 @@ void PatchObject::disconnectFrom(map<int,shared_ptr<PatchObject>> &patchObjects,
                         }else{
                             it->second->removeLinkFromConfig(it->second->outPut[s]->fromOutletID,it->second->outPut[s]->toObjectID,it->second->outPut[s]->toInletID);
                             this->inletsConnected[objectInlet] = false;
+                            this->needsUpdate = true;
                             if(this->getIsPDSPPatchableObject()){
+                                std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
                                 this->pdspIn[objectInlet].disconnectIn();
                             }
                         }
@@ -604,6 +730,8 @@ void PatchObject::disconnectFrom(map<int,shared_ptr<PatchObject>> &patchObjects,
 
                     it->second->outPut = tempBuffer;
 
+                    ofNotifyEvent(linksChangedEvent, nId);
+
                     break;
                 }
 
@@ -640,7 +768,9 @@ void PatchObject::disconnectLink(map<int,shared_ptr<PatchObject>> &patchObjects,
                             it->second->removeLinkFromConfig(it->second->outPut[s]->fromOutletID,it->second->outPut[s]->toObjectID,it->second->outPut[s]->toInletID);
                             if(patchObjects[it->second->outPut[j]->toObjectID] != nullptr){
                                 patchObjects[it->second->outPut[j]->toObjectID]->inletsConnected[it->second->outPut[j]->toInletID] = false;
+                                patchObjects[it->second->outPut[j]->toObjectID]->setNeedsUpdate(true);
                                 if(patchObjects[it->second->outPut[j]->toObjectID]->getIsPDSPPatchableObject()){
+                                    std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
                                     patchObjects[it->second->outPut[j]->toObjectID]->pdspIn[it->second->outPut[j]->toInletID].disconnectIn();
                                 }
                             }
@@ -649,6 +779,8 @@ void PatchObject::disconnectLink(map<int,shared_ptr<PatchObject>> &patchObjects,
 
                     it->second->outPut = tempBuffer;
 
+                    ofNotifyEvent(linksChangedEvent, nId);
+
                     break;
                 }
             }
@@ -670,80 +802,90 @@ bool PatchObject::loadConfig(shared_ptr<ofAppGLFWWindow> &mainWindow, pdsp::Engi
     if (XML.load(configFile)){
 #endif
 
-        patchFile = configFile;
-
         if(XML.pushTag("object", oTag)){
 
-            nId = XML.getValue("id", 0);
-            name = XML.getValue("name","none");
-            filepath = XML.getValue("filepath","none");
-            subpatchName = XML.getValue("subpatch","root");
+            loaded = loadConfig(mainWindow,engine,configFile,XML);
 
-            move(XML.getValue("position:x", 0),XML.getValue("position:y", 0));
+            XML.popTag(); // if(XML.pushTag("object", oTag))
 
-            if(XML.pushTag("vars")){
-                int totalCustomVars = XML.getNumTags("var");
-                for (int i=0;i<totalCustomVars;i++){
-                    if(XML.pushTag("var",i)){
-                        customVars[XML.getValue("name", "")] = XML.getValue("value", 0.0);
-                        XML.popTag();
-                    }
-                }
+        }
+    }
+
+    return loaded;
+
+}
+
+//--------------------------------------------------------------
+// load from an already parsed patch, with XML pushed into this object tag
+bool PatchObject::loadConfig(shared_ptr<ofAppGLFWWindow> &mainWindow, pdsp::Engine &engine, string &configFile, ofxXmlSettings &XML){
+
+    patchFile = configFile;
+
+    nId = XML.getValue("id", 0);
+    name = XML.getValue("name","none");
+    filepath = XML.getValue("filepath","none");
+    subpatchName = XML.getValue("subpatch","root");
+
+    move(XML.getValue("position:x", 0),XML.getValue("position:y", 0));
+
+    if(XML.pushTag("vars")){
+        int totalCustomVars = XML.getNumTags("var");
+        for (int i=0;i<totalCustomVars;i++){
+            if(XML.pushTag("var",i)){
+                customVars[XML.getValue("name", "")] = XML.getValue("value", 0.0);
                 XML.popTag();
             }
+        }
+        XML.popTag();
+    }
 
-            if(XML.pushTag("inlets")){
-                int totalInlets = XML.getNumTags("link");
-                inletsPositions.clear();
-                inletsIDs.clear();
-                inletsWirelessReceive.clear();
-                for (int i=0;i<totalInlets;i++){
-                    if(XML.pushTag("link",i)){
-                        inletsType.push_back(XML.getValue("type", 0));
-                        inletsNames.push_back(XML.getValue("name", ""));
-                        inletsIDs.push_back("");
-                        inletsWirelessReceive.push_back(false);
-                        inletsPositions.push_back( ImVec2(this->x, this->y + this->height*.5f) );
-                        XML.popTag();
-                    }
-                }
+    if(XML.pushTag("inlets")){
+        int totalInlets = XML.getNumTags("link");
+        inletsPositions.clear();
+        inletsIDs.clear();
+        inletsWirelessReceive.clear();
+        for (int i=0;i<totalInlets;i++){
+            if(XML.pushTag("link",i)){
+                inletsType.push_back(XML.getValue("type", 0));
+                inletsNames.push_back(XML.getValue("name", ""));
+                inletsIDs.push_back("");
+                inletsWirelessReceive.push_back(false);
+                inletsPositions.push_back( ImVec2(this->x, this->y + this->height*.5f) );
                 XML.popTag();
             }
+        }
+        XML.popTag();
+    }
 
-            setup(mainWindow);
-            setupDSP(engine);
-
-            if(XML.pushTag("outlets")){
-                int totalOutlets = XML.getNumTags("link");
-                outletsPositions.clear();
-                outletsIDs.clear();
-                outletsWirelessSend.clear();
-                for (int i=0;i<totalOutlets;i++){
-                    if(XML.pushTag("link",i)){
-                        outletsType.push_back(XML.getValue("type", 0));
-                        outletsNames.push_back(XML.getValue("name", ""));
-                        outletsIDs.push_back("");
-                        outletsWirelessSend.push_back(false);
-                        outletsPositions.push_back( ImVec2( this->x + this->width, this->y + this->height*.5f) );
-                        XML.popTag();
-                    }
-                }
+    setup(mainWindow);
+    setupDSP(engine);
+
+    if(XML.pushTag("outlets")){
+        int totalOutlets = XML.getNumTags("link");
+        outletsPositions.clear();
+        outletsIDs.clear();
+        outletsWirelessSend.clear();
+        for (int i=0;i<totalOutlets;i++){
+            if(XML.pushTag("link",i)){
+                outletsType.push_back(XML.getValue("type", 0));
+                outletsNames.push_back(XML.getValue("name", ""));
+                outletsIDs.push_back("");
+                outletsWirelessSend.push_back(false);
+                outletsPositions.push_back( ImVec2( this->x + this->width, this->y + this->height*.5f) );
                 XML.popTag();
             }
-
-            XML.popTag(); // if(XML.pushTag("object", oTag))
-
-            loaded = true;
-
         }
+        XML.popTag();
     }
 
-    return loaded;
+    return true;
 
 }
 
 //--------------------------------------------------------------
 bool PatchObject::saveConfig(bool newConnection){
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
     ofxXmlSettings XML;
     bool saved = false;
 
@@ -903,11 +1045,7 @@ bool PatchObject::saveConfig(bool newConnection){
                     }
                 }
             }
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            saved = XML.saveFile();
-#else
-            saved = XML.save();
-#endif
+            saved = ofxVPPatchPersistence::saveXml(XML,patchFile);
         }
     }
 
@@ -915,8 +1053,23 @@ bool PatchObject::saveConfig(bool newConnection){
 
 }
 
+//--------------------------------------------------------------
+void PatchObject::setCustomVar(float value, string name){
+    customVars[name] = value;
+    needsUpdate = true;
+
+    if(nId != -1 && patchFile != ""){
+        // write-behind, the patch file will be updated from the persistence thread
+        getPatchPersistence().setObjectVar(patchFile,nId,name,value);
+    }else{
+        saveConfig(false);
+    }
+}
+
 //--------------------------------------------------------------
 bool PatchObject::removeLinkFromConfig(int outlet, int toObjectID, int toInletID){
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
     ofxXmlSettings XML;
     bool saved = false;
 
@@ -955,11 +1108,7 @@ bool PatchObject::removeLinkFromConfig(int outlet, int toObjectID, int toInletID
             }
         }
 
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            saved = XML.saveFile();
-#else
-            saved = XML.save();
-#endif
+            saved = ofxVPPatchPersistence::saveXml(XML,patchFile);
     }
 
     return saved;
@@ -967,6 +1116,10 @@ bool PatchObject::removeLinkFromConfig(int outlet, int toObjectID, int toInletID
 
 //--------------------------------------------------------------
 bool PatchObject::clearCustomVars(){
+    // write pending vars first, then edit the patch file
+    getPatchPersistence().flush();
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
     ofxXmlSettings XML;
     bool saved = false;
 
@@ -1010,11 +1163,7 @@ bool PatchObject::clearCustomVars(){
             }
         }
 
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            saved = XML.saveFile();
-#else
-            saved = XML.save();
-#endif
+            saved = ofxVPPatchPersistence::saveXml(XML,patchFile);
 
     }
 
@@ -1023,6 +1172,10 @@ bool PatchObject::clearCustomVars(){
 
 //--------------------------------------------------------------
 map<string,float> PatchObject::loadCustomVars(){
+    // make sure the patch file is up to date with the write-behind journal
+    getPatchPersistence().flush();
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
     map<string,float> tempVars;
 
     ofxXmlSettings XML;
@@ -1170,6 +1323,7 @@ void PatchObject::setPatchfile(string pf) {
     ofFile temp(patchFile);
     patchFolderPath = temp.getEnclosingDirectory()+"data/";
     if(filepath != "none"){
+        string prevFilepath = filepath;
         ofFile t2(filepath);
         if(t2.isDirectory()){
             string tst = filepath.substr(0, filepath.size()-1);
@@ -1180,11 +1334,13 @@ void PatchObject::setPatchfile(string pf) {
             filepath = patchFolderPath+t2.getFileName();
         }
 
-        if(this->getName() == "timeline"){
-            this->customReset();
-        }
+        // objects with data bound to the patch folder ( they save their config if needed )
+        this->customReset();
 
-        saveConfig(false);
+        // avoid rewriting the whole patch file for every object while loading a patch
+        if(filepath != prevFilepath){
+            saveConfig(false);
+        }
     }
 }
 
@@ -1231,6 +1387,7 @@ void PatchObject::keyReleased(ofKeyEventArgs &e,map<int,shared_ptr<PatchObject>>
 //--------------------------------------------------------------
 void PatchObject::audioIn(ofSoundBuffer &inputBuffer){
     if(isAudioINObject && !willErase){
+        ofxVPScopedTiming audioTiming(timings.sections[OFXVP_PROFILE_AUDIO]);
         audioInObject(inputBuffer);
     }
 }
@@ -1238,6 +1395,18 @@ void PatchObject::audioIn(ofSoundBuffer &inputBuffer){
 //--------------------------------------------------------------
 void PatchObject::audioOut(ofSoundBuffer &outputBuffer){
     if(isAudioOUTObject && !willErase){
+        ofxVPScopedTiming audioTiming(timings.sections[OFXVP_PROFILE_AUDIO]);
         audioOutObject(outputBuffer);
     }
 }
+
+//--------------------------------------------------------------
+void PatchObject::audioSilence(ofSoundBuffer &silenceBuffer){
+    if((isAudioINObject || isAudioOUTObject) && !willErase){
+        // never waits, a layout change in progress keeps the inputs as they are
+        std::unique_lock<std::mutex> lck(audioStateMutex,std::try_to_lock);
+        if(lck.owns_lock()){
+            audioSilenceObject(silenceBuffer);
+        }
+    }
+}
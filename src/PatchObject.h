@@ -34,6 +34,14 @@
 #include "ofMain.h"
 
 #include "ofxVPConfig.h"
+#include "ofxVPAudioGraphLock.h"
+#include "ofxVPControlClock.h"
+#include "ofxVPEventQueue.h"
+#include "ofxVPPatchPersistence.h"
+#include "ofxVPWirelessBus.h"
+#include "ofxVPObjectProfiler.h"
+#include "ofxVPPoolAllocator.h"
+#include "ofxVPTriggerControl.h"
 #include "utils.h"
 
 #include "ofxXmlSettings.h"
@@ -69,10 +77,16 @@ struct PatchLink{
     int                     toObjectID;
     int                     toInletID;
     int                     id;
+    uint64_t                generation; // last outlet generation sent through this link
     bool                    isDisabled;
-    bool                    isDeactivated;
+    bool                    isDeactivated;  // shift click on the canvas, refreshed only when the canvas list changes
 };
 
+// pooled link allocation ( link and shared_ptr control block in a single block, links contiguous in memory )
+inline shared_ptr<PatchLink> makePatchLink(){
+    return std::allocate_shared<PatchLink>(ofxVPPoolAllocator<PatchLink>());
+}
+
 
 class PatchObject : public ofxVPHasUID {
 
@@ -83,7 +97,7 @@ public:
 
     void                    setup(shared_ptr<ofAppGLFWWindow> &mainWindow);
     void                    setupDSP(pdsp::Engine &engine);
-    void                    update(map<int,shared_ptr<PatchObject>> &patchObjects, pdsp::Engine &engine);
+    void                    update(map<int,shared_ptr<PatchObject>> &patchObjects, pdsp::Engine &engine, bool lazyEvaluation=false);
     void                    updateWirelessLinks(map<int,shared_ptr<PatchObject>> &patchObjects);
     void                    draw(ofTrueTypeFont *font);
     void                    drawImGuiNode(ImGuiEx::NodeCanvas& _nodeCanvas, map<int,shared_ptr<PatchObject>> &patchObjects);
@@ -106,8 +120,9 @@ public:
 
     virtual void            audioInObject(ofSoundBuffer &inputBuffer) { unusedArgs(inputBuffer); }
     virtual void            audioOutObject(ofSoundBuffer &outputBuffer) { unusedArgs(outputBuffer); }
+    virtual void            audioSilenceObject(ofSoundBuffer &silenceBuffer) { unusedArgs(silenceBuffer); }  // zeroes the pdsp external inputs ( audio block skipped )
 
-    virtual void            customReset() {}
+    virtual void            customReset() {}        // called when the patch file is set ( data folder moved )
     virtual void            resetSystemObject() {}
     virtual void            resetResolution(int fromID=-1, int newWidth=-1, int newHeight=-1) { unusedArgs(fromID,newWidth,newHeight); }
 
@@ -118,6 +133,7 @@ public:
     // Sound
     void                    audioIn(ofSoundBuffer &inputBuffer);
     void                    audioOut(ofSoundBuffer &outputBuffer);
+    void                    audioSilence(ofSoundBuffer &silenceBuffer);
 
     void                    move(int _x, int _y);
 
@@ -130,18 +146,20 @@ public:
 
     // LOAD/SAVE
     bool                    loadConfig(shared_ptr<ofAppGLFWWindow> &mainWindow, pdsp::Engine &engine,int oTag, string &configFile);
+    bool                    loadConfig(shared_ptr<ofAppGLFWWindow> &mainWindow, pdsp::Engine &engine, string &configFile, ofxXmlSettings &XML);
     bool                    saveConfig(bool newConnection);
     bool                    removeLinkFromConfig(int outlet, int toObjectID, int toInletID);
 
     void                    addInlet(int type,string name) { inletsType.push_back(type);inletsNames.push_back(name); inletsIDs.push_back(""); inletsWirelessReceive.push_back(false); inletsPositions.push_back( ImVec2(this->x, this->y + this->height*.5f) ); }
     void                    addOutlet(int type,string name = "") { outletsType.push_back(type);outletsNames.push_back(name); outletsIDs.push_back(""); outletsWirelessSend.push_back(false); outletsPositions.push_back( ImVec2( this->x + this->width, this->y + this->height*.5f) ); }
     void                    initInletsState() { for(int i=0;i<numInlets;i++){ inletsConnected.push_back(false); } }
-    void                    setCustomVar(float value, string name){ customVars[name] = value; saveConfig(false); }
+    void                    setCustomVar(float value, string name);
     float                   getCustomVar(string name) { if ( customVars.find(name) != customVars.end() ) { return customVars[name]; }else{ return 0; } }
     float                   existsCustomVar(string name) { if ( customVars.find(name) != customVars.end() ) { return true; }else{ return false; } }
     void                    substituteCustomVar(string oldName, string newName) { if ( customVars.find(oldName) != customVars.end() ) { customVars[newName] = customVars[oldName]; customVars.erase(oldName); } }
     bool                    clearCustomVars();
     map<string,float>       loadCustomVars();
+    const map<string,float>& getCustomVars() const { return customVars; }
 
     // GETTERS
     int                     getId() const { return nId; }
@@ -158,7 +176,18 @@ public:
     bool                    getIsTextureObject() const { return isTextureObject; }
     bool                    getIsSharedContextObject() const { return isSharedContextObject; }
     bool                    getIsHardwareObject() const { return isHardwareObject; }
+    bool                    getIsPureObject() const { return isPureObject; }
+    bool                    getIsThreadSafeObject() const { return isThreadSafeObject; }
+    bool                    getIsLockFreeAudioObject() const { return isLockFreeAudioObject; }
+    bool                    getNeedsUpdate() const { return needsUpdate; }
+    uint64_t                getOutletGeneration(int oid) const { return outletsGeneration[oid]; }
+    void*                   getOutletData(int oid) { return (outletsForward[oid] != -1 && inletsConnected[outletsForward[oid]]) ? _inletParams[outletsForward[oid]] : _outletParams[oid]; }
+    uint64_t                getOutletEventTime(int oid) const { return (outletsForward[oid] != -1 && inletsConnected[outletsForward[oid]]) ? inletsEventTime[outletsForward[oid]] : outletsEventTime[oid]; }
+    uint64_t                getInletEventTime(int iid) const { return inletsEventTime[iid] != 0 ? inletsEventTime[iid] : getControlClock().now(); }
+    const ofxVPEventList<>& getOutletEvents(int oid) const { return (outletsForward[oid] != -1 && inletsConnected[outletsForward[oid]]) ? inletsEvents[outletsForward[oid]] : outletsEvents[oid]; }
+    const ofxVPEventList<>& getInletEvents(int iid) const;
     int                     getInletType(int iid) const { return inletsType[iid]; }
+    string                  getInletName(int iid) const { return inletsNames[iid]; }
     string                  getInletID(int iid) const { return inletsIDs[iid]; }
     bool                    getInletWirelessReceive(int iid) const { return inletsWirelessReceive[iid]; }
     string                  getInletTypeName(const int& iid) const;
@@ -175,6 +204,7 @@ public:
     int                     getNumOutlets() { return static_cast<int>(outletsType.size()); }
     bool                    getIsOutletConnected(int oid);
     bool                    getWillErase() { return willErase; }
+    ofxVPObjectTimings&     getTimings() { return timings; }
 
     float                   getObjectWidth() { return width; }
     float                   getObjectHeight() { return height; }
@@ -194,18 +224,25 @@ public:
     void                    setIsTextureObj(bool it) { isTextureObject = it; }
     void                    setIsSharedContextObj(bool isc) { isSharedContextObject = isc; }
     void                    setIsHardwareObj(bool ih) { isHardwareObject = ih; }
+    void                    setIsPureObj(bool ip) { isPureObject = ip; }
+    void                    setIsThreadSafeObj(bool its) { isThreadSafeObject = its; }
     void                    setIsResizable(bool ir) { isResizable = ir; }
     void                    setIsRetina(bool ir, float sf);
     void                    setIsActive(bool ia) { bActive = ia; }
     void                    setWillErase(bool e) { willErase = e; }
+    void                    setNeedsUpdate(bool nu) { needsUpdate = nu; }
+    void                    setOutletForward(int outlet, int inlet=-1) { outletsForward[outlet] = inlet; }
+    void                    setOutletEventTime(int outlet, uint64_t timeNs) { outletsEventStamp[outlet] = timeNs; }
+    bool                    addOutletEvent(int outlet, uint64_t timeNs, float value) { return outletsEvents[outlet].push(timeNs,value); }
+    bool                    addOutletBang(int outlet, uint64_t timeNs, uint64_t maxGateNs=std::numeric_limits<uint64_t>::max());
     void                    setIsObjectSelected(bool s) { isObjectSelected = s; }
     void                    setConfigmenuWidth(float cmw) { configMenuWidth = cmw; }
     void                    setDimensions(float w, float h) { width = w; height = h;}
     void                    setSubpatch(string sp) { subpatchName = sp; }
-    void                    setInletID(int inlet, string ID) { inletsIDs[inlet] = ID; }
-    void                    setOutletID(int outlet, string ID) { outletsIDs[outlet] = ID; }
-    void                    setInletWirelessReceive(int inlet, bool wireless) { inletsWirelessReceive.at(inlet) = wireless; }
-    void                    setOutletWirelessSend(int outlet, bool wireless) { outletsWirelessSend.at(outlet) = wireless; }
+    void                    setInletID(int inlet, string ID) { inletsIDs[inlet] = ID; getWirelessBus().invalidate(); }
+    void                    setOutletID(int outlet, string ID) { outletsIDs[outlet] = ID; getWirelessBus().invalidate(); }
+    void                    setInletWirelessReceive(int inlet, bool wireless) { inletsWirelessReceive.at(inlet) = wireless; getWirelessBus().invalidate(); }
+    void                    setOutletWirelessSend(int outlet, bool wireless) { outletsWirelessSend.at(outlet) = wireless; getWirelessBus().invalidate(); }
 
     // PUGG Plugin System
     static const int version = 1;
@@ -214,9 +251,10 @@ public:
     // patch object connections
     vector<shared_ptr<PatchLink>>       outPut;
     vector<int>                         linksToDisconnect;
-    vector<int>                         linksDeactivated;
+    unsigned int                        linksDeactivatedVersion;
+    size_t                              linksDeactivatedCount;
     vector<int>                         objectsSelected;
-    vector<bool>                        inletsConnected;
+    vector<uint8_t>                     inletsConnected;    // one byte per inlet, upstream objects updating in parallel write different inlets
 
     // subpatch vars
     string                              subpatchName;
@@ -234,6 +272,8 @@ public:
     ofEvent<int>                        removeEvent;
     ofEvent<int>                        reconnectOutletsEvent;
     ofEvent<int>                        duplicateEvent;
+    ofEvent<int>                        linksChangedEvent;
+    ofEvent<int>                        filepathChangedEvent;
 
     string                              specialLinkTypeName;
 
@@ -288,12 +328,36 @@ protected:
     bool                    isTextureObject;
     bool                    isSharedContextObject;
     bool                    isHardwareObject;
+    bool                    isPureObject;       // output depends only on inlets and custom vars ( no time-dependent state )
+    bool                    isThreadSafeObject; // updateObjectContent can run outside the main thread ( no GL, pdsp, hardware or files )
+    bool                    isLockFreeAudioObject; // audio object sharing state with the audio thread only through channels, updated without the audio graph lock
     bool                    isResizable;
-    bool                    willErase;
+    std::atomic<bool>       willErase;          // atomic, read by the audio thread
+    std::mutex              audioStateMutex;    // pdsp external inputs layout, locked by the main thread when resizing it ( try_lock by the audio silence path )
     bool                    initWirelessLink;
     bool                    resetWirelessLink;
     int                     resetWirelessPin;
 
+    // Lazy evaluation vars
+    std::atomic<bool>       needsUpdate;        // atomic, set by upstream objects updating in parallel
+    uint64_t                outletsGeneration[MAX_OUTLETS];
+    uint32_t                outletsLastValue[MAX_OUTLETS];      // numeric outlets value bits at the last update
+
+    // Event timestamps of numeric pins ( sample accurate triggers into audio objects )
+    uint64_t                outletsEventTime[MAX_OUTLETS];
+    uint64_t                outletsEventStamp[MAX_OUTLETS];     // set by the object, applied and cleared on the next value change, 0 = update time
+    uint64_t                inletsEventTime[MAX_INLETS];
+
+    // Events of numeric pins in this frame ( one per bang, added by the object or one per value change )
+    ofxVPEventList<>        outletsEvents[MAX_OUTLETS];
+    ofxVPEventList<>        inletsEvents[MAX_INLETS];
+
+    // Pass-through outlets ( the outlet sends the inlet data, without copying it )
+    int                     outletsForward[MAX_OUTLETS];
+
+    // Profiling ( preallocated update/draw/audio timings )
+    ofxVPObjectTimings      timings;
+
 };
 
 // PUGG driver class
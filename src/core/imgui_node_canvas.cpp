@@ -1084,6 +1084,7 @@ ImGuiEx::NodeConnectData ImGuiEx::NodeCanvas::AddNodePin( const int nodeID, cons
                                 std::vector<int>::iterator it = std::find(deactivated_links.begin(), deactivated_links.end(),_linksData.at(i)._linkID);
                                 if (it!=deactivated_links.end()){
                                     deactivated_links.erase(it);
+                                    deactivated_links_version++;
                                 }
                             }
 
@@ -1182,10 +1183,12 @@ ImGuiEx::NodeConnectData ImGuiEx::NodeCanvas::AddNodePin( const int nodeID, cons
                         // deactivate if activated
                         if (std::find(deactivated_links.begin(), deactivated_links.end(),_linksData.at(i)._linkID)==deactivated_links.end()){
                             deactivated_links.push_back(_linksData.at(i)._linkID);
+                            deactivated_links_version++;
                         }else{ // else the opposite
                             std::vector<int>::iterator it = std::find(deactivated_links.begin(), deactivated_links.end(),_linksData.at(i)._linkID);
                             if (it!=deactivated_links.end()){
                                 deactivated_links.erase(it);
+                                deactivated_links_version++;
                             }
                         }
                     }
@@ -384,8 +384,9 @@ struct NodeCanvas {
     // Returns selected links
     std::vector<int> getSelectedLinks(){ return selected_links; }
 
-    // Returns deactivated links
-    std::vector<int> getDeactivatedLinks(){ return deactivated_links; }
+    // Returns deactivated links ( the version changes on every change of the list )
+    const std::vector<int>& getDeactivatedLinks() const { return deactivated_links; }
+    unsigned int getDeactivatedLinksVersion() const { return deactivated_links_version; }
 
     // Returns active node
     int getActiveNode() { return activeNode; }
@@ -476,6 +477,7 @@ private:
     std::map<int,NodeInfo> existingNodes;
     std::vector<int> selected_links; // for delete links (one or multiple)
     std::vector<int> deactivated_links; // for activating/deactivating links (one or multiple)
+    unsigned int deactivated_links_version = 0;
     NodeInfo* hoveredNode       = nullptr; // Hovered node
     NodeInfo* interactedNode    = nullptr; // Node under interaction
     std::string activePin;
@@ -9,6 +9,8 @@
 #include <map>
 #include <chrono>
 #include <cstdint>
+#include <cstdio>
+#include <functional>
 #include "imgui.h"
 
 #define RGBA_LE(col) (((col & 0xff000000) >> (3 * 8)) + ((col & 0x00ff0000) >> (1 * 8)) + ((col & 0x0000ff00) << (1 * 8)) + ((col & 0x000000ff) << (3 * 8)))
@@ -74,24 +76,25 @@ public:
     void LoadFrameData(const ProfilerTask* tasks, size_t count)
     {
 
+        // reuse the frame slots, no allocations once every frame has seen the largest task count
         auto &currFrame = frames[currFrameIndex];
-        currFrame.tasks.resize(0);
+        size_t mergedCount = 0;
         for (size_t taskIndex = 0; taskIndex < count; taskIndex++)
         {
-            if (taskIndex == 0)
-                currFrame.tasks.push_back(tasks[taskIndex]);
+            if (taskIndex > 0 && tasks[taskIndex - 1].color == tasks[taskIndex].color && tasks[taskIndex - 1].name == tasks[taskIndex].name)
+            {
+                currFrame.tasks[mergedCount - 1].endTime = tasks[taskIndex].endTime;
+            }
             else
             {
-                if (tasks[taskIndex - 1].color != tasks[taskIndex].color || tasks[taskIndex - 1].name != tasks[taskIndex].name)
-                {
-                    currFrame.tasks.push_back(tasks[taskIndex]);
-                }
+                if (mergedCount < currFrame.tasks.size())
+                    currFrame.tasks[mergedCount] = tasks[taskIndex];
                 else
-                {
-                    currFrame.tasks.back().endTime = tasks[taskIndex].endTime;
-                }
+                    currFrame.tasks.push_back(tasks[taskIndex]);
+                mergedCount++;
             }
         }
+        currFrame.tasks.resize(mergedCount);
         currFrame.taskStatsIndex.resize(currFrame.tasks.size());
 
         for (size_t taskIndex = 0; taskIndex < currFrame.tasks.size(); taskIndex++)
@@ -100,12 +103,12 @@ public:
             auto it = taskNameToStatsIndex.find(task.name);
             if (it == taskNameToStatsIndex.end())
             {
-                taskNameToStatsIndex[task.name] = taskStats.size();
+                it = taskNameToStatsIndex.insert(std::make_pair(task.name, taskStats.size())).first;
                 TaskStats taskStat;
                 taskStat.maxTime = -1.0;
                 taskStats.push_back(taskStat);
             }
-            currFrame.taskStatsIndex[taskIndex] = taskNameToStatsIndex[task.name];
+            currFrame.taskStatsIndex[taskIndex] = it->second;
         }
         currFrameIndex = (currFrameIndex + 1) % frames.size();
 
@@ -147,7 +150,6 @@ private:
                 }
             }
         }
-        std::vector<size_t> statPriorities;
         statPriorities.resize(taskStats.size());
         for(size_t statIndex = 0; statIndex < taskStats.size(); statIndex++)
             statPriorities[statIndex] = statIndex;
@@ -251,12 +253,13 @@ private:
             uint32_t textColor = task.color;
 
             float taskTimeMs = float(task.endTime - task.startTime);
-            std::ostringstream timeText;
-            timeText.precision(2);
-            timeText << std::fixed << std::string("[") << (taskTimeMs * 1000.0f);
+            char timeText[32];
+            snprintf(timeText, sizeof(timeText), "[%.2f", taskTimeMs * 1000.0f);
+            char nameText[256];
+            snprintf(nameText, sizeof(nameText), "ms] %s", task.name.c_str());
 
-            Text(drawList, markerRightRectMax + textMargin, textColor, timeText.str().c_str());
-            Text(drawList, markerRightRectMax + textMargin + glm::vec2(nameOffset, 0.0f), textColor, (std::string("ms] ") + task.name).c_str());
+            Text(drawList, markerRightRectMax + textMargin, textColor, timeText);
+            Text(drawList, markerRightRectMax + textMargin + glm::vec2(nameOffset, 0.0f), textColor, nameText);
         }
 
     }
@@ -305,6 +308,7 @@ private:
     };
 
     std::vector<TaskStats> taskStats;
+    std::vector<size_t> statPriorities;
     std::map<std::string, size_t> taskNameToStatsIndex;
 
     std::vector<FrameData> frames;
@@ -349,18 +353,18 @@ public:
         ImGui::SetNextWindowBgAlpha(0.6f);
         ImGui::SetNextWindowSize(ImVec2(640*scaleFactor,640*scaleFactor), ImGuiCond_Appearing );
 
-        std::stringstream title;
-        title.precision(2);
-        title << std::fixed << "\uf085  Profiler [Rendering at " << 1.0f / avgFrameTime << "fps\t" << avgFrameTime * 1000.0f << "ms]###ProfilerWindow";
+        char title[128];
+        snprintf(title, sizeof(title), "\uf085  Profiler [Rendering at %.2ffps\t%.2fms]###ProfilerWindow", 1.0f / avgFrameTime, avgFrameTime * 1000.0f);
         //###AnimatedTitle
-        ImGui::Begin(title.str().c_str(), active, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse);
+        ImGui::Begin(title, active, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse);
         ImVec2 canvasSize = ImGui::GetContentRegionAvail();
 
         isMouseOver = ImGui::IsWindowHovered(ImGuiHoveredFlags_RootWindow) || ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows);
 
         int sizeMargin = int(ImGui::GetStyle().ItemSpacing.y);
         int maxGraphHeight = 300*scaleFactor;
-        int availableGraphHeight = (int(canvasSize.y) - sizeMargin) / 2;
+        int extraContentHeight = extraContent ? int(180*scaleFactor) : 0;
+        int availableGraphHeight = (int(canvasSize.y) - sizeMargin - extraContentHeight) / 2;
         int graphHeight = std::min(maxGraphHeight, availableGraphHeight);
         int legendWidth = 300*scaleFactor;
         int graphWidth = int(canvasSize.x) - legendWidth;
@@ -385,6 +389,10 @@ public:
         cpuGraph.frameWidth = frameWidth;
         cpuGraph.frameSpacing = frameSpacing;
 
+        // per object timings, drawn by the host
+        if (extraContent)
+            extraContent();
+
         ImGui::End();
     }
 
@@ -404,6 +412,8 @@ public:
     float scaleFactor;
     bool  isMouseOver;
 
+    std::function<void()> extraContent;
+
 };
 
 }
@@ -0,0 +1,438 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#include "ofxVPAnalysisEngine.h"
+
+// pitch detection range, low notes need a window of at least two periods
+static const float pitchMinHz   = 40.0f;
+static const float pitchMaxHz   = 4000.0f;
+
+// YIN absolute threshold, MPM key maximum ratio, voiced frames confidence
+static const float yinThreshold = 0.15f;
+static const float mpmCutoff    = 0.93f;
+static const float voicedLevel  = 0.5f;
+
+static const int melBandsEdges[MEL_SCALE_CRITICAL_BANDS] = {100,200,300,400,510,630,770,920,1080,1270,1480,1720,2000,2320,2700,3150,3700,4400,5300,6400,7700,9500,12000,20000};
+
+//--------------------------------------------------------------
+ofxVPAnalysisEngine::ofxVPAnalysisEngine(){
+    fft                     = nullptr;
+    acFft                   = nullptr;
+    beatTrack               = nullptr;
+
+    windowSize              = 0;
+    hopSize                 = 0;
+    sampleRate              = 0;
+    fftBinSize              = 0;
+    acBinSize               = 0;
+    fft_binSizeHz           = 0.0f;
+    fft_StrongestBinIndex   = 0;
+
+    rms                     = 0.0f;
+    for(int d=0;d<Pitch_Detector_COUNT;d++){
+        pitch[d]            = 0.0f;
+        pitchConfidence[d]  = 0.0f;
+    }
+    bpm                     = 0.0f;
+
+    lastBlock               = std::numeric_limits<uint64_t>::max();
+    frameCount              = 0;
+    beatCount               = 0;
+}
+
+//--------------------------------------------------------------
+ofxVPAnalysisEngine::~ofxVPAnalysisEngine(){
+    delete fft;
+    delete acFft;
+    delete beatTrack;
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::setup(int window, int hop, int sr){
+    windowSize  = window;
+    hopSize     = hop;
+    sampleRate  = sr;
+    reblocker.setup(windowSize,hopSize);
+
+    // Beat Tracking
+    beatTrack = new ofxBTrack();
+    beatTrack->setup(hopSize);
+    beatTrack->setConfidentThreshold(0.35);
+
+    // Audio Analysis
+    fft = ofxFft::create(windowSize, OF_FFT_WINDOW_HAMMING);
+
+    fftBinSize              = fft->getBinSize();
+    fft_binSizeHz           = static_cast<float>(sampleRate)/2.0f/(fftBinSize-1);
+    fft_StrongestBinIndex   = 0;
+
+    // linear ( not circular ) autocorrelation, signal zero padded to twice the window
+    acFft                   = ofxFft::create(windowSize*2, OF_FFT_WINDOW_RECTANGULAR);
+    acBinSize               = acFft->getBinSize();
+
+    signalFrame.assign(windowSize,0.0f);
+    autoCorrelation.assign(windowSize,0.0f);
+    autoCorrelationNorm.assign(windowSize,0.0f);
+    energyPrefix.assign(windowSize+1,0.0);
+    yinBuffer.assign(windowSize/2+1,1.0f);
+    nsdf.assign(windowSize/2+1,0.0f);
+    acInput.assign(windowSize*2,0.0f);
+    acPower.assign(acBinSize,0.0f);
+    acZeros.assign(acBinSize,0.0f);
+    spectrum.assign(fftBinSize,0.0f);
+    binsToMel.assign(fftBinSize,-1);
+    melBins.assign(MEL_SCALE_CRITICAL_BANDS,0.0f);
+
+    setupMelScale();
+
+    features.setup(fftBinSize,fft_binSizeHz);
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::process(const ofSoundBuffer &buffer, uint64_t block){
+    // already computed in this block ( by another analyzer on the same source )
+    if(block == lastBlock || windowSize == 0) return;
+    lastBlock = block;
+
+    if(buffer.getBuffer().empty()) return;
+
+    buffer.getChannel(monoBuffer,0);
+
+    // re-block the device buffers, one analysis every hop ( any device buffer size )
+    reblocker.process(monoBuffer.getBuffer().data(),monoBuffer.getNumFrames(),[this](const float *frame){ analyzeFrame(frame); });
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::analyzeFrame(const float *frame){
+
+    // SIGNAL BUFFER
+    memcpy(signalFrame.data(), frame, windowSize * sizeof(float));
+
+    // autocorrelation + normalization ( FFT based, O(N log N) )
+    doAutoCorrelation(signalFrame.data());
+
+    // get volume
+    rms = ofxVPDsp::rms(signalFrame.data(),windowSize);
+
+    // FFT Analyze Audio
+    fft->setSignal(signalFrame.data());
+    memcpy(spectrum.data(), fft->getAmplitude(), sizeof(float) * fftBinSize);
+
+    // storing strongest bin for pitch detection
+    float strongestBinValue = 0.0f;
+    for(int i = 0; i < fftBinSize; i++){
+        if(spectrum[i] > strongestBinValue){
+            strongestBinValue       = spectrum[i];
+            fft_StrongestBinIndex   = i;
+        }
+    }
+
+    // calculate Mel scale bins from fft bins
+    melMatrix.apply(spectrum.data(),melBins.data());
+
+    // spectral features, mfcc and chroma ( one pass over the spectrum )
+    features.process(spectrum.data(),melBins.data());
+
+    // get pitch
+    detectPitch();
+
+    // BTrack (BPM and Beat tracker), fed with the new samples of this hop
+    beatTrack->audioIn(signalFrame.data() + windowSize - hopSize, hopSize, 1);
+    bpm = beatTrack->getEstimatedBPM();
+    if(beatTrack->hasBeat()){
+        beatCount++;
+    }
+
+    frameCount++;
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::doAutoCorrelation(const float *signal){
+
+    // r = IFFT(|FFT(x)|^2), x zero padded to 2N so the lags do not wrap around
+    memcpy(acInput.data(), signal, windowSize * sizeof(float));
+    memset(acInput.data() + windowSize, 0, windowSize * sizeof(float));
+
+    acFft->setSignal(acInput.data());
+    ofxVPDsp::power(acFft->getReal(), acFft->getImaginary(), acPower.data(), acBinSize);
+    acFft->setCartesian(acPower.data(), acZeros.data());
+
+    const float *r = acFft->getSignal();
+
+    // r[0] is the signal energy, rescale to it ( independent from the FFT normalization )
+    float energy = ofxVPDsp::dot(signal, signal, windowSize);
+    if(r[0] > 0.0f && energy > 0.0f){
+        ofxVPDsp::scale(r, autoCorrelation.data(), energy/r[0], windowSize);
+    }else{
+        std::fill(autoCorrelation.begin(),autoCorrelation.end(),0.0f);
+    }
+
+    float maxValue = ofxVPDsp::peak(autoCorrelation.data(), windowSize);
+
+    if (maxValue > 0){
+        ofxVPDsp::scale(autoCorrelation.data(), autoCorrelationNorm.data(), 1.0f/maxValue, windowSize);
+    }else{
+        autoCorrelationNorm = autoCorrelation;
+    }
+
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::detectPitch(){
+    // lags up to half the window, both halves of the difference functions overlap enough
+    int minLag = std::max(2,static_cast<int>(sampleRate/pitchMaxHz));
+    int maxLag = std::min(windowSize/2-1,static_cast<int>(sampleRate/pitchMinHz));
+    if(maxLag <= minLag) return;
+
+    // m(t) = sum x[j]^2 + x[j+t]^2 ( j < N-t ), from the running sum of x^2
+    energyPrefix[0] = 0.0;
+    for(int i=0;i<windowSize;i++){
+        energyPrefix[i+1] = energyPrefix[i] + static_cast<double>(signalFrame[i])*signalFrame[i];
+    }
+
+    detectPitchYIN(minLag,maxLag);
+    detectPitchMPM(minLag,maxLag);
+    detectPitchAutoCorrelation(minLag,maxLag);
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::detectPitchYIN(int minLag, int maxLag){
+    // difference function d(t) = m(t) - 2r(t) per overlapping sample, cumulative mean normalized
+    double runningSum = 0.0;
+    yinBuffer[0] = 1.0f;
+    for(int t=1;t<=maxLag+1;t++){
+        double m = energyPrefix[windowSize-t] + (energyPrefix[windowSize] - energyPrefix[t]);
+        double d = std::max(0.0,m - 2.0*autoCorrelation[t]) / (windowSize-t);
+        runningSum += d;
+        yinBuffer[t] = runningSum > 0.0 ? static_cast<float>(d*t/runningSum) : 1.0f;
+    }
+
+    // first dip under the threshold ( its local minimum ), or the global minimum
+    int lag = -1;
+    for(int t=minLag;t<=maxLag;t++){
+        if(yinBuffer[t] < yinThreshold){
+            while(t+1 <= maxLag && yinBuffer[t+1] < yinBuffer[t]) t++;
+            lag = t;
+            break;
+        }
+    }
+    if(lag < 0){
+        lag = minLag;
+        for(int t=minLag+1;t<=maxLag;t++){
+            if(yinBuffer[t] < yinBuffer[lag]) lag = t;
+        }
+    }
+
+    // still going down at the end of the range, the period is longer than half the window
+    if(lag >= maxLag){
+        pitchConfidence[Pitch_Detector_YIN] = 0.0f;
+        return;
+    }
+
+    // parabolic interpolation around the minimum
+    float a = yinBuffer[lag-1], b = yinBuffer[lag], c = yinBuffer[lag+1];
+    float den = a - 2.0f*b + c;
+    float delta = den != 0.0f ? ofClamp(0.5f*(a - c)/den,-1.0f,1.0f) : 0.0f;
+
+    setPitch(Pitch_Detector_YIN,lag + delta,ofClamp(1.0f - b,0.0f,1.0f));
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::detectPitchMPM(int minLag, int maxLag){
+    // normalized square difference n(t) = 2r(t)/m(t), in [-1,1]
+    for(int t=0;t<=maxLag+1;t++){
+        double m = energyPrefix[windowSize-t] + (energyPrefix[windowSize] - energyPrefix[t]);
+        nsdf[t] = m > 0.0 ? static_cast<float>(2.0*autoCorrelation[t]/m) : 0.0f;
+    }
+
+    // key maxima: the highest point of every positive region after the first zero crossing
+    int t = 1;
+    while(t <= maxLag && nsdf[t] > 0.0f) t++;
+    t = std::max(t,minLag);
+
+    int   keyLags[64];
+    int   numKeys   = 0;
+    float highest   = 0.0f;
+    while(t <= maxLag && numKeys < 64){
+        while(t <= maxLag && nsdf[t] <= 0.0f) t++;
+        int best = -1;
+        while(t <= maxLag && nsdf[t] > 0.0f){
+            if(best < 0 || nsdf[t] > nsdf[best]) best = t;
+            t++;
+        }
+        // a region cut by the end of the range has no maximum
+        if(best > 0 && best < maxLag){
+            keyLags[numKeys++] = best;
+            highest = std::max(highest,nsdf[best]);
+        }
+    }
+
+    // first key maximum close to the highest one ( avoids picking a multiple of the period )
+    int lag = -1;
+    for(int k=0;k<numKeys;k++){
+        if(nsdf[keyLags[k]] >= mpmCutoff*highest){
+            lag = keyLags[k];
+            break;
+        }
+    }
+    if(lag < 0){
+        pitchConfidence[Pitch_Detector_MPM] = 0.0f;
+        return;
+    }
+
+    float a = nsdf[lag-1], b = nsdf[lag], c = nsdf[lag+1];
+    float den = a - 2.0f*b + c;
+    float delta = den != 0.0f ? ofClamp(0.5f*(a - c)/den,-1.0f,1.0f) : 0.0f;
+    // peak height of the interpolated parabola is the clarity
+    float clarity = b - 0.25f*(a - c)*delta;
+
+    setPitch(Pitch_Detector_MPM,lag + delta,ofClamp(clarity,0.0f,1.0f));
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::detectPitchAutoCorrelation(int minLag, int maxLag){
+    // highest autocorrelation peak after the first zero crossing
+    int lag = 1;
+    while(lag < maxLag && autoCorrelationNorm[lag] > 0.0f) lag++;
+    lag = std::max(lag,minLag);
+
+    int   peakLag   = 0;
+    float peakValue = 0.0f;
+    for(int i=lag;i<=maxLag;i++){
+        if(autoCorrelationNorm[i] > peakValue){
+            peakValue   = autoCorrelationNorm[i];
+            peakLag     = i;
+        }
+    }
+
+    if(peakLag > 0 && peakValue > voicedLevel){
+        // parabolic interpolation around the peak
+        float a = autoCorrelationNorm[peakLag-1];
+        float b = autoCorrelationNorm[peakLag];
+        float c = autoCorrelationNorm[peakLag+1];
+        float den = a - 2.0f*b + c;
+        float delta = den != 0.0f ? 0.5f*(a - c)/den : 0.0f;
+        setPitch(Pitch_Detector_AUTOCORRELATION,peakLag + delta,ofClamp(peakValue,0.0f,1.0f));
+    }else{
+        // unvoiced/noisy frame, strongest fft bin
+        pitch[Pitch_Detector_AUTOCORRELATION]            = (fft_StrongestBinIndex*fft_binSizeHz) + (fft_binSizeHz/2.0f);
+        pitchConfidence[Pitch_Detector_AUTOCORRELATION]  = ofClamp(peakValue,0.0f,1.0f);
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::setPitch(int detector, float lag, float confidence){
+    pitchConfidence[detector] = confidence;
+    // unvoiced frames keep the last pitch ( no jumps between notes )
+    if(confidence >= voicedLevel && lag > 0.0f){
+        pitch[detector] = static_cast<float>(sampleRate) / lag;
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisEngine::setupMelScale(){
+    // setup Mel scale reduction (it depends on samplerate and buffersize)
+    // first bin is the 0 Hz component (a constant DC offset to the signal), we do not consider it
+    int tempFreq = 0;
+    for(unsigned int j=0;j<MEL_SCALE_CRITICAL_BANDS-1;j++){
+        for(int i = 0; i < fftBinSize; i++){
+            tempFreq = (int)((i*fft_binSizeHz) + (fft_binSizeHz/2.0f));
+            if(j == 0){
+                if(tempFreq <= melBandsEdges[j]){
+                    binsToMel[i] = j;
+                }else{
+                    i = fftBinSize;
+                }
+            }else if(j > 0){
+                if(tempFreq > melBandsEdges[j-1] && tempFreq <= melBandsEdges[j]){
+                    binsToMel[i] = j;
+                }
+            }
+        }
+    }
+    binsToMel[fftBinSize-1] = 23;
+
+    // every band is a contiguous run of bins, store it as a banded sparse matrix
+    vector<float> ones(fftBinSize,1.0f);
+    melMatrix.clear(MEL_SCALE_CRITICAL_BANDS-1);
+    for(int j=0;j<MEL_SCALE_CRITICAL_BANDS-1;j++){
+        int first = -1, last = -1;
+        for(int i = 0; i < fftBinSize; i++){
+            if(binsToMel[i] == j){
+                if(first < 0) first = i;
+                last = i;
+            }
+        }
+        if(first >= 0){
+            melMatrix.setRow(j,first,ones.data(),last-first+1);
+        }
+    }
+}
+
+//--------------------------------------------------------------
+std::shared_ptr<ofxVPAnalysisEngine> ofxVPAnalysisService::acquire(const void *source, int window, int hop, int sampleRate){
+    std::lock_guard<std::mutex> lock(mutex);
+
+    collect();
+
+    Key key = { source, window, hop, sampleRate };
+    auto it = engines.find(key);
+    if(it != engines.end()){
+        return it->second;
+    }
+
+    std::shared_ptr<ofxVPAnalysisEngine> engine = std::make_shared<ofxVPAnalysisEngine>();
+    engine->setup(window,hop,sampleRate);
+    engines[key] = engine;
+
+    ofLog(OF_LOG_NOTICE,"Shared audio analysis engine created: window %i, hop %i ( %i engines )",window,hop,static_cast<int>(engines.size()));
+
+    return engine;
+}
+
+//--------------------------------------------------------------
+size_t ofxVPAnalysisService::getNumEngines(){
+    std::lock_guard<std::mutex> lock(mutex);
+    return engines.size();
+}
+
+//--------------------------------------------------------------
+void ofxVPAnalysisService::collect(){
+    for(auto it = engines.begin(); it != engines.end();){
+        if(it->second.use_count() == 1){
+            it = engines.erase(it);
+        }else{
+            ++it;
+        }
+    }
+}
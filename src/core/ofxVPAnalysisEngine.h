@@ -0,0 +1,180 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxFft.h"
+#include "ofxBTrack.h"
+
+#include "ofxVPConfig.h"
+#include "ofxVPAudioReblocker.h"
+#include "ofxVPAudioFeatures.h"
+#include "ofxVPDspKernels.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+enum Pitch_Detector { Pitch_Detector_YIN, Pitch_Detector_MPM, Pitch_Detector_AUTOCORRELATION, Pitch_Detector_COUNT };
+
+// Shared audio analysis engine
+//
+// The analysis of one audio source ( an audio outlet ) with one window/hop setting:
+// re-blocking, FFT, autocorrelation, mel bands, spectral features, rms, pitch and beat tracking, at unity gain
+// and without smoothing ( gain and smoothing are applied by every analyzer on its own copy ).
+// process() computes once per audio block, the first caller does the work and the others
+// read the same results, so N analyzers listening to the same mic cost one analysis.
+// Every pitch detector runs on the same FFT autocorrelation ( O(N) each after it ), so the
+// analyzers sharing an engine can still choose their own.
+class ofxVPAnalysisEngine {
+
+public:
+
+    ofxVPAnalysisEngine();
+    ~ofxVPAnalysisEngine();
+
+    // not in the audio thread ( allocates )
+    void            setup(int window, int hop, int sr);
+
+    // ---- this code runs in the audio thread ----
+    void            process(const ofSoundBuffer &buffer, uint64_t block);
+
+    const float*    getSignal() const { return signalFrame.data(); }
+    const float*    getSpectrum() const { return spectrum.data(); }
+    const float*    getMelBands() const { return melBins.data(); }
+    const float*    getAutoCorrelation() const { return autoCorrelation.data(); }
+    float           getRMS() const { return rms; }
+    float           getPitch(int detector) const { return pitch[detector]; }
+    float           getPitchConfidence(int detector) const { return pitchConfidence[detector]; }
+    float           getBPM() const { return bpm; }
+    const ofxVPAudioFeatures& getFeatures() const { return features; }
+    uint64_t        getFrameCount() const { return frameCount; }
+    uint64_t        getBeatCount() const { return beatCount; }
+    // ---- end of audio thread code ----
+
+    int             getWindowSize() const { return windowSize; }
+    int             getHopSize() const { return hopSize; }
+    int             getBinSize() const { return fftBinSize; }
+    int             getSampleRate() const { return sampleRate; }
+
+protected:
+
+    void            analyzeFrame(const float *frame);
+    void            doAutoCorrelation(const float *signal);
+    void            detectPitch();
+    void            detectPitchYIN(int minLag, int maxLag);
+    void            detectPitchMPM(int minLag, int maxLag);
+    void            detectPitchAutoCorrelation(int minLag, int maxLag);
+    void            setPitch(int detector, float lag, float confidence);
+    void            setupMelScale();
+
+    ofxVPAudioReblocker     reblocker;
+    ofSoundBuffer           monoBuffer;
+
+    ofxFft                  *fft;
+    ofxFft                  *acFft;         // 2x window, zero padded autocorrelation
+    ofxBTrack               *beatTrack;
+
+    vector<float>           signalFrame;
+    vector<float>           spectrum;
+    vector<float>           melBins;
+    vector<float>           autoCorrelation;
+    vector<float>           autoCorrelationNorm;
+    vector<double>          energyPrefix;   // running sum of x^2, for the difference functions
+    vector<float>           yinBuffer;      // cumulative mean normalized difference
+    vector<float>           nsdf;           // normalized square difference
+    vector<float>           acInput;
+    vector<float>           acPower;
+    vector<float>           acZeros;
+    vector<int>             binsToMel;
+    ofxVPBandMatrix         melMatrix;      // fft bins --> mel bands
+    ofxVPAudioFeatures      features;
+
+    int                     windowSize;
+    int                     hopSize;
+    int                     sampleRate;
+    int                     fftBinSize;
+    int                     acBinSize;
+    float                   fft_binSizeHz;
+    int                     fft_StrongestBinIndex;
+
+    float                   rms;
+    float                   pitch[Pitch_Detector_COUNT];
+    float                   pitchConfidence[Pitch_Detector_COUNT];
+    float                   bpm;
+
+    uint64_t                lastBlock;
+    uint64_t                frameCount;
+    uint64_t                beatCount;
+
+};
+
+// Shared analysis engines, keyed by ( source, window, hop, sample rate )
+class ofxVPAnalysisService {
+
+public:
+
+    // main thread, the engine for this source and settings ( created on first request )
+    std::shared_ptr<ofxVPAnalysisEngine>    acquire(const void *source, int window, int hop, int sampleRate);
+
+    size_t      getNumEngines();
+
+protected:
+
+    struct Key {
+        const void  *source;
+        int         window;
+        int         hop;
+        int         sampleRate;
+
+        bool operator<(const Key &k) const {
+            return std::tie(source,window,hop,sampleRate) < std::tie(k.source,k.window,k.hop,k.sampleRate);
+        }
+    };
+
+    // drop the engines nobody is using anymore ( the service holds the last reference )
+    void        collect();
+
+    std::mutex                                          mutex;
+    std::map<Key,std::shared_ptr<ofxVPAnalysisEngine>>  engines;
+
+};
+
+// getter singleton
+inline ofxVPAnalysisService& getAnalysisService(){
+    static ofxVPAnalysisService singletonAnalysisService;
+    return singletonAnalysisService;
+}
@@ -0,0 +1,118 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+// Read-only view on a contiguous float array
+struct ofxVPFloatSpan {
+    const float     *data;
+    size_t          size;
+
+    const float&    operator[](size_t i) const { return data[i]; }
+    const float*    begin() const { return data; }
+    const float*    end() const { return data + size; }
+    bool            empty() const { return size == 0; }
+};
+
+// Structured audio analysis frame ( audio analyzer --> extractors )
+//
+// Named views on the analyzer packed data outlet, plus the single values. The spans are
+// valid until the next analyzer update, extractors read them in their own update ( after
+// the analyzer in the execution plan ) without copying, and skip the work when the
+// sequence number did not change ( no new analysis from the audio thread ).
+struct ofxVPAnalysisFrame {
+    uint64_t            sequence;
+    int                 windowSize;
+    int                 sampleRate;
+
+    ofxVPFloatSpan      signal;
+    ofxVPFloatSpan      spectrum;
+    ofxVPFloatSpan      melBands;
+
+    float               rms;
+    float               pitch;
+    float               pitchConfidence;
+    float               bpm;
+    float               beat;
+
+    float               centroid;
+    float               flatness;
+    float               flux;
+    float               rolloff;
+    float               onset;
+    ofxVPFloatSpan      mfcc;
+    ofxVPFloatSpan      chroma;
+};
+
+// Analysis frames by outlet data
+//
+// The analyzer registers its frame with the data pointer of its outlet, the one the links
+// copy to the connected inlets, so an extractor finds the frame from its own inlet data
+// ( no patch map scan, no object name checks ). Extractors look it up only when the inlet
+// data pointer changes.
+class ofxVPAnalysisRegistry {
+
+public:
+
+    void                        add(const void *outletData, const ofxVPAnalysisFrame *frame){
+        std::unique_lock<std::mutex> lck(mutex);
+        frames[outletData] = frame;
+    }
+
+    void                        remove(const void *outletData){
+        std::unique_lock<std::mutex> lck(mutex);
+        frames.erase(outletData);
+    }
+
+    const ofxVPAnalysisFrame*   find(const void *inletData){
+        std::unique_lock<std::mutex> lck(mutex);
+        std::map<const void*,const ofxVPAnalysisFrame*>::iterator it = frames.find(inletData);
+        return it != frames.end() ? it->second : nullptr;
+    }
+
+protected:
+
+    std::mutex                                          mutex;
+    std::map<const void*,const ofxVPAnalysisFrame*>     frames;
+
+};
+
+// getter singleton
+inline ofxVPAnalysisRegistry& getAnalysisRegistry(){
+    static ofxVPAnalysisRegistry singletonAnalysisRegistry;
+    return singletonAnalysisRegistry;
+}
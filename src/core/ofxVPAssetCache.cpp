@@ -0,0 +1,104 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofxVPAssetCache.h"
+
+//--------------------------------------------------------------
+void ofxVPAssetCache::prefetch(const std::string& path){
+    // only the assets types consumed from the cache ( never read other files just to warm the OS cache )
+    if(!isPrefetchable(path)) return;
+
+    {
+        std::unique_lock<std::mutex> lck(cacheMutex);
+        if(pending.find(path) != pending.end() || pixelsCache.find(path) != pixelsCache.end()){
+            return;
+        }
+        pending.insert(path);
+    }
+
+    getTaskPool().submit([this,path]{ loadAsset(path); });
+}
+
+//--------------------------------------------------------------
+bool ofxVPAssetCache::takePixels(const std::string& path, ofPixels &pixels){
+    std::unique_lock<std::mutex> lck(cacheMutex);
+
+    // if the asset is still decoding, wait for it instead of decoding it twice
+    cacheCondition.wait(lck, [this,&path]{ return pending.find(path) == pending.end(); });
+
+    std::map<std::string,ofPixels>::iterator it = pixelsCache.find(path);
+    if(it != pixelsCache.end()){
+        pixels = std::move(it->second);
+        pixelsCache.erase(it);
+        return true;
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------
+void ofxVPAssetCache::clear(){
+    std::unique_lock<std::mutex> lck(cacheMutex);
+    pixelsCache.clear();
+}
+
+//--------------------------------------------------------------
+bool ofxVPAssetCache::isImageFile(const std::string& path){
+    std::string ext = ofToLower(ofFilePath::getFileExt(path));
+    return ext == "jpg" || ext == "jpeg" || ext == "png" || ext == "gif" || ext == "tif" || ext == "tiff";
+}
+
+//--------------------------------------------------------------
+bool ofxVPAssetCache::isPrefetchable(const std::string& path){
+    return isImageFile(path);
+}
+
+//--------------------------------------------------------------
+void ofxVPAssetCache::loadAsset(const std::string& path){
+    ofFile file(path);
+
+    if(file.exists() && !file.isDirectory()){
+        ofPixels pixels;
+        if(ofLoadImage(pixels,path)){
+            std::unique_lock<std::mutex> lck(cacheMutex);
+            pixelsCache[path] = std::move(pixels);
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lck(cacheMutex);
+        pending.erase(path);
+    }
+    cacheCondition.notify_all();
+
+    ofLog(OF_LOG_VERBOSE,"Prefetched asset: %s",path.c_str());
+}
@@ -0,0 +1,77 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxVPTaskPool.h"
+
+#include <condition_variable>
+#include <mutex>
+
+// Patch assets prefetched on the task pool while a patch is loading
+//
+// Only the asset types that objects take back from the cache are prefetched ( isPrefetchable() ):
+// images, decoded to ofPixels ( the texture upload stays on the main thread ). Other files
+// ( videos, sound files, exporters outputs ) are left alone and loaded by their objects.
+// Decoded assets are consumed once, by the first object asking for them.
+class ofxVPAssetCache {
+
+public:
+
+    ofxVPAssetCache() {}
+    ~ofxVPAssetCache() {}
+
+    void                    prefetch(const std::string& path);
+    bool                    takePixels(const std::string& path, ofPixels &pixels);
+    void                    clear();
+
+    static bool             isImageFile(const std::string& path);
+    static bool             isPrefetchable(const std::string& path);
+
+protected:
+
+    void                    loadAsset(const std::string& path);
+
+    std::mutex                          cacheMutex;
+    std::condition_variable             cacheCondition;
+    std::set<std::string>               pending;
+    std::map<std::string,ofPixels>      pixelsCache;
+
+};
+
+// getter singleton
+inline ofxVPAssetCache& getAssetCache(){
+    static ofxVPAssetCache singletonAssetCache;
+    return singletonAssetCache;
+}
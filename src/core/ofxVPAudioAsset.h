@@ -0,0 +1,103 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Asset handed over to the audio thread, released on the main thread
+//
+// The main thread loads a new asset ( sample buffer, decoded sound file ) off the audio
+// lock and publish()es it, the audio thread picks it up with acquire() at the beginning
+// of the block. The replaced assets are kept alive in a retired list until the audio
+// thread has adopted a newer one, then collect() frees them on the main thread: the
+// audio thread never waits, allocates or frees.
+template<typename T>
+class ofxVPAudioAsset {
+
+public:
+
+    ofxVPAudioAsset() : latest(nullptr), publishedGeneration(0), adoptedGeneration(0), audioAsset(nullptr), audioGeneration(0) {}
+
+    // main thread
+    void        publish(std::shared_ptr<T> asset){
+        uint64_t generation = publishedGeneration.load(std::memory_order_relaxed) + 1;
+        if(current != nullptr){
+            retired.push_back(std::make_pair(generation,current));
+        }
+        current = asset;
+        latest.store(current.get(),std::memory_order_relaxed);
+        publishedGeneration.store(generation,std::memory_order_release);
+        collect();
+    }
+    void        collect(){
+        uint64_t adopted = adoptedGeneration.load(std::memory_order_acquire);
+        for(size_t i=0;i<retired.size();){
+            if(retired[i].first <= adopted){
+                retired.erase(retired.begin()+i);
+            }else{
+                i++;
+            }
+        }
+    }
+    std::shared_ptr<T>  get() const { return current; }
+
+    // audio thread, the asset to use for the whole block ( nullptr if none )
+    T*          acquire(){
+        uint64_t generation = publishedGeneration.load(std::memory_order_acquire);
+        if(generation != audioGeneration){
+            audioAsset = latest.load(std::memory_order_relaxed);
+            audioGeneration = generation;
+            adoptedGeneration.store(generation,std::memory_order_release);
+        }
+        return audioAsset;
+    }
+
+protected:
+
+    // main thread
+    std::shared_ptr<T>                                  current;
+    std::vector<std::pair<uint64_t,std::shared_ptr<T>>> retired;    // replaced assets, with the generation that replaced them
+
+    std::atomic<T*>                                     latest;
+    std::atomic<uint64_t>                               publishedGeneration;
+    std::atomic<uint64_t>                               adoptedGeneration;
+
+    // audio thread
+    T*                                                  audioAsset;
+    uint64_t                                            audioGeneration;
+
+};
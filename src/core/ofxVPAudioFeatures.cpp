@@ -0,0 +1,163 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#include "ofxVPAudioFeatures.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+//--------------------------------------------------------------
+// log2 approximation ( exponent bits + quadratic mantissa, ~0.005 error ), x > 0
+static inline float approxLog2(float x){
+    int bits;
+    memcpy(&bits,&x,sizeof(float));
+    float e = static_cast<float>(((bits >> 23) & 0xFF) - 128);
+    bits = (bits & ~(0xFF << 23)) | (127 << 23);
+    float m;
+    memcpy(&m,&bits,sizeof(float));
+    return e + ((-1.0f/3.0f)*m + 2.0f)*m - 2.0f/3.0f;
+}
+
+//--------------------------------------------------------------
+ofxVPAudioFeatures::ofxVPAudioFeatures(){
+    binSize     = 0;
+    binSizeHz   = 0.0f;
+
+    centroid    = 0.0f;
+    flatness    = 0.0f;
+    flux        = 0.0f;
+    fluxMean    = 0.0f;
+    rolloff     = 0.0f;
+    onset       = 0.0f;
+}
+
+//--------------------------------------------------------------
+void ofxVPAudioFeatures::setup(int bins, float hz){
+    binSize     = bins;
+    binSizeHz   = hz;
+
+    previous.assign(binSize,0.0f);
+    cumulative.assign(binSize,0.0f);
+    logMel.assign(MEL_SCALE_CRITICAL_BANDS-1,0.0f);
+    mfcc.assign(MFCC_COEFFICIENTS,0.0f);
+    chroma.assign(CHROMA_BANDS,0.0f);
+
+    // pitch class of every bin, from A0 to 5KHz ( C = 0, A4 = 440Hz )
+    binsToChroma.assign(binSize,-1);
+    for(int i=1;i<binSize;i++){
+        float freq = i*binSizeHz;
+        if(freq >= 27.5f && freq <= 5000.0f){
+            int semitone = static_cast<int>(std::lround(12.0f*std::log2(freq/440.0f))) + 9;
+            binsToChroma[i] = ((semitone % CHROMA_BANDS) + CHROMA_BANDS) % CHROMA_BANDS;
+        }
+    }
+
+    // orthonormal DCT-II of the log mel bands
+    const int bands = MEL_SCALE_CRITICAL_BANDS-1;
+    const float pi  = static_cast<float>(std::acos(-1.0));
+    dct.assign(MFCC_COEFFICIENTS*bands,0.0f);
+    for(int k=0;k<MFCC_COEFFICIENTS;k++){
+        float norm = k == 0 ? std::sqrt(1.0f/bands) : std::sqrt(2.0f/bands);
+        for(int j=0;j<bands;j++){
+            dct[k*bands+j] = norm*std::cos(pi/bands*(j+0.5f)*k);
+        }
+    }
+
+    fluxMean    = 0.0f;
+}
+
+//--------------------------------------------------------------
+void ofxVPAudioFeatures::process(const float *spectrum, const float *melBands){
+    if(binSize < 2) return;
+
+    float sum       = 0.0f;
+    float weighted  = 0.0f;
+    float logSum    = 0.0f;
+    float diffSum   = 0.0f;
+
+    std::fill(chroma.begin(),chroma.end(),0.0f);
+
+    // one pass over the spectrum, the first bin ( DC ) is not considered
+    for(int i=1;i<binSize;i++){
+        float m = spectrum[i];
+
+        sum         += m;
+        cumulative[i] = sum;
+        weighted    += m*i;
+        logSum      += approxLog2(m + 1e-10f);
+
+        float d = m - previous[i];
+        diffSum     += d > 0.0f ? d : 0.0f;
+        previous[i] = m;
+
+        int c = binsToChroma[i];
+        if(c >= 0) chroma[c] += m*m;
+    }
+
+    const float n = static_cast<float>(binSize-1);
+
+    if(sum > 0.0f){
+        centroid    = weighted/sum*binSizeHz;
+        // geometric mean / arithmetic mean
+        flatness    = std::min(1.0f,std::exp2(logSum/n)/(sum/n));
+        // first bin over the 85% of the running sum
+        int bin     = static_cast<int>(std::lower_bound(cumulative.begin()+1,cumulative.end(),0.85f*sum) - cumulative.begin());
+        rolloff     = std::min(bin,binSize-1)*binSizeHz;
+    }else{
+        centroid    = 0.0f;
+        flatness    = 0.0f;
+        rolloff     = 0.0f;
+    }
+
+    // half wave rectified flux, onset is the flux over its running mean
+    flux        = diffSum/n;
+    onset       = std::max(0.0f,flux - fluxMean);
+    fluxMean    = fluxMean*0.9f + flux*0.1f;
+
+    float chromaMax = *std::max_element(chroma.begin(),chroma.end());
+    if(chromaMax > 0.0f){
+        for(int c=0;c<CHROMA_BANDS;c++){
+            chroma[c] /= chromaMax;
+        }
+    }
+
+    // MFCC, DCT of the log mel bands
+    const int bands = MEL_SCALE_CRITICAL_BANDS-1;
+    for(int j=0;j<bands;j++){
+        logMel[j] = std::log(melBands[j] + 1e-6f);
+    }
+    for(int k=0;k<MFCC_COEFFICIENTS;k++){
+        mfcc[k] = ofxVPDsp::dot(dct.data()+k*bands,logMel.data(),bands);
+    }
+}
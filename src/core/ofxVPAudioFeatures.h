@@ -0,0 +1,89 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#pragma once
+
+#include "ofxVPConfig.h"
+#include "ofxVPDspKernels.h"
+
+#include <vector>
+
+// Spectral features of an analysis frame ( MIR descriptors for audio reactive visuals )
+//
+// process() makes one pass over the magnitude spectrum for centroid, flatness, flux,
+// rolloff ( from the running sum ), onset strength and chroma, then a 13x23 DCT of the log
+// mel bands for the MFCCs. Fixed cost per frame, O(bins) with no allocations and no
+// transcendental calls per bin ( flatness uses a bit trick log2 ), within
+// AUDIO_FEATURES_BUDGET_NS for the window sizes of the audio analyzer ( see example_benchmark ).
+class ofxVPAudioFeatures {
+
+public:
+
+    ofxVPAudioFeatures();
+
+    // not in the audio thread ( allocates )
+    void            setup(int binSize, float binSizeHz);
+
+    // ---- this code runs in the audio thread ----
+    void            process(const float *spectrum, const float *melBands);
+
+    float           getCentroid() const { return centroid; }        // Hz
+    float           getFlatness() const { return flatness; }        // 0 tonal --> 1 noise
+    float           getFlux() const { return flux; }
+    float           getRolloff() const { return rolloff; }          // Hz, 85% of the spectral energy
+    float           getOnset() const { return onset; }              // flux above its running mean
+    const float*    getMFCC() const { return mfcc.data(); }
+    const float*    getChroma() const { return chroma.data(); }     // C, C#, ... B, normalized
+    // ---- end of audio thread code ----
+
+protected:
+
+    std::vector<float>      previous;       // last spectrum, for the flux
+    std::vector<float>      cumulative;     // running spectrum sum, for the rolloff
+    std::vector<int>        binsToChroma;
+    std::vector<float>      dct;            // MFCC_COEFFICIENTS x mel bands
+    std::vector<float>      logMel;
+    std::vector<float>      mfcc;
+    std::vector<float>      chroma;
+
+    int                     binSize;
+    float                   binSizeHz;
+
+    float                   centroid;
+    float                   flatness;
+    float                   flux;
+    float                   fluxMean;
+    float                   rolloff;
+    float                   onset;
+
+};
@@ -0,0 +1,51 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include <mutex>
+
+// Audio graph lock
+//
+// Held by the audio thread for the whole audio block, and by the main thread only around the
+// changes to what the audio thread reads: audio objects update ( file loading included ),
+// pdsp patching, audio pins and objects teardown. Recursive, so a locked section can call
+// into another one ( removing an object disconnects its links ).
+// The audio thread never waits on it: it try_locks, and a block finding it held is played as
+// silence ( PatchObject::audioSilence ). Lock-free audio objects ( isLockFreeAudioObject ) are
+// updated without it, their parameters and data go through ofxVPTripleBuffer channels.
+
+// getter singleton
+inline std::recursive_mutex& getAudioGraphMutex(){
+    static std::recursive_mutex singletonAudioGraphMutex;
+    return singletonAudioGraphMutex;
+}
@@ -0,0 +1,102 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// Audio re-blocking ( device block size --> analysis window/hop size )
+//
+// Audio pins carry blocks of the device buffer size, analysis objects need their own
+// window size ( FFT resolution ) and hop size ( analysis rate ). process() accumulates any
+// number of incoming samples in a ring of windowSize samples and calls onFrame once for
+// every hopSize new samples, with the last windowSize samples in time order. With a 64
+// samples device block and a 2048/512 window/hop, onFrame runs once every 8 blocks;
+// with a 4096 block, 8 times in the same block. No allocations after setup().
+class ofxVPAudioReblocker {
+
+public:
+
+    ofxVPAudioReblocker() : windowSize(0), hopSize(0), writePos(0), hopCount(0) {}
+
+    // not in the audio thread ( allocates ), hopSize is clamped to [1,windowSize]
+    void        setup(size_t window, size_t hop){
+        windowSize  = window;
+        hopSize     = std::max(static_cast<size_t>(1),std::min(hop,window));
+        ring.assign(windowSize,0.0f);
+        frame.assign(windowSize,0.0f);
+        writePos    = 0;
+        hopCount    = 0;
+    }
+
+    template<typename Callback>
+    void        process(const float *samples, size_t numSamples, Callback onFrame){
+        if(windowSize == 0) return;
+
+        while(numSamples > 0){
+            size_t chunk = std::min(numSamples,hopSize-hopCount);
+
+            // write the chunk in the ring ( at most two copies )
+            size_t first = std::min(chunk,windowSize-writePos);
+            memcpy(&ring[writePos],samples,first*sizeof(float));
+            memcpy(&ring[0],samples+first,(chunk-first)*sizeof(float));
+            writePos = (writePos + chunk) % windowSize;
+
+            samples     += chunk;
+            numSamples  -= chunk;
+            hopCount    += chunk;
+
+            if(hopCount == hopSize){
+                hopCount = 0;
+                // oldest sample is at writePos
+                memcpy(&frame[0],&ring[writePos],(windowSize-writePos)*sizeof(float));
+                memcpy(&frame[windowSize-writePos],&ring[0],writePos*sizeof(float));
+                onFrame(frame.data());
+            }
+        }
+    }
+
+    size_t      getWindowSize() const { return windowSize; }
+    size_t      getHopSize() const { return hopSize; }
+
+protected:
+
+    std::vector<float>      ring;
+    std::vector<float>      frame;
+    size_t                  windowSize;
+    size_t                  hopSize;
+    size_t                  writePos;
+    size_t                  hopCount;
+
+};
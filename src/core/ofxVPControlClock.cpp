@@ -0,0 +1,181 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofxVPControlClock.h"
+
+#include "ofxVPObjectProfiler.h"
+
+//--------------------------------------------------------------
+ofxVPControlClock::ofxVPControlClock(){
+    nextCallbackID  = 0;
+    stopping        = false;
+    rate            = OFXVP_CONTROL_RATE;
+    external        = false;
+    externalNs      = 0;
+    nextExternalTickNs = 0;
+    externalStarted = false;
+    ticks           = 0;
+    skippedTicks    = 0;
+}
+
+//--------------------------------------------------------------
+ofxVPControlClock::~ofxVPControlClock(){
+    {
+        std::unique_lock<std::mutex> lck(callbacksMutex);
+        stopping = true;
+    }
+    callbacksCondition.notify_all();
+
+    if(clockThread.joinable()){
+        clockThread.join();
+    }
+}
+
+//--------------------------------------------------------------
+int ofxVPControlClock::addCallback(std::function<void(uint64_t)> callback){
+    int id;
+    {
+        std::unique_lock<std::mutex> lck(callbacksMutex);
+        id = nextCallbackID++;
+        callbacks.push_back({id,callback});
+
+        // the thread is started with the first time based object
+        if(!clockThread.joinable()){
+            clockThread = std::thread(&ofxVPControlClock::clockLoop,this);
+        }
+    }
+    callbacksCondition.notify_all();
+
+    return id;
+}
+
+//--------------------------------------------------------------
+void ofxVPControlClock::removeCallback(int id){
+    if(id < 0) return;
+
+    std::unique_lock<std::mutex> lck(callbacksMutex);
+    for(size_t i=0;i<callbacks.size();i++){
+        if(callbacks[i].id == id){
+            callbacks.erase(callbacks.begin()+i);
+            break;
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPControlClock::setRate(int hz){
+    rate = static_cast<int>(ofClamp(hz,OFXVP_CONTROL_RATE_MIN,OFXVP_CONTROL_RATE_MAX));
+}
+
+//--------------------------------------------------------------
+void ofxVPControlClock::setExternalTime(bool ext){
+    {
+        std::unique_lock<std::mutex> lck(callbacksMutex);
+        external = ext;
+        externalNs = 0;
+        nextExternalTickNs = 0;
+        externalStarted = false;
+    }
+    callbacksCondition.notify_all();
+}
+
+//--------------------------------------------------------------
+void ofxVPControlClock::advanceExternalTime(uint64_t timeNs){
+    std::unique_lock<std::mutex> lck(callbacksMutex);
+    if(!external || timeNs < externalNs.load()) return;
+
+    // the first driven time anchors the ticks grid
+    if(!externalStarted){
+        nextExternalTickNs = timeNs;
+        externalStarted = true;
+    }
+    externalNs = timeNs;
+
+    uint64_t period = 1000000000ULL / static_cast<uint64_t>(rate.load());
+    if(callbacks.empty()){
+        // nothing to tick, keep the grid
+        if(nextExternalTickNs <= timeNs){
+            nextExternalTickNs += ((timeNs - nextExternalTickNs) / period + 1) * period;
+        }
+        return;
+    }
+
+    // every tick up to the driven time, none skipped ( deterministic )
+    while(nextExternalTickNs <= timeNs){
+        for(size_t i=0;i<callbacks.size();i++){
+            callbacks[i].callback(nextExternalTickNs);
+        }
+        ticks++;
+        nextExternalTickNs += period;
+    }
+}
+
+//--------------------------------------------------------------
+uint64_t ofxVPControlClock::now() const {
+    return external.load() ? externalNs.load() : ofxVPTimingRing::now();
+}
+
+//--------------------------------------------------------------
+void ofxVPControlClock::clockLoop(){
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lck(callbacksMutex);
+    while(!stopping){
+
+        if(callbacks.empty() || external){
+            // idle until some time based object registers ( ticked by advanceExternalTime with external time )
+            callbacksCondition.wait(lck, [this]{ return stopping || (!callbacks.empty() && !external); });
+            deadline = std::chrono::steady_clock::now();
+            continue;
+        }
+
+        uint64_t nowNs = ofxVPTimingRing::now();
+        for(size_t i=0;i<callbacks.size();i++){
+            callbacks[i].callback(nowNs);
+        }
+        ticks++;
+
+        std::chrono::nanoseconds period(1000000000LL / rate.load());
+        deadline += period;
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if(now > deadline + period){
+            // fell behind, skip the missed ticks ( no catch-up burst )
+            skippedTicks += static_cast<uint64_t>((now - deadline) / period);
+            deadline = now;
+        }
+
+        lck.unlock();
+        std::this_thread::sleep_until(deadline);
+        lck.lock();
+    }
+}
@@ -0,0 +1,107 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxVPConfig.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+// Fixed timestep control clock
+//
+// A dedicated thread ticking at a fixed rate ( OFXVP_CONTROL_RATE by default ), independent
+// from the render frame rate and from the audio buffer size. Time based objects ( metronome,
+// delays, timers ) register a callback and do their timing there, with the tick timestamp
+// in steady clock nanoseconds; the result is latched into the graph in updateObjectContent.
+// Ticks are scheduled on absolute deadlines so the clock does not drift, if the thread falls
+// behind ( system stall, debugger ) the missed ticks are skipped instead of bursting.
+// Callbacks run with the clock mutex held: they must be short and lock free, and
+// removeCallback() returns only after a running tick has finished.
+// With external time ( headless runner, offline rendering ) the thread stays idle and the
+// ticks run inside advanceExternalTime(), on the fixed step grid of the driven time, so the
+// results depend only on the driven time and not on how fast the patch is computed.
+class ofxVPControlClock {
+
+public:
+
+    ofxVPControlClock();
+    ~ofxVPControlClock();
+
+    int                     addCallback(std::function<void(uint64_t)> callback);
+    void                    removeCallback(int id);
+
+    void                    setRate(int hz);
+    void                    setExternalTime(bool external);
+    void                    advanceExternalTime(uint64_t timeNs);
+
+    uint64_t                now() const;    // clock time ( steady clock nanoseconds, or the driven time )
+    bool                    getExternalTime() const { return external.load(); }
+    int                     getRate() const { return rate.load(); }
+    uint64_t                getTicks() const { return ticks.load(); }
+    uint64_t                getSkippedTicks() const { return skippedTicks.load(); }
+
+protected:
+
+    struct ClockCallback{
+        int                                 id;
+        std::function<void(uint64_t)>       callback;
+    };
+
+    void                    clockLoop();
+
+    std::thread                             clockThread;
+    std::mutex                              callbacksMutex;
+    std::condition_variable                 callbacksCondition;
+    vector<ClockCallback>                   callbacks;
+    int                                     nextCallbackID;
+    bool                                    stopping;
+
+    std::atomic<int>                        rate;
+    std::atomic<bool>                       external;
+    std::atomic<uint64_t>                   externalNs;
+    uint64_t                                nextExternalTickNs;
+    bool                                    externalStarted;    // guarded by callbacksMutex
+    std::atomic<uint64_t>                   ticks;
+    std::atomic<uint64_t>                   skippedTicks;
+
+};
+
+// getter singleton
+inline ofxVPControlClock& getControlClock(){
+    static ofxVPControlClock singletonControlClock;
+    return singletonControlClock;
+}
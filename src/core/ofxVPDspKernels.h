@@ -0,0 +1,214 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Vectorized float kernels for the audio analysis ( audio thread, no allocations )
+//
+// A 4 lanes float abstraction ( SSE, NEON or a plain struct ) with the kernels written once
+// on top of it. Reductions accumulate in 4 lanes, summed in a fixed order, then add the tail
+// in order, so the SSE, NEON and scalar builds give the same bits for the same input. Build
+// with -ffp-contract=off on FMA targets to keep this also for the element wise kernels.
+// Define OFXVP_DSP_NO_SIMD to force the scalar path.
+
+#if !defined(OFXVP_DSP_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define OFXVP_DSP_SSE
+    #include <emmintrin.h>
+#elif !defined(OFXVP_DSP_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #define OFXVP_DSP_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace ofxVPDsp {
+
+#if defined(OFXVP_DSP_SSE)
+
+typedef __m128 vfloat;
+
+inline vfloat   vload(const float *p){ return _mm_loadu_ps(p); }
+inline void     vstore(float *p, vfloat a){ _mm_storeu_ps(p,a); }
+inline vfloat   vset(float x){ return _mm_set1_ps(x); }
+inline vfloat   vadd(vfloat a, vfloat b){ return _mm_add_ps(a,b); }
+inline vfloat   vsub(vfloat a, vfloat b){ return _mm_sub_ps(a,b); }
+inline vfloat   vmul(vfloat a, vfloat b){ return _mm_mul_ps(a,b); }
+inline vfloat   vmin(vfloat a, vfloat b){ return _mm_min_ps(a,b); }
+inline vfloat   vmax(vfloat a, vfloat b){ return _mm_max_ps(a,b); }
+inline vfloat   vabs(vfloat a){ return _mm_andnot_ps(_mm_set1_ps(-0.0f),a); }
+
+#elif defined(OFXVP_DSP_NEON)
+
+typedef float32x4_t vfloat;
+
+inline vfloat   vload(const float *p){ return vld1q_f32(p); }
+inline void     vstore(float *p, vfloat a){ vst1q_f32(p,a); }
+inline vfloat   vset(float x){ return vdupq_n_f32(x); }
+inline vfloat   vadd(vfloat a, vfloat b){ return vaddq_f32(a,b); }
+inline vfloat   vsub(vfloat a, vfloat b){ return vsubq_f32(a,b); }
+inline vfloat   vmul(vfloat a, vfloat b){ return vmulq_f32(a,b); }
+inline vfloat   vmin(vfloat a, vfloat b){ return vminq_f32(a,b); }
+inline vfloat   vmax(vfloat a, vfloat b){ return vmaxq_f32(a,b); }
+inline vfloat   vabs(vfloat a){ return vabsq_f32(a); }
+
+#else
+
+struct vfloat { float v[4]; };
+
+inline vfloat   vload(const float *p){ return {{ p[0],p[1],p[2],p[3] }}; }
+inline void     vstore(float *p, vfloat a){ for(int l=0;l<4;l++) p[l] = a.v[l]; }
+inline vfloat   vset(float x){ return {{ x,x,x,x }}; }
+inline vfloat   vadd(vfloat a, vfloat b){ for(int l=0;l<4;l++) a.v[l] += b.v[l]; return a; }
+inline vfloat   vsub(vfloat a, vfloat b){ for(int l=0;l<4;l++) a.v[l] -= b.v[l]; return a; }
+inline vfloat   vmul(vfloat a, vfloat b){ for(int l=0;l<4;l++) a.v[l] *= b.v[l]; return a; }
+inline vfloat   vmin(vfloat a, vfloat b){ for(int l=0;l<4;l++) a.v[l] = b.v[l] < a.v[l] ? b.v[l] : a.v[l]; return a; }
+inline vfloat   vmax(vfloat a, vfloat b){ for(int l=0;l<4;l++) a.v[l] = b.v[l] > a.v[l] ? b.v[l] : a.v[l]; return a; }
+inline vfloat   vabs(vfloat a){ for(int l=0;l<4;l++) a.v[l] = std::fabs(a.v[l]); return a; }
+
+#endif
+
+// fixed order horizontal reductions
+inline float    vsum(vfloat a){ float l[4]; vstore(l,a); return (l[0]+l[1]) + (l[2]+l[3]); }
+inline float    vpeak(vfloat a){ float l[4]; vstore(l,a); float m = l[0]; for(int i=1;i<4;i++) m = l[i] > m ? l[i] : m; return m; }
+
+//--------------------------------------------------------------
+// out = clamp(in,-1,1)
+inline void clip(const float *in, float *out, size_t n){
+    const vfloat lo = vset(-1.0f), hi = vset(1.0f);
+    size_t i = 0;
+    for(;i+4<=n;i+=4) vstore(out+i,vmin(vmax(vload(in+i),lo),hi));
+    for(;i<n;i++) out[i] = in[i] < -1.0f ? -1.0f : (in[i] > 1.0f ? 1.0f : in[i]);
+}
+
+//--------------------------------------------------------------
+// max(|in|)
+inline float peak(const float *in, size_t n){
+    vfloat acc = vset(0.0f);
+    size_t i = 0;
+    for(;i+4<=n;i+=4) acc = vmax(acc,vabs(vload(in+i)));
+    float m = vpeak(acc);
+    for(;i<n;i++) m = std::fabs(in[i]) > m ? std::fabs(in[i]) : m;
+    return m;
+}
+
+//--------------------------------------------------------------
+// sum(a*b)
+inline float dot(const float *a, const float *b, size_t n){
+    vfloat acc = vset(0.0f);
+    size_t i = 0;
+    for(;i+4<=n;i+=4) acc = vadd(acc,vmul(vload(a+i),vload(b+i)));
+    float sum = vsum(acc);
+    for(;i<n;i++) sum += a[i]*b[i];
+    return sum;
+}
+
+//--------------------------------------------------------------
+// sqrt(sum(in^2)/n)
+inline float rms(const float *in, size_t n){
+    return n > 0 ? std::sqrt(dot(in,in,n)/static_cast<float>(n)) : 0.0f;
+}
+
+//--------------------------------------------------------------
+// state = state*amount + (1-amount)*in ( one pole smoothing )
+inline void smooth(float *state, const float *in, float amount, size_t n){
+    const float rest = 1.0f - amount;
+    const vfloat a = vset(amount), b = vset(rest);
+    size_t i = 0;
+    for(;i+4<=n;i+=4) vstore(state+i,vadd(vmul(vload(state+i),a),vmul(vload(in+i),b)));
+    for(;i<n;i++) state[i] = state[i]*amount + in[i]*rest;
+}
+
+//--------------------------------------------------------------
+// out = in*gain
+inline void scale(const float *in, float *out, float gain, size_t n){
+    const vfloat g = vset(gain);
+    size_t i = 0;
+    for(;i+4<=n;i+=4) vstore(out+i,vmul(vload(in+i),g));
+    for(;i<n;i++) out[i] = in[i]*gain;
+}
+
+//--------------------------------------------------------------
+// out = re^2 + im^2
+inline void power(const float *re, const float *im, float *out, size_t n){
+    size_t i = 0;
+    for(;i+4<=n;i+=4){
+        vfloat r = vload(re+i), m = vload(im+i);
+        vstore(out+i,vadd(vmul(r,r),vmul(m,m)));
+    }
+    for(;i<n;i++) out[i] = re[i]*re[i] + im[i]*im[i];
+}
+
+}
+
+// Banded sparse matrix ( filterbanks: mel, bark, octave bands )
+//
+// Every row has one contiguous run of non zero weights, stored packed, so apply() costs
+// one dot product per row over the bins of that band instead of rows x bins.
+class ofxVPBandMatrix {
+
+public:
+
+    // not in the audio thread ( allocates )
+    void        clear(size_t numRows){
+        first.assign(numRows,0);
+        count.assign(numRows,0);
+        offset.assign(numRows,0);
+        weights.clear();
+    }
+
+    // weights for the bins [firstBin,firstBin+n) of row
+    void        setRow(size_t row, size_t firstBin, const float *w, size_t n){
+        first[row]  = firstBin;
+        count[row]  = n;
+        offset[row] = weights.size();
+        weights.insert(weights.end(),w,w+n);
+    }
+
+    void        apply(const float *in, float *out) const {
+        for(size_t r=0;r<first.size();r++){
+            out[r] = ofxVPDsp::dot(weights.data()+offset[r],in+first[r],count[r]);
+        }
+    }
+
+    size_t      getNumRows() const { return first.size(); }
+
+protected:
+
+    std::vector<size_t>     first;
+    std::vector<size_t>     count;
+    std::vector<size_t>     offset;
+    std::vector<float>      weights;
+
+};
@@ -0,0 +1,199 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "ofxVPObjectProfiler.h"
+
+// Timestamped control event ( steady clock nanoseconds, see ofxVPTimingRing::now() )
+struct ofxVPTimedEvent {
+    uint64_t    timeNs;
+    float       value;
+};
+
+// Lock-free single producer / single consumer queue of timestamped events
+//
+// The producer is the graph update ( an object updateObjectContent ), the consumer is
+// the audio thread, that applies the events at their sample offset inside the block.
+// Fixed capacity, push() drops the event if the audio thread is not draining the queue.
+template<size_t Capacity=64>
+class ofxVPEventQueue {
+
+public:
+
+    ofxVPEventQueue() : head(0), tail(0) {}
+
+    // producer side
+    bool        push(uint64_t timeNs, float value){
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t next = (h + 1) % Capacity;
+        if(next == tail.load(std::memory_order_acquire)) return false;
+        events[h].timeNs = timeNs;
+        events[h].value = value;
+        head.store(next,std::memory_order_release);
+        return true;
+    }
+
+    // consumer side, pops the oldest event if its timestamp is before limitNs
+    bool        popBefore(uint64_t limitNs, ofxVPTimedEvent &e){
+        size_t t = tail.load(std::memory_order_relaxed);
+        if(t == head.load(std::memory_order_acquire)) return false;
+        if(events[t].timeNs >= limitNs) return false;
+        e = events[t];
+        tail.store((t + 1) % Capacity,std::memory_order_release);
+        return true;
+    }
+
+    bool        empty() const { return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire); }
+
+protected:
+
+    ofxVPTimedEvent         events[Capacity];
+    std::atomic<size_t>     head;
+    std::atomic<size_t>     tail;
+
+};
+
+// Timestamped events of one pin during one frame
+//
+// Every bang sent between two graph updates keeps its own event and time ( several control
+// clock bangs in a long frame, an on/off pair inside one frame ), instead of collapsing into
+// a single value change. Written and read by the graph update only, fixed capacity: push()
+// refuses the event when the list is full.
+template<size_t Capacity=16>
+class ofxVPEventList {
+
+public:
+
+    ofxVPEventList() : count(0) {}
+
+    bool        push(uint64_t timeNs, float value){
+        if(count >= Capacity) return false;
+        events[count].timeNs = timeNs;
+        events[count].value = value;
+        count++;
+        return true;
+    }
+
+    void        copyFrom(const ofxVPEventList &other){
+        count = other.count;
+        for(size_t i=0;i<count;i++){
+            events[i] = other.events[i];
+        }
+    }
+
+    void        clear() { count = 0; }
+
+    size_t      size() const { return count; }
+    size_t      available() const { return Capacity - count; }
+    bool        empty() const { return count == 0; }
+    const ofxVPTimedEvent& operator[](size_t i) const { return events[i]; }
+    const ofxVPTimedEvent& back() const { return events[count-1]; }
+
+protected:
+
+    ofxVPTimedEvent         events[Capacity];
+    size_t                  count;
+
+};
+
+// Audio block clock
+//
+// Maps event timestamps to sample offsets inside the audio block being computed. Events
+// are rendered one block after their timestamp: the frame and audio callback jitter
+// becomes a constant latency instead of up to one buffer of random offset. The block
+// start time is predicted from the sample count and only slowly pulled towards the
+// callback time, it is re-anchored after a start, an xrun or while rendering offline.
+class ofxVPAudioClock {
+
+public:
+
+    ofxVPAudioClock() : blockStartNs(0), blockNs(0), sampleRate(0), blockIndex(0) {}
+
+    // audio thread, once at the beginning of every block
+    void        beginBlock(int bufferSize, int sr){
+        uint64_t now = ofxVPTimingRing::now();
+        uint64_t start = blockStartNs.load(std::memory_order_relaxed);
+        uint64_t duration = static_cast<uint64_t>(bufferSize) * 1000000000ULL / static_cast<uint64_t>(sr > 0 ? sr : 1);
+
+        int64_t error = static_cast<int64_t>(now) - static_cast<int64_t>(start + blockNs);
+        if(start == 0 || sr != sampleRate || error > static_cast<int64_t>(duration) || -error > static_cast<int64_t>(duration)){
+            start = now;
+        }else{
+            start = start + blockNs + error/16;
+        }
+
+        blockNs     = duration;
+        sampleRate  = sr;
+        blockStartNs.store(start,std::memory_order_relaxed);
+        blockIndex++;
+    }
+
+    // audio thread, once at the beginning of every offline block ( block time given by the driven clock, no drift correction )
+    void        beginBlockAt(uint64_t timeNs, int bufferSize, int sr){
+        blockNs     = static_cast<uint64_t>(bufferSize) * 1000000000ULL / static_cast<uint64_t>(sr > 0 ? sr : 1);
+        sampleRate  = sr;
+        blockStartNs.store(timeNs,std::memory_order_relaxed);
+        blockIndex++;
+    }
+
+    // audio thread, events stamped before this time belong to the current block ( or are late )
+    uint64_t    getBlockStartNs() const { return blockStartNs.load(std::memory_order_relaxed); }
+
+    // audio thread, counts the blocks ( work shared between objects runs once per block )
+    uint64_t    getBlockIndex() const { return blockIndex; }
+
+    // audio thread, sample offset of an event inside the current block ( late events at 0 )
+    int         getSampleOffset(uint64_t timeNs) const {
+        int64_t delta = static_cast<int64_t>(timeNs + blockNs) - static_cast<int64_t>(blockStartNs.load(std::memory_order_relaxed));
+        if(delta <= 0) return 0;
+        return static_cast<int>(static_cast<uint64_t>(delta) * static_cast<uint64_t>(sampleRate) / 1000000000ULL);
+    }
+
+protected:
+
+    std::atomic<uint64_t>   blockStartNs;
+    uint64_t                blockNs;
+    int                     sampleRate;
+    uint64_t                blockIndex;
+
+};
+
+// getter singleton
+inline ofxVPAudioClock& getAudioClock(){
+    static ofxVPAudioClock singletonAudioClock;
+    return singletonAudioClock;
+}
@@ -0,0 +1,223 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofxVPGraphScheduler.h"
+
+//--------------------------------------------------------------
+ofxVPGraphScheduler::ofxVPGraphScheduler(size_t numThreads){
+    currentSuccessors       = nullptr;
+    currentMainThreadOnly   = nullptr;
+    pendingPredecessorsSize = 0;
+    pendingJobs             = 0;
+    queuedWorkerJobs        = 0;
+    queuedMainJobs          = 0;
+    nextQueue               = 0;
+    stopping                = false;
+
+    if(numThreads == 0){
+        // the main thread works too
+        unsigned int hc = std::thread::hardware_concurrency();
+        numThreads = hc > 1 ? hc - 1 : 1;
+    }
+
+    for(size_t i=0;i<numThreads+1;i++){
+        queues.emplace_back(new WorkQueue());
+    }
+
+    for(size_t i=0;i<numThreads;i++){
+        workers.emplace_back(&ofxVPGraphScheduler::workerLoop,this,i+1);
+    }
+}
+
+//--------------------------------------------------------------
+ofxVPGraphScheduler::~ofxVPGraphScheduler(){
+    {
+        std::unique_lock<std::mutex> lck(stateMutex);
+        stopping = true;
+    }
+    workCondition.notify_all();
+
+    for(size_t i=0;i<workers.size();i++){
+        if(workers.at(i).joinable()){
+            workers.at(i).join();
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPGraphScheduler::run(const vector<vector<size_t>> &successors, const vector<int> &inDegree, const vector<bool> &mainThreadOnly, std::function<void(size_t)> job){
+
+    size_t numNodes = successors.size();
+    if(numNodes == 0) return;
+
+    currentSuccessors       = &successors;
+    currentMainThreadOnly   = &mainThreadOnly;
+    currentJob              = job;
+
+    if(pendingPredecessorsSize < numNodes){
+        pendingPredecessors.reset(new std::atomic<int>[numNodes]);
+        pendingPredecessorsSize = numNodes;
+    }
+    for(size_t i=0;i<numNodes;i++){
+        pendingPredecessors[i].store(inDegree[i]);
+    }
+    pendingJobs = numNodes;
+
+    for(size_t i=0;i<numNodes;i++){
+        if(inDegree[i] == 0){
+            pushJob(0,i);
+        }
+    }
+
+    // main thread: run the main thread only jobs first, then help the workers
+    while(pendingJobs.load() > 0){
+        size_t node;
+        if(popJob(0,node) || stealJob(0,node)){
+            executeJob(0,node);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lck(stateMutex);
+        mainCondition.wait(lck, [this]{ return pendingJobs.load() == 0 || queuedMainJobs.load() > 0 || queuedWorkerJobs.load() > 0; });
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPGraphScheduler::workerLoop(size_t worker){
+    while(true){
+        size_t node;
+        if(popJob(worker,node) || stealJob(worker,node)){
+            executeJob(worker,node);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lck(stateMutex);
+        workCondition.wait(lck, [this]{ return stopping || queuedWorkerJobs.load() > 0; });
+        if(stopping){
+            return;
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPGraphScheduler::pushJob(size_t worker, size_t node){
+    bool mainOnly = (*currentMainThreadOnly)[node];
+
+    size_t q;
+    if(mainOnly){
+        q = 0;
+    }else if(worker > 0){
+        q = worker;
+    }else{
+        // jobs made ready by the main thread are spread over the workers
+        q = 1 + (nextQueue++ % workers.size());
+    }
+
+    {
+        std::unique_lock<std::mutex> lck(queues[q]->mutex);
+        queues[q]->jobs.push_back(node);
+    }
+
+    {
+        std::unique_lock<std::mutex> lck(stateMutex);
+        if(mainOnly){
+            queuedMainJobs++;
+        }else{
+            queuedWorkerJobs++;
+        }
+    }
+
+    if(!mainOnly){
+        workCondition.notify_one();
+    }
+    mainCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+bool ofxVPGraphScheduler::popJob(size_t worker, size_t &node){
+    WorkQueue &q = *queues[worker];
+
+    std::unique_lock<std::mutex> lck(q.mutex);
+    if(q.jobs.empty()){
+        return false;
+    }
+
+    node = q.jobs.back();
+    q.jobs.pop_back();
+
+    if(worker == 0){
+        queuedMainJobs--;
+    }else{
+        queuedWorkerJobs--;
+    }
+
+    return true;
+}
+
+//--------------------------------------------------------------
+bool ofxVPGraphScheduler::stealJob(size_t worker, size_t &node){
+    size_t numWorkers = workers.size();
+
+    for(size_t i=0;i<numWorkers;i++){
+        // never steal from the main thread queue
+        size_t victim = 1 + ((worker + i) % numWorkers);
+        if(victim == worker) continue;
+
+        WorkQueue &q = *queues[victim];
+        std::unique_lock<std::mutex> lck(q.mutex);
+        if(!q.jobs.empty()){
+            node = q.jobs.front();
+            q.jobs.pop_front();
+            queuedWorkerJobs--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------
+void ofxVPGraphScheduler::executeJob(size_t worker, size_t node){
+    currentJob(node);
+
+    const vector<size_t> &next = (*currentSuccessors)[node];
+    for(size_t s=0;s<next.size();s++){
+        if(pendingPredecessors[next[s]].fetch_sub(1) == 1){
+            pushJob(worker,next[s]);
+        }
+    }
+
+    if(pendingJobs.fetch_sub(1) == 1){
+        std::unique_lock<std::mutex> lck(stateMutex);
+        mainCondition.notify_all();
+    }
+}
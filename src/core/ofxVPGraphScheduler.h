@@ -0,0 +1,101 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+// Work-stealing scheduler for the patch graph update
+//
+// run() executes one job per graph node, a node starts only when all its predecessors
+// are done, so independent branches run concurrently. Every worker owns a deque: it pops
+// its own jobs from the back ( the successors it just made ready, hot in cache ) and,
+// when empty, steals from the front of the others. Nodes flagged as main thread only
+// ( GL, pdsp, hardware ) are executed by the calling thread, which also steals jobs
+// while it has nothing else to do. run() returns when every node has been executed.
+class ofxVPGraphScheduler {
+
+public:
+
+    ofxVPGraphScheduler(size_t numThreads=0);
+    ~ofxVPGraphScheduler();
+
+    void                    run(const vector<vector<size_t>> &successors, const vector<int> &inDegree, const vector<bool> &mainThreadOnly, std::function<void(size_t)> job);
+
+    size_t                  getNumThreads() const { return workers.size(); }
+
+protected:
+
+    struct WorkQueue{
+        std::mutex          mutex;
+        std::deque<size_t>  jobs;
+    };
+
+    void                    workerLoop(size_t worker);
+    void                    pushJob(size_t worker, size_t node);
+    bool                    popJob(size_t worker, size_t &node);
+    bool                    stealJob(size_t worker, size_t &node);
+    void                    executeJob(size_t worker, size_t node);
+
+    std::vector<std::thread>                    workers;
+    std::vector<std::unique_ptr<WorkQueue>>     queues;     // [0] main thread, [1..n] workers
+
+    // current run
+    const vector<vector<size_t>>                *currentSuccessors;
+    const vector<bool>                          *currentMainThreadOnly;
+    std::function<void(size_t)>                 currentJob;
+    std::unique_ptr<std::atomic<int>[]>         pendingPredecessors;
+    size_t                                      pendingPredecessorsSize;
+    std::atomic<size_t>                         pendingJobs;
+
+    std::mutex                                  stateMutex;
+    std::condition_variable                     workCondition;
+    std::condition_variable                     mainCondition;
+    std::atomic<size_t>                         queuedWorkerJobs;
+    std::atomic<size_t>                         queuedMainJobs;
+    size_t                                      nextQueue;
+    bool                                        stopping;
+
+};
+
+// getter singleton
+inline ofxVPGraphScheduler& getGraphScheduler(){
+    static ofxVPGraphScheduler singletonGraphScheduler;
+    return singletonGraphScheduler;
+}
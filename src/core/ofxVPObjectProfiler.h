@@ -0,0 +1,131 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#define OFXVP_PROFILER_RING_SIZE    256
+
+enum OFXVP_PROFILER_SECTION {
+    OFXVP_PROFILE_UPDATE,
+    OFXVP_PROFILE_DRAW,
+    OFXVP_PROFILE_AUDIO,
+    OFXVP_PROFILE_SECTIONS
+};
+
+struct ofxVPTimingStats{
+    uint64_t    count;
+    uint64_t    min;
+    double      mean;
+    uint64_t    p95;
+    uint64_t    max;
+};
+
+// Fixed size ring buffer of steady_clock nanoseconds timings
+//
+// Preallocated with the object, push() never allocates. One writer thread per ring
+// ( main thread for update/draw, audio thread for audio ), the readers ( profiler
+// window, export ) just get a recent snapshot.
+class ofxVPTimingRing {
+
+public:
+
+    ofxVPTimingRing() : written(0) { std::fill(samples,samples+OFXVP_PROFILER_RING_SIZE,0); }
+
+    static uint64_t now() { return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()); }
+
+    void push(uint64_t ns){
+        uint64_t w = written.load(std::memory_order_relaxed);
+        samples[w % OFXVP_PROFILER_RING_SIZE] = ns;
+        written.store(w+1,std::memory_order_release);
+    }
+
+    uint64_t getLast() const {
+        uint64_t w = written.load(std::memory_order_acquire);
+        return w > 0 ? samples[(w-1) % OFXVP_PROFILER_RING_SIZE] : 0;
+    }
+
+    // stats over the buffered samples, scratch must hold OFXVP_PROFILER_RING_SIZE values
+    ofxVPTimingStats getStats(uint64_t *scratch) const {
+        ofxVPTimingStats stats = { 0, 0, 0.0, 0, 0 };
+
+        uint64_t w = written.load(std::memory_order_acquire);
+        size_t n = static_cast<size_t>(std::min<uint64_t>(w,OFXVP_PROFILER_RING_SIZE));
+        if(n == 0) return stats;
+
+        uint64_t sum = 0;
+        stats.min = UINT64_MAX;
+        for(size_t i=0;i<n;i++){
+            scratch[i] = samples[i];
+            sum += scratch[i];
+            stats.min = std::min(stats.min,scratch[i]);
+            stats.max = std::max(stats.max,scratch[i]);
+        }
+        stats.count = w;
+        stats.mean  = static_cast<double>(sum) / static_cast<double>(n);
+
+        size_t p95 = std::min(n-1,static_cast<size_t>(n*0.95));
+        std::nth_element(scratch,scratch+p95,scratch+n);
+        stats.p95   = scratch[p95];
+
+        return stats;
+    }
+
+protected:
+
+    uint64_t                samples[OFXVP_PROFILER_RING_SIZE];
+    std::atomic<uint64_t>   written;
+
+};
+
+struct ofxVPObjectTimings{
+    ofxVPTimingRing         sections[OFXVP_PROFILE_SECTIONS];
+};
+
+// measure a scope into a timing ring
+class ofxVPScopedTiming {
+
+public:
+
+    ofxVPScopedTiming(ofxVPTimingRing &r) : ring(r), start(ofxVPTimingRing::now()) {}
+    ~ofxVPScopedTiming() { ring.push(ofxVPTimingRing::now()-start); }
+
+protected:
+
+    ofxVPTimingRing         &ring;
+    uint64_t                start;
+
+};
@@ -0,0 +1,356 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofxVPPatchGenerator.h"
+
+#include "PatchObject.h"
+
+#define GENERATOR_GRID_COLUMNS  32
+
+//--------------------------------------------------------------
+ofxVPPatchGenerator::ofxVPPatchGenerator(){
+    numLinks = 0;
+}
+
+//--------------------------------------------------------------
+bool ofxVPPatchGenerator::generate(const string &templatePatch, const string &path, const ofxVPPatchGeneratorSettings &_settings){
+    settings = _settings;
+    templates.clear();
+    objects.clear();
+    numLinks = 0;
+    rng.seed(settings.seed);
+
+    if(settings.numObjects < 1){
+        ofLog(OF_LOG_ERROR,"Patch generator: invalid number of objects %i",settings.numObjects);
+        return false;
+    }
+
+    if(!loadTemplates()){
+        return false;
+    }
+
+    // start from a copy of the template patch ( settings, release )
+    if(!ofFile::copyFromTo(templatePatch,path,true,true)){
+        ofLog(OF_LOG_ERROR,"Patch generator: can't copy %s to %s",templatePatch.c_str(),path.c_str());
+        return false;
+    }
+
+    xml.setAutosave(false);
+    xml.loadMosaicPatch(path);
+    if(!xml.getIsMosaicPatch()){
+        ofLog(OF_LOG_ERROR,"Patch generator: %s is not a valid Mosaic patch",templatePatch.c_str());
+        return false;
+    }
+
+    objects.reserve(static_cast<size_t>(settings.numObjects));
+
+    switch(settings.topology){
+        case OFXVP_TOPOLOGY_CHAIN:
+            buildChain();
+            break;
+        case OFXVP_TOPOLOGY_FANOUT:
+            buildFanOut();
+            break;
+        case OFXVP_TOPOLOGY_RANDOM_DAG:
+            buildRandomDAG();
+            break;
+        case OFXVP_TOPOLOGY_WIRELESS_MESH:
+            if(!buildWirelessMesh()){
+                return false;
+            }
+            break;
+        default:
+            ofLog(OF_LOG_ERROR,"Patch generator: unknown topology %i",settings.topology);
+            return false;
+    }
+
+    if(!xml.saveMosaicPatch(path)){
+        ofLog(OF_LOG_ERROR,"Patch generator: can't save %s",path.c_str());
+        return false;
+    }
+
+    ofLog(OF_LOG_NOTICE,"Generated patch %s: %i objects, %i links",path.c_str(),getNumObjects(),numLinks);
+
+    return true;
+}
+
+//--------------------------------------------------------------
+int ofxVPPatchGenerator::topologyFromString(const string &name){
+    if(name == "chain"){
+        return OFXVP_TOPOLOGY_CHAIN;
+    }else if(name == "fanout"){
+        return OFXVP_TOPOLOGY_FANOUT;
+    }else if(name == "dag"){
+        return OFXVP_TOPOLOGY_RANDOM_DAG;
+    }else if(name == "wireless"){
+        return OFXVP_TOPOLOGY_WIRELESS_MESH;
+    }
+    return -1;
+}
+
+//--------------------------------------------------------------
+bool ofxVPPatchGenerator::loadTemplates(){
+    vector<string> names = settings.objects;
+    bool controlOnly = names.empty();
+
+    // default mix: control objects only ( no GL, audio or hardware ), so the patch runs headless too
+    if(controlOnly){
+        ofxVPObjects::factory::objectCategories &cats = ofxVPObjects::factory::getCategories();
+        for(const string &cat : {string(OFXVP_OBJECT_CAT_MATH),string(OFXVP_OBJECT_CAT_LOGIC)}){
+            if(cats.find(cat) != cats.end()){
+                names.insert(names.end(),cats[cat].begin(),cats[cat].end());
+            }
+        }
+    }
+
+    for(size_t i=0;i<names.size();i++){
+        ofxVPObjectTemplate tpl;
+        // objects with no inlets or outlets can't be linked inside a graph
+        if(makeTemplate(names[i],tpl,controlOnly) && !tpl.inletsType.empty() && !tpl.outletsType.empty()){
+            templates.push_back(tpl);
+        }
+    }
+
+    if(templates.empty()){
+        ofLog(OF_LOG_ERROR,"Patch generator: no usable objects in the objects mix");
+        return false;
+    }
+
+    return true;
+}
+
+//--------------------------------------------------------------
+bool ofxVPPatchGenerator::makeTemplate(const string &name, ofxVPObjectTemplate &tpl, bool controlOnly){
+    ofxVPObjects::factory::objectRegistry &reg = ofxVPObjects::factory::getObjectRegistry();
+    ofxVPObjects::factory::objectRegistry::iterator it = reg.find(name);
+    if(it == reg.end()){
+        ofLog(OF_LOG_WARNING,"Patch generator: object %s is not available",name.c_str());
+        return false;
+    }
+
+    // new object pins and vars, as added from the canvas
+    PatchObject *obj = it->second();
+    obj->newObject();
+
+    bool valid = !controlOnly || !(obj->getIsSystemObject() || obj->getIsTextureObject() || obj->getIsSharedContextObject() || obj->getIsHardwareObject() || obj->getIsPDSPPatchableObject());
+
+    tpl.name = name;
+    for(int i=0;i<obj->getNumInlets();i++){
+        tpl.inletsType.push_back(obj->getInletType(i));
+        tpl.inletsNames.push_back(obj->getInletName(i));
+        if(controlOnly && obj->getInletType(i) > VP_LINK_ARRAY){
+            valid = false;
+        }
+    }
+    for(int i=0;i<obj->getNumOutlets();i++){
+        tpl.outletsType.push_back(obj->getOutletType(i));
+        tpl.outletsNames.push_back(obj->getOutletName(i));
+        if(controlOnly && obj->getOutletType(i) > VP_LINK_ARRAY){
+            valid = false;
+        }
+    }
+    tpl.vars = obj->getCustomVars();
+
+    delete obj;
+
+    return valid;
+}
+
+//--------------------------------------------------------------
+int ofxVPPatchGenerator::pickTemplate(int inletType, int outletType){
+    vector<int> candidates;
+    for(size_t t=0;t<templates.size();t++){
+        bool hasInlet = inletType == -1 || std::find(templates[t].inletsType.begin(),templates[t].inletsType.end(),inletType) != templates[t].inletsType.end();
+        bool hasOutlet = outletType == -1 || std::find(templates[t].outletsType.begin(),templates[t].outletsType.end(),outletType) != templates[t].outletsType.end();
+        if(hasInlet && hasOutlet){
+            candidates.push_back(static_cast<int>(t));
+        }
+    }
+
+    if(candidates.empty()){
+        return -1;
+    }
+    return candidates[random(candidates.size())];
+}
+
+//--------------------------------------------------------------
+int ofxVPPatchGenerator::pickCompatible(size_t fromObj){
+    // any object with an inlet for some of the source outlets
+    vector<int> candidates;
+    for(size_t t=0;t<templates.size();t++){
+        for(size_t o=0;o<objects[fromObj].tpl->outletsType.size();o++){
+            if(std::find(templates[t].inletsType.begin(),templates[t].inletsType.end(),objects[fromObj].tpl->outletsType[o]) != templates[t].inletsType.end()){
+                candidates.push_back(static_cast<int>(t));
+                break;
+            }
+        }
+    }
+
+    if(candidates.empty()){
+        return pickTemplate();
+    }
+    return candidates[random(candidates.size())];
+}
+
+//--------------------------------------------------------------
+size_t ofxVPPatchGenerator::addObject(const ofxVPObjectTemplate &tpl){
+    size_t index = objects.size();
+
+    ofVec2f pos((index % GENERATOR_GRID_COLUMNS)*(OBJECT_STANDARD_WIDTH+80),(index / GENERATOR_GRID_COLUMNS)*(OBJECT_STANDARD_HEIGHT+60));
+    xml.addNewObject(tpl.name,"none","root",pos);
+
+    GeneratedObject obj;
+    obj.id  = xml.getLastObjectID();
+    obj.tpl = &tpl;
+    obj.inletsUsed.assign(tpl.inletsType.size(),false);
+
+    for(size_t i=0;i<tpl.inletsType.size();i++){
+        xml.addObjectInlet(obj.id,tpl.inletsType[i],tpl.inletsNames[i]);
+    }
+    for(size_t i=0;i<tpl.outletsType.size();i++){
+        xml.addObjectOutlet(obj.id,tpl.outletsType[i],tpl.outletsNames[i]);
+    }
+    for(map<string,float>::const_iterator it = tpl.vars.begin(); it != tpl.vars.end(); it++ ){
+        xml.addObjectVar(obj.id,it->first,it->second);
+    }
+
+    objects.push_back(obj);
+
+    return index;
+}
+
+//--------------------------------------------------------------
+size_t ofxVPPatchGenerator::addWirelessObject(bool sender, const string &channel){
+    size_t index = addObject(sender ? senderTemplate : receiverTemplate);
+    // sender/receiver objects store the channel name as a var name
+    xml.addObjectVar(objects[index].id,channel,0.0f);
+    return index;
+}
+
+//--------------------------------------------------------------
+bool ofxVPPatchGenerator::link(size_t fromObj, size_t toObj){
+    const ofxVPObjectTemplate &from = *objects[fromObj].tpl;
+    const ofxVPObjectTemplate &to = *objects[toObj].tpl;
+
+    // first free inlet of the same type ( one link by inlet, as on the canvas )
+    for(size_t o=0;o<from.outletsType.size();o++){
+        for(size_t i=0;i<to.inletsType.size();i++){
+            if(from.outletsType[o] == to.inletsType[i] && !objects[toObj].inletsUsed[i]){
+                xml.addObjectLink(objects[fromObj].id,static_cast<int>(o),objects[toObj].id,static_cast<int>(i));
+                objects[toObj].inletsUsed[i] = true;
+                numLinks++;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//--------------------------------------------------------------
+size_t ofxVPPatchGenerator::random(size_t range){
+    // modulo instead of std::uniform_int_distribution, same patch from the same seed with any standard library
+    return static_cast<size_t>(rng() % range);
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchGenerator::buildChain(){
+    addObject(templates[pickTemplate()]);
+    for(int i=1;i<settings.numObjects;i++){
+        size_t obj = addObject(templates[pickCompatible(objects.size()-1)]);
+        link(obj-1,obj);
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchGenerator::buildFanOut(){
+    size_t fanOut = static_cast<size_t>(std::max(1,settings.fanOut));
+
+    // tree, every object linked from its parent ( a single level if fanOut >= numObjects )
+    addObject(templates[pickTemplate()]);
+    for(int i=1;i<settings.numObjects;i++){
+        size_t parent = (static_cast<size_t>(i)-1)/fanOut;
+        size_t obj = addObject(templates[pickCompatible(parent)]);
+        link(parent,obj);
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchGenerator::buildRandomDAG(){
+    for(int i=0;i<settings.numObjects;i++){
+        size_t obj = addObject(templates[pickTemplate()]);
+        // incoming links from previous objects only, no cycles
+        for(int l=0;i>0 && l<settings.linksPerObject;l++){
+            link(random(obj),obj);
+        }
+    }
+}
+
+//--------------------------------------------------------------
+bool ofxVPPatchGenerator::buildWirelessMesh(){
+    ofxVPObjects::factory::objectRegistry &reg = ofxVPObjects::factory::getObjectRegistry();
+    if(reg.find("sender") == reg.end() || reg.find("receiver") == reg.end()){
+        ofLog(OF_LOG_ERROR,"Patch generator: sender/receiver objects are not available");
+        return false;
+    }
+
+    // float sender/receiver pins and vars ( the pins are created on data type change )
+    senderTemplate = { "sender", {VP_LINK_NUMERIC}, {"number"}, {VP_LINK_NUMERIC}, {"number"}, {{"DATA_TYPE",0.0f},{"IS_SENDING",1.0f}} };
+    receiverTemplate = { "receiver", {VP_LINK_NUMERIC}, {"number"}, {VP_LINK_NUMERIC}, {"number"}, {{"DATA_TYPE",0.0f},{"IS_RECEIVING",1.0f}} };
+
+    int sourceTpl = pickTemplate(-1,VP_LINK_NUMERIC);
+    int relayTpl = pickTemplate(VP_LINK_NUMERIC,VP_LINK_NUMERIC);
+    if(sourceTpl == -1 || relayTpl == -1){
+        ofLog(OF_LOG_ERROR,"Patch generator: a wireless mesh needs objects with numeric inlets and outlets");
+        return false;
+    }
+
+    // channels in sequence: source -> sender ~> receivers -> objects, the first one feeding the next channel sender
+    size_t receivers = static_cast<size_t>(std::max(1,settings.fanOut));
+    size_t source = addObject(templates[sourceTpl]);
+    for(int channel=0;static_cast<int>(objects.size()) < settings.numObjects;channel++){
+        string channelName = "mesh_"+ofToString(channel);
+
+        size_t sender = addWirelessObject(true,channelName);
+        link(source,sender);
+
+        for(size_t r=0;r<receivers && static_cast<int>(objects.size()) < settings.numObjects;r++){
+            size_t receiver = addWirelessObject(false,channelName);
+            size_t obj = addObject(templates[r == 0 ? relayTpl : pickTemplate(VP_LINK_NUMERIC)]);
+            link(receiver,obj);
+            if(r == 0){
+                source = obj;
+            }
+        }
+    }
+
+    return true;
+}
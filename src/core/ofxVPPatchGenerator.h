@@ -0,0 +1,117 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxVPXmlEngine.h"
+
+#include <random>
+
+enum ofxVPPatchTopology{
+    OFXVP_TOPOLOGY_CHAIN,
+    OFXVP_TOPOLOGY_FANOUT,
+    OFXVP_TOPOLOGY_RANDOM_DAG,
+    OFXVP_TOPOLOGY_WIRELESS_MESH
+};
+
+struct ofxVPPatchGeneratorSettings{
+    int             topology        = OFXVP_TOPOLOGY_CHAIN;
+    int             numObjects      = 1000;
+    int             fanOut          = 8;    // fan-out tree children, wireless receivers by channel
+    int             linksPerObject  = 2;    // random DAG incoming links
+    unsigned int    seed            = 0;
+    vector<string>  objects;                // object mix, empty for the registry math and logic objects
+};
+
+// pins and default vars of an object, taken from a fresh registry instance
+struct ofxVPObjectTemplate{
+    string              name;
+    vector<int>         inletsType;
+    vector<string>      inletsNames;
+    vector<int>         outletsType;
+    vector<string>      outletsNames;
+    map<string,float>   vars;
+};
+
+// Synthetic patch generator for scaling tests
+//
+// Writes valid Mosaic patches with thousands of objects and links ( chains, fan-out trees,
+// random DAGs, wireless meshes ), starting from an empty patch file. Objects are written with
+// the same pins and vars of a new object, so the patch loads as if built on the canvas, and
+// the same seed always gives the same patch.
+class ofxVPPatchGenerator {
+
+public:
+
+    ofxVPPatchGenerator();
+
+    bool            generate(const string &templatePatch, const string &path, const ofxVPPatchGeneratorSettings &_settings);
+
+    static int      topologyFromString(const string &name);
+
+    int             getNumObjects() const { return static_cast<int>(objects.size()); }
+    int             getNumLinks() const { return numLinks; }
+
+protected:
+
+    struct GeneratedObject{
+        int                         id;
+        const ofxVPObjectTemplate   *tpl;
+        vector<bool>                inletsUsed;
+    };
+
+    bool            loadTemplates();
+    bool            makeTemplate(const string &name, ofxVPObjectTemplate &tpl, bool controlOnly);
+    int             pickTemplate(int inletType=-1, int outletType=-1);
+    int             pickCompatible(size_t fromObj);
+    size_t          addObject(const ofxVPObjectTemplate &tpl);
+    size_t          addWirelessObject(bool sender, const string &channel);
+    bool            link(size_t fromObj, size_t toObj);
+    size_t          random(size_t range);
+
+    void            buildChain();
+    void            buildFanOut();
+    void            buildRandomDAG();
+    bool            buildWirelessMesh();
+
+    ofxVPXmlEngine                  xml;
+    ofxVPPatchGeneratorSettings     settings;
+    vector<ofxVPObjectTemplate>     templates;
+    ofxVPObjectTemplate             senderTemplate;
+    ofxVPObjectTemplate             receiverTemplate;
+    vector<GeneratedObject>         objects;
+    std::mt19937                    rng;
+    int                             numLinks;
+
+};
@@ -0,0 +1,237 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofxVPPatchPersistence.h"
+
+//--------------------------------------------------------------
+ofxVPPatchPersistence::ofxVPPatchPersistence(){
+    firstChangeTime = 0;
+    lastChangeTime  = 0;
+    stopRequested   = false;
+}
+
+//--------------------------------------------------------------
+ofxVPPatchPersistence::~ofxVPPatchPersistence(){
+    stop();
+    waitForThread(false);
+    flush();
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchPersistence::setObjectVar(const std::string& patchFile, int objectID, const std::string& varName, float value){
+    std::unique_lock<std::mutex> lck(mutex);
+
+    uint64_t now = ofGetElapsedTimeMillis();
+    if(journal.empty()){
+        firstChangeTime = now;
+    }
+    lastChangeTime = now;
+
+    journal[patchFile][objectID][varName] = value;
+
+    if(!isThreadRunning()){
+        stopRequested = false;
+        startThread();
+    }
+    condition.notify_all();
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchPersistence::discardObject(const std::string& patchFile, int objectID){
+    std::unique_lock<std::mutex> lck(mutex);
+
+    patchJournal::iterator it = journal.find(patchFile);
+    if(it != journal.end()){
+        it->second.erase(objectID);
+        if(it->second.empty()){
+            journal.erase(it);
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchPersistence::flush(){
+    // waits for any write in progress, then writes whatever is left in the journal
+    std::lock_guard<std::recursive_mutex> flck(fileMutex);
+
+    patchJournal pending;
+    {
+        std::unique_lock<std::mutex> lck(mutex);
+        pending.swap(journal);
+    }
+
+    if(!pending.empty()){
+        writeJournal(pending);
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchPersistence::stop(){
+    std::unique_lock<std::mutex> lck(mutex);
+    stopRequested = true;
+    stopThread();
+    condition.notify_all();
+}
+
+//--------------------------------------------------------------
+bool ofxVPPatchPersistence::hasPendingChanges(){
+    std::unique_lock<std::mutex> lck(mutex);
+    return !journal.empty();
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchPersistence::threadedFunction(){
+    while(true){
+        {
+            // the stop flag is checked under the mutex, so a stop() notify can't be missed
+            std::unique_lock<std::mutex> lck(mutex);
+            condition.wait(lck, [this]{ return stopRequested || !journal.empty(); });
+            if(stopRequested) break;
+
+            // debounce: wait for the changes to settle, but never more than the max delay
+            uint64_t now = ofGetElapsedTimeMillis();
+            uint64_t deadline = std::min(lastChangeTime + OFXVP_PERSISTENCE_DEBOUNCE_MS, firstChangeTime + OFXVP_PERSISTENCE_MAX_DELAY_MS);
+            if(now < deadline){
+                condition.wait_for(lck, std::chrono::milliseconds(deadline - now), [this]{ return stopRequested; });
+                continue;
+            }
+        }
+
+        flush();
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchPersistence::writeJournal(patchJournal &pending){
+    for(patchJournal::iterator pf = pending.begin(); pf != pending.end(); pf++ ){
+        ofxVPXmlEngine xml;
+        xml.setAutosave(false);
+        xml.loadMosaicPatch(pf->first);
+
+        if(!xml.getIsMosaicPatch()){
+            // old patch format, fallback to ofxXmlSettings
+            writeLegacyVars(pf->first,pf->second);
+            continue;
+        }
+
+        for(std::map<int,std::map<std::string,float>>::iterator obj = pf->second.begin(); obj != pf->second.end(); obj++ ){
+            for(std::map<std::string,float>::iterator var = obj->second.begin(); var != obj->second.end(); var++ ){
+                if(xml.hasObjectVar(obj->first,var->first)){
+                    xml.setObjectVar(obj->first,var->first,var->second);
+                }else{
+                    xml.addObjectVar(obj->first,var->first,var->second);
+                }
+            }
+        }
+
+        if(!xml.saveMosaicPatch(pf->first)){
+            ofLog(OF_LOG_ERROR,"Patch persistence: can't write patch file %s",pf->first.c_str());
+        }
+    }
+
+    ofLog(OF_LOG_VERBOSE,"Patch persistence: flushed %i patch file(s)",static_cast<int>(pending.size()));
+}
+
+//--------------------------------------------------------------
+void ofxVPPatchPersistence::writeLegacyVars(const std::string& patchFile, std::map<int,std::map<std::string,float>> &objectsVars){
+    ofxXmlSettings XML;
+
+#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
+    if (!XML.loadFile(patchFile)){
+#else
+    if (!XML.load(patchFile)){
+#endif
+        ofLog(OF_LOG_ERROR,"Patch persistence: can't load patch file %s",patchFile.c_str());
+        return;
+    }
+
+    int totalObjects = XML.getNumTags("object");
+    for(int i=0;i<totalObjects;i++){
+        if(XML.pushTag("object", i)){
+            std::map<int,std::map<std::string,float>>::iterator obj = objectsVars.find(XML.getValue("id", -1));
+            if(obj != objectsVars.end()){
+                if(!XML.tagExists("vars")){
+                    XML.addTag("vars");
+                }
+                if(XML.pushTag("vars")){
+                    int numVars = XML.getNumTags("var");
+                    for(std::map<std::string,float>::iterator var = obj->second.begin(); var != obj->second.end(); var++ ){
+                        bool found = false;
+                        for(int v=0;v<numVars;v++){
+                            if(XML.pushTag("var",v)){
+                                if(XML.getValue("name","") == var->first){
+                                    XML.setValue("value",var->second);
+                                    found = true;
+                                }
+                                XML.popTag();
+                            }
+                            if(found) break;
+                        }
+                        if(!found){
+                            int newVar = XML.addTag("var");
+                            if(XML.pushTag("var",newVar)){
+                                XML.addValue("name",var->first);
+                                XML.addValue("value",var->second);
+                                XML.popTag();
+                                numVars++;
+                            }
+                        }
+                    }
+                    XML.popTag();
+                }
+            }
+            XML.popTag();
+        }
+    }
+
+    saveXml(XML,patchFile);
+}
+
+//--------------------------------------------------------------
+bool ofxVPPatchPersistence::saveXml(ofxXmlSettings &XML, const std::string& patchFile){
+    std::string path = ofToDataPath(patchFile,true);
+    std::string tempPath = path+".tmp";
+#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
+    bool saved = XML.saveFile(tempPath);
+#else
+    bool saved = XML.save(tempPath);
+#endif
+    std::error_code ec;
+    if(saved){
+        std::filesystem::rename(tempPath,path,ec);
+    }
+    if(!saved || ec){
+        ofLog(OF_LOG_ERROR,"Patch persistence: can't write patch file %s",patchFile.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,93 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxVPXmlEngine.h"
+#include "ofxXmlSettings.h"
+
+#include <condition_variable>
+#include <mutex>
+
+#define OFXVP_PERSISTENCE_DEBOUNCE_MS   500
+#define OFXVP_PERSISTENCE_MAX_DELAY_MS  2000
+
+// Write-behind persistence for objects custom vars
+//
+// Custom vars changes are stored in an in-memory journal and written to the patch file
+// from a background thread, once the changes stop for OFXVP_PERSISTENCE_DEBOUNCE_MS
+// ( or at most every OFXVP_PERSISTENCE_MAX_DELAY_MS while they keep coming ).
+// Every code that loads, edits and saves the patch file must hold getFileMutex(),
+// and every code that reads vars from the patch file must call flush() first.
+class ofxVPPatchPersistence : public ofThread {
+
+public:
+
+    ofxVPPatchPersistence();
+    ~ofxVPPatchPersistence();
+
+    void                    setObjectVar(const std::string& patchFile, int objectID, const std::string& varName, float value);
+    void                    discardObject(const std::string& patchFile, int objectID);
+    void                    flush();
+    void                    stop();
+
+    bool                    hasPendingChanges();
+    std::recursive_mutex&   getFileMutex() { return fileMutex; }
+
+    // write to a temp file and rename it, so the patch file is never left half written
+    static bool             saveXml(ofxXmlSettings &XML, const std::string& patchFile);
+
+protected:
+
+    typedef std::map<std::string,std::map<int,std::map<std::string,float>>> patchJournal;
+
+    void                    threadedFunction();
+    void                    writeJournal(patchJournal &pending);
+    void                    writeLegacyVars(const std::string& patchFile, std::map<int,std::map<std::string,float>> &objectsVars);
+
+    std::condition_variable condition;
+    std::recursive_mutex    fileMutex;
+
+    patchJournal            journal;
+    uint64_t                firstChangeTime;
+    uint64_t                lastChangeTime;
+    bool                    stopRequested;      // guarded by mutex
+
+};
+
+// getter singleton
+inline ofxVPPatchPersistence& getPatchPersistence(){
+    static ofxVPPatchPersistence singletonPersistence;
+    return singletonPersistence;
+}
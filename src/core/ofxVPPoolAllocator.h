@@ -0,0 +1,132 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <mutex>
+
+// Fixed size blocks pool
+//
+// Blocks are carved from contiguous chunks and recycled through a free list, so many small
+// objects with the same size ( patch links ) stay close in memory and cost no heap call once
+// the pool is warm. Chunks are never released.
+class ofxVPBlockPool {
+
+public:
+
+    ofxVPBlockPool(size_t _blockSize, size_t _blocksPerChunk=256) {
+        // room for the free list pointer, aligned for any type
+        blockSize       = std::max(_blockSize,sizeof(void*));
+        blockSize       = (blockSize + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+        blocksPerChunk  = _blocksPerChunk;
+        freeList        = nullptr;
+    }
+
+    void* allocate(){
+        std::lock_guard<std::mutex> lck(mutex);
+        if(freeList == nullptr){
+            addChunk();
+        }
+        void *block = freeList;
+        freeList = *static_cast<void**>(freeList);
+        return block;
+    }
+
+    void deallocate(void *block){
+        std::lock_guard<std::mutex> lck(mutex);
+        *static_cast<void**>(block) = freeList;
+        freeList = block;
+    }
+
+protected:
+
+    void addChunk(){
+        chunks.push_back(std::unique_ptr<unsigned char[]>(new unsigned char[blockSize*blocksPerChunk]));
+        unsigned char *chunk = chunks.back().get();
+        // link the new blocks in address order
+        for(size_t i=blocksPerChunk;i>0;i--){
+            void *block = chunk + (i-1)*blockSize;
+            *static_cast<void**>(block) = freeList;
+            freeList = block;
+        }
+    }
+
+    vector<std::unique_ptr<unsigned char[]>>    chunks;
+    void                                        *freeList;
+    size_t                                      blockSize;
+    size_t                                      blocksPerChunk;
+    std::mutex                                  mutex;
+
+};
+
+// getter singleton ( one pool by block size, never destroyed: blocks can outlive static objects at exit )
+template<size_t BlockSize>
+inline ofxVPBlockPool& getBlockPool(){
+    static ofxVPBlockPool *singletonBlockPool = new ofxVPBlockPool(BlockSize);
+    return *singletonBlockPool;
+}
+
+// Standard allocator on the blocks pools, for std::allocate_shared ( object and control block in one pooled block )
+template<typename T>
+class ofxVPPoolAllocator {
+
+public:
+
+    typedef T value_type;
+
+    ofxVPPoolAllocator() noexcept {}
+    template<typename U>
+    ofxVPPoolAllocator(const ofxVPPoolAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n){
+        if(n != 1 || alignof(T) > alignof(std::max_align_t)){
+            return static_cast<T*>(::operator new(n*sizeof(T)));
+        }
+        return static_cast<T*>(getBlockPool<sizeof(T)>().allocate());
+    }
+
+    void deallocate(T *p, size_t n) noexcept {
+        if(n != 1 || alignof(T) > alignof(std::max_align_t)){
+            ::operator delete(p);
+            return;
+        }
+        getBlockPool<sizeof(T)>().deallocate(p);
+    }
+
+};
+
+template<typename T, typename U>
+inline bool operator==(const ofxVPPoolAllocator<T>&, const ofxVPPoolAllocator<U>&) { return true; }
+template<typename T, typename U>
+inline bool operator!=(const ofxVPPoolAllocator<T>&, const ofxVPPoolAllocator<U>&) { return false; }
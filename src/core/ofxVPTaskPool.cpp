@@ -0,0 +1,106 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofxVPTaskPool.h"
+
+//--------------------------------------------------------------
+ofxVPTaskPool::ofxVPTaskPool(size_t numThreads){
+    activeTasks = 0;
+    stopping    = false;
+
+    if(numThreads == 0){
+        // leave one core to the main thread
+        unsigned int hc = std::thread::hardware_concurrency();
+        numThreads = hc > 1 ? hc - 1 : 1;
+    }
+
+    for(size_t i=0;i<numThreads;i++){
+        workers.emplace_back(&ofxVPTaskPool::workerLoop,this);
+    }
+}
+
+//--------------------------------------------------------------
+ofxVPTaskPool::~ofxVPTaskPool(){
+    {
+        std::unique_lock<std::mutex> lck(poolMutex);
+        stopping = true;
+    }
+    taskCondition.notify_all();
+
+    for(size_t i=0;i<workers.size();i++){
+        if(workers.at(i).joinable()){
+            workers.at(i).join();
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPTaskPool::submit(std::function<void()> task){
+    {
+        std::unique_lock<std::mutex> lck(poolMutex);
+        tasks.push_back(std::move(task));
+    }
+    taskCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+void ofxVPTaskPool::waitForAll(){
+    std::unique_lock<std::mutex> lck(poolMutex);
+    doneCondition.wait(lck, [this]{ return tasks.empty() && activeTasks == 0; });
+}
+
+//--------------------------------------------------------------
+void ofxVPTaskPool::workerLoop(){
+    while(true){
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lck(poolMutex);
+            taskCondition.wait(lck, [this]{ return stopping || !tasks.empty(); });
+            if(stopping && tasks.empty()){
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            activeTasks++;
+        }
+
+        task();
+
+        {
+            std::unique_lock<std::mutex> lck(poolMutex);
+            activeTasks--;
+            if(tasks.empty() && activeTasks == 0){
+                doneCondition.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+// A fixed size thread pool for CPU only jobs ( file reads, decoding, parsing )
+//
+// Submitted tasks must NOT touch GL resources, the pdsp graph or the patch objects,
+// all of that stays on the main thread.
+class ofxVPTaskPool {
+
+public:
+
+    ofxVPTaskPool(size_t numThreads=0);
+    ~ofxVPTaskPool();
+
+    void                    submit(std::function<void()> task);
+    void                    waitForAll();
+
+    size_t                  getNumThreads() const { return workers.size(); }
+
+protected:
+
+    void                    workerLoop();
+
+    std::vector<std::thread>            workers;
+    std::deque<std::function<void()>>   tasks;
+    std::mutex                          poolMutex;
+    std::condition_variable             taskCondition;
+    std::condition_variable             doneCondition;
+    size_t                              activeTasks;
+    bool                                stopping;
+
+};
+
+// getter singleton
+inline ofxVPTaskPool& getTaskPool(){
+    static ofxVPTaskPool singletonTaskPool;
+    return singletonTaskPool;
+}
@@ -0,0 +1,92 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofxVPTriggerControl.h"
+
+#include "utils.h"
+
+//--------------------------------------------------------------
+ofxVPTriggerControl::ofxVPTriggerControl(){
+    addOutput("trig", output);
+    updateOutputNodes();
+
+    if(dynamicConstruction){
+        prepareToPlay(globalPrepareBufferSize, globalPrepareSampleRate);
+    }
+}
+
+//--------------------------------------------------------------
+pdsp::Patchable& ofxVPTriggerControl::out_trig(){
+    return out("trig");
+}
+
+//--------------------------------------------------------------
+void ofxVPTriggerControl::trigger(uint64_t timeNs, float value){
+    if(!events.push(timeNs,value)){
+        ofLog(OF_LOG_WARNING,"trigger control: event queue full, trigger dropped");
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPTriggerControl::off(uint64_t timeNs){
+    trigger(timeNs,PDSP_TRIGGER_OFF);
+}
+
+//--------------------------------------------------------------
+void ofxVPTriggerControl::prepareUnit(int expectedBufferSize, double sampleRate){
+    unusedArgs(expectedBufferSize,sampleRate);
+}
+
+//--------------------------------------------------------------
+void ofxVPTriggerControl::releaseResources(){
+
+}
+
+//--------------------------------------------------------------
+void ofxVPTriggerControl::process(int bufferSize) noexcept{
+
+    // ---- this code runs in the audio thread ----
+    ofxVPTimedEvent e;
+    if(!events.popBefore(getAudioClock().getBlockStartNs(),e)){
+        setOutputToZero(output);
+        return;
+    }
+
+    float* outputBuffer = getOutputBufferToFill(output);
+    ofx_Aeq_S(outputBuffer, 0.0f, bufferSize);
+
+    do{
+        int offset = getAudioClock().getSampleOffset(e.timeNs);
+        if(offset >= bufferSize) offset = bufferSize-1;
+        outputBuffer[offset] = e.value;
+    }while(events.popBefore(getAudioClock().getBlockStartNs(),e));
+}
@@ -0,0 +1,68 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxPDSP.h"
+
+#include "ofxVPEventQueue.h"
+
+// Sample accurate pdsp trigger control
+//
+// Same role as pdsp::TriggerControl, but the triggers carry the timestamp of the control
+// event ( bang ) that generated them: the graph update pushes the events, the audio thread
+// writes each one in the trigger buffer at its sample offset ( see ofxVPAudioClock ).
+// A bang that rises and falls between two audio blocks is not lost anymore.
+class ofxVPTriggerControl : public pdsp::Unit {
+
+public:
+
+    ofxVPTriggerControl();
+
+    pdsp::Patchable&        out_trig();
+
+    // graph update thread
+    void                    trigger(uint64_t timeNs, float value);
+    void                    off(uint64_t timeNs);
+
+private:
+
+    void                    prepareUnit(int expectedBufferSize, double sampleRate) override;
+    void                    releaseResources() override;
+    void                    process(int bufferSize) noexcept override;
+
+    pdsp::OutputNode        output;
+    ofxVPEventQueue<>       events;
+
+};
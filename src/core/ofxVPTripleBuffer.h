@@ -0,0 +1,80 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free single producer / single consumer snapshot channel ( triple buffer )
+//
+// The producer fills getWriteBuffer() and calls publish(), the consumer calls
+// update() and reads getReadBuffer(). Neither side ever waits on the other, the
+// consumer always gets the latest complete snapshot ( older ones are dropped ).
+// Used between the audio callback and the main thread, in both directions.
+template<typename T>
+class ofxVPTripleBuffer {
+
+public:
+
+    ofxVPTripleBuffer() : writeIndex(0), readIndex(2), middle(1) {}
+
+    // producer side
+    T&          getWriteBuffer() { return buffers[writeIndex]; }
+    void        publish() { writeIndex = middle.exchange(static_cast<uint8_t>(writeIndex | NEW_DATA),std::memory_order_acq_rel) & INDEX_MASK; }
+
+    // consumer side, returns true if a new snapshot has been received
+    bool        update(){
+        if((middle.load(std::memory_order_acquire) & NEW_DATA) == 0) return false;
+        readIndex = middle.exchange(readIndex,std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+    T&          getReadBuffer() { return buffers[readIndex]; }
+
+    // fill all the slots with the same value ( only before the channel is in use )
+    void        reset(const T& value){
+        for(int i=0;i<3;i++){
+            buffers[i] = value;
+        }
+    }
+
+protected:
+
+    static const uint8_t    INDEX_MASK  = 0x3;
+    static const uint8_t    NEW_DATA    = 0x4;
+
+    T                       buffers[3];
+    uint8_t                 writeIndex;
+    uint8_t                 readIndex;
+    std::atomic<uint8_t>    middle;
+
+};
@@ -0,0 +1,146 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofxVPWavWriter.h"
+
+#define WAV_FORMAT_IEEE_FLOAT   3
+#define WAV_HEADER_SIZE         58  // RIFF + fmt ( 18 ) + fact + data headers
+
+//--------------------------------------------------------------
+ofxVPWavWriter::ofxVPWavWriter(){
+    sampleRate      = 0;
+    channels        = 0;
+    framesWritten   = 0;
+}
+
+//--------------------------------------------------------------
+ofxVPWavWriter::~ofxVPWavWriter(){
+    close();
+}
+
+//--------------------------------------------------------------
+bool ofxVPWavWriter::open(const string &path, int _sampleRate, int _channels){
+    close();
+
+    if(_sampleRate <= 0 || _channels <= 0){
+        ofLog(OF_LOG_ERROR,"WAV writer: invalid format, %i Hz, %i channels",_sampleRate,_channels);
+        return false;
+    }
+
+    file.open(ofToDataPath(path,true),std::ios::binary | std::ios::trunc);
+    if(!file.is_open()){
+        ofLog(OF_LOG_ERROR,"WAV writer: unable to open %s",path.c_str());
+        return false;
+    }
+
+    sampleRate      = _sampleRate;
+    channels        = _channels;
+    framesWritten   = 0;
+
+    writeHeader();
+
+    return true;
+}
+
+//--------------------------------------------------------------
+void ofxVPWavWriter::write(const ofSoundBuffer &buffer){
+    if(!file.is_open() || buffer.getNumFrames() == 0) return;
+
+    if(static_cast<int>(buffer.getNumChannels()) == channels){
+        file.write(reinterpret_cast<const char*>(buffer.getBuffer().data()),static_cast<std::streamsize>(buffer.getNumFrames()*channels*sizeof(float)));
+    }else{
+        // channels mismatch: missing channels are written as silence, extra channels are dropped
+        float silence = 0.0f;
+        for(size_t f=0;f<buffer.getNumFrames();f++){
+            for(int c=0;c<channels;c++){
+                if(c < static_cast<int>(buffer.getNumChannels())){
+                    file.write(reinterpret_cast<const char*>(&buffer.getBuffer()[f*buffer.getNumChannels()+c]),sizeof(float));
+                }else{
+                    file.write(reinterpret_cast<const char*>(&silence),sizeof(float));
+                }
+            }
+        }
+    }
+
+    framesWritten += buffer.getNumFrames();
+}
+
+//--------------------------------------------------------------
+void ofxVPWavWriter::close(){
+    if(!file.is_open()) return;
+
+    // patch the header sizes
+    file.seekp(0,std::ios::beg);
+    writeHeader();
+    file.close();
+}
+
+//--------------------------------------------------------------
+void ofxVPWavWriter::writeHeader(){
+    // RIFF sizes are 32 bit ( files bigger than 4GB are not supported )
+    uint32_t dataSize = static_cast<uint32_t>(std::min<uint64_t>(framesWritten*channels*sizeof(float),UINT32_MAX-WAV_HEADER_SIZE));
+
+    file.write("RIFF",4);
+    writeUInt32(WAV_HEADER_SIZE-8+dataSize);
+    file.write("WAVE",4);
+
+    file.write("fmt ",4);
+    writeUInt32(18);
+    writeUInt16(WAV_FORMAT_IEEE_FLOAT);
+    writeUInt16(static_cast<uint16_t>(channels));
+    writeUInt32(static_cast<uint32_t>(sampleRate));
+    writeUInt32(static_cast<uint32_t>(sampleRate*channels*sizeof(float)));
+    writeUInt16(static_cast<uint16_t>(channels*sizeof(float)));
+    writeUInt16(32);
+    writeUInt16(0);
+
+    // fact chunk, required for non PCM formats
+    file.write("fact",4);
+    writeUInt32(4);
+    writeUInt32(static_cast<uint32_t>(std::min<uint64_t>(framesWritten,UINT32_MAX)));
+
+    file.write("data",4);
+    writeUInt32(dataSize);
+}
+
+//--------------------------------------------------------------
+void ofxVPWavWriter::writeUInt32(uint32_t value){
+    // little endian, whatever the host
+    char bytes[4] = { static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF), static_cast<char>((value >> 16) & 0xFF), static_cast<char>((value >> 24) & 0xFF) };
+    file.write(bytes,4);
+}
+
+//--------------------------------------------------------------
+void ofxVPWavWriter::writeUInt16(uint16_t value){
+    char bytes[2] = { static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF) };
+    file.write(bytes,2);
+}
@@ -0,0 +1,66 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+// Minimal multichannel WAV file writer ( 32 bit float PCM, interleaved )
+//
+// Used by the offline audio render: the header is written on open with empty sizes and
+// patched on close, so blocks can be streamed to disk with no buffering.
+class ofxVPWavWriter {
+
+public:
+
+    ofxVPWavWriter();
+    ~ofxVPWavWriter();
+
+    bool            open(const string &path, int sampleRate, int channels);
+    void            write(const ofSoundBuffer &buffer);
+    void            close();
+
+    bool            isOpen() const { return file.is_open(); }
+    uint64_t        getFramesWritten() const { return framesWritten; }
+
+protected:
+
+    void            writeHeader();
+    void            writeUInt32(uint32_t value);
+    void            writeUInt16(uint16_t value);
+
+    std::ofstream   file;
+    int             sampleRate;
+    int             channels;
+    uint64_t        framesWritten;
+
+};
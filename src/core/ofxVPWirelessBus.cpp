@@ -0,0 +1,118 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofxVPWirelessBus.h"
+
+#include "PatchObject.h"
+
+//--------------------------------------------------------------
+ofxVPWirelessBus::ofxVPWirelessBus(){
+    dirty = true;
+}
+
+//--------------------------------------------------------------
+void ofxVPWirelessBus::rebuild(map<int,shared_ptr<PatchObject>> &patchObjects){
+
+    dirty = false;
+
+    senders.clear();
+    receivers.clear();
+    routes.clear();
+
+    // collect wireless pins by channel
+    for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
+        if(it->second == nullptr || it->second->getWillErase()) continue;
+
+        PatchObject *obj = it->second.get();
+        for(int out=0;out<obj->getNumOutlets();out++){
+            if(obj->getOutletWirelessSend(out)){
+                ofxVPWirelessPin _p = { obj, out };
+                senders[channelKey(internChannel(obj->getOutletID(out)),obj->getOutletType(out))].push_back(_p);
+            }
+        }
+        for(int in=0;in<obj->getNumInlets();in++){
+            if(obj->getInletWirelessReceive(in)){
+                ofxVPWirelessPin _p = { obj, in };
+                receivers[channelKey(internChannel(obj->getInletID(in)),obj->getInletType(in))].push_back(_p);
+            }
+        }
+    }
+
+    // routes by sending object
+    for(std::unordered_map<uint64_t,vector<ofxVPWirelessPin>>::iterator it = senders.begin(); it != senders.end(); it++ ){
+        std::unordered_map<uint64_t,vector<ofxVPWirelessPin>>::iterator rec = receivers.find(it->first);
+        if(rec == receivers.end()) continue;
+
+        for(size_t s=0;s<it->second.size();s++){
+            ofxVPWirelessRoute _r;
+            _r.outlet       = it->second[s].pin;
+            _r.receivers    = rec->second;
+            routes[it->second[s].object].push_back(_r);
+        }
+    }
+
+}
+
+//--------------------------------------------------------------
+void ofxVPWirelessBus::clear(){
+    senders.clear();
+    receivers.clear();
+    routes.clear();
+    dirty = true;
+}
+
+//--------------------------------------------------------------
+int ofxVPWirelessBus::internChannel(const string &name){
+    std::unordered_map<string,int>::iterator it = channelsIDs.find(name);
+    if(it != channelsIDs.end()){
+        return it->second;
+    }
+
+    int id = static_cast<int>(channelsIDs.size());
+    channelsIDs[name] = id;
+    return id;
+}
+
+//--------------------------------------------------------------
+const vector<ofxVPWirelessRoute>* ofxVPWirelessBus::getRoutes(const PatchObject *sender) const{
+    std::unordered_map<const PatchObject*,vector<ofxVPWirelessRoute>>::const_iterator it = routes.find(sender);
+    return it != routes.end() ? &it->second : nullptr;
+}
+
+//--------------------------------------------------------------
+const vector<ofxVPWirelessPin>* ofxVPWirelessBus::getSenders(const string &name, int type) const{
+    std::unordered_map<string,int>::const_iterator ch = channelsIDs.find(name);
+    if(ch == channelsIDs.end()) return nullptr;
+
+    std::unordered_map<uint64_t,vector<ofxVPWirelessPin>>::const_iterator it = senders.find(channelKey(ch->second,type));
+    return it != senders.end() ? &it->second : nullptr;
+}
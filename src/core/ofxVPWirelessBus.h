@@ -0,0 +1,89 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <atomic>
+#include <unordered_map>
+
+class PatchObject;
+
+struct ofxVPWirelessPin{
+    PatchObject     *object;
+    int             pin;
+};
+
+struct ofxVPWirelessRoute{
+    int                         outlet;
+    vector<ofxVPWirelessPin>    receivers;
+};
+
+// Central routing table for the wireless links ( sender/receiver objects )
+//
+// Channel names are interned to integer ids, and every sending object gets its own list of
+// routes ( outlet -> receiving inlets of the same channel and type ), so the per frame
+// forwarding is a direct pointer fan-out. The table is rebuilt on the main thread, before
+// updating the objects, only when some wireless pin name, type or flag changed.
+class ofxVPWirelessBus {
+
+public:
+
+    ofxVPWirelessBus();
+
+    void                                invalidate() { dirty = true; }
+    bool                                isDirty() const { return dirty.load(); }
+    void                                rebuild(map<int,shared_ptr<PatchObject>> &patchObjects);
+    void                                clear();
+
+    int                                 internChannel(const string &name);
+    const vector<ofxVPWirelessRoute>*   getRoutes(const PatchObject *sender) const;
+    const vector<ofxVPWirelessPin>*     getSenders(const string &name, int type) const;
+
+protected:
+
+    static uint64_t                     channelKey(int channel, int type) { return (static_cast<uint64_t>(channel) << 8) | static_cast<uint64_t>(type & 0xFF); }
+
+    std::unordered_map<string,int>                                      channelsIDs;
+    std::unordered_map<uint64_t,vector<ofxVPWirelessPin>>               senders;
+    std::unordered_map<uint64_t,vector<ofxVPWirelessPin>>               receivers;
+    std::unordered_map<const PatchObject*,vector<ofxVPWirelessRoute>>   routes;
+    std::atomic<bool>                                                   dirty;
+
+};
+
+// getter singleton
+inline ofxVPWirelessBus& getWirelessBus(){
+    static ofxVPWirelessBus singletonWirelessBus;
+    return singletonWirelessBus;
+}
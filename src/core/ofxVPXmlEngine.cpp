@@ -38,6 +38,9 @@ void ofxVPXmlEngine::loadMosaicPatch(std::string path){
     filepath = path;
     isLoaded = xml.load_file(filepath.c_str()) != pugi::status_ok;
 
+    objectsIndex.clear();
+    lastObjectID = 0;
+
     // check if is a valid Mosaic patch
     if(isLoaded){
         isMosaicPatch = checkIsMosaicPatch();
@@ -50,6 +53,7 @@ void ofxVPXmlEngine::loadMosaicPatch(std::string path){
             if(nodeExists(xml,"settings")){
                 settingNode = getPatchChildNode(xml,"settings");
             }
+            buildObjectsIndex();
         }
     }else{
         #ifdef OFXVP_DEBUG
@@ -59,9 +63,28 @@ void ofxVPXmlEngine::loadMosaicPatch(std::string path){
 }
 
 //--------------------------------------------------------------
-void ofxVPXmlEngine::saveMosaicPatch(std::string path){
+bool ofxVPXmlEngine::saveMosaicPatch(std::string path){
     if(isMosaicPatch){
-        xml.save_file(path.c_str());
+        // write to a temp file and rename it, so the patch file is never left half written
+        std::string tempPath = path+".tmp";
+        if(xml.save_file(tempPath.c_str())){
+            std::error_code ec;
+            std::filesystem::rename(tempPath,path,ec);
+            if(!ec){
+                return true;
+            }
+            #ifdef OFXVP_DEBUG
+            std::cout << "ERROR, can't rename " << tempPath << " to " << path << ": " << ec.message() << std::endl;
+            #endif
+        }
+    }
+    return false;
+}
+
+//--------------------------------------------------------------
+void ofxVPXmlEngine::autosavePatch(){
+    if(autosave){
+        saveMosaicPatch(filepath);
     }
 }
 
@@ -149,6 +172,10 @@ void ofxVPXmlEngine::printTests(){
         printPatchSettings();
         setMosaicConfig("bpm",120);
 
+        // ----------------------------------------- performance tests
+        benchmarkObjectsLookup(1000);
+        benchmarkObjectsLookup(10000);
+
     }
 }
 
@@ -237,62 +264,58 @@ void ofxVPXmlEngine::printObjectLinks(int objid, int outlet_order){
 void ofxVPXmlEngine::printObject(int id){
     std::cout << "Printing object with ID " << id << std::endl;
 
-    auto objectsXml = getPatchObjects();
-    for(auto & obj: objectsXml){
-        auto n = obj.node();
-        if(getPatchChildInt(n,"id") == id){
-            std::cout << "Object: " << getObjectName(id) << " of subpatch: " << getObjectSubpatch(id) << std::endl;
-            std::cout << "with filepath: " << getObjectFilepath(id) << " at position (" << getObjectPosition(id).x << "," << getObjectPosition(id).y << ")" << std::endl;
-
-            // inlets
-            pugi::xpath_node_set inlets = getObjectInlets(id);
-            if(!inlets.empty()){
-                std::cout << "has the following inlets:" << std::endl;
-                for(auto & inlet: inlets){
-                    auto i = inlet.node();
-                    std::cout << "    " << getPatchChildString(i,"name") << " of type  " << getPatchChildFloat(i,"type") << std::endl;
-                }
-            }else{
-                std::cout << "has NO inlets" << std::endl;
+    if(checkIsObjectNode(getObjectNode(id))){
+        std::cout << "Object: " << getObjectName(id) << " of subpatch: " << getObjectSubpatch(id) << std::endl;
+        std::cout << "with filepath: " << getObjectFilepath(id) << " at position (" << getObjectPosition(id).x << "," << getObjectPosition(id).y << ")" << std::endl;
+
+        // inlets
+        pugi::xpath_node_set inlets = getObjectInlets(id);
+        if(!inlets.empty()){
+            std::cout << "has the following inlets:" << std::endl;
+            for(auto & inlet: inlets){
+                auto i = inlet.node();
+                std::cout << "    " << getPatchChildString(i,"name") << " of type  " << getPatchChildFloat(i,"type") << std::endl;
             }
+        }else{
+            std::cout << "has NO inlets" << std::endl;
+        }
 
-            // outlets with links
-            pugi::xpath_node_set outlets = getObjectOutlets(id);
-            if(!outlets.empty()){
-                std::cout << "has the following outlets:" << std::endl;
-                int oi = 0;
-                for(auto & outlet: outlets){
-                    auto i = outlet.node();
-                    std::cout << "    " << getPatchChildString(i,"name") << " of type  " << getPatchChildFloat(i,"type") << std::endl;
-                    pugi::xpath_node_set links = getObjectLinks(id,oi);
-                    if(!links.empty()){
-                        std::cout << "        with links to:" << std::endl;
-                        for(auto & link: links){
-                            auto l = link.node();
-                            std::cout << "        Link to object " << getObjectName(getPatchChildInt(l,"id")) << " : to inlet  " << getPatchChildInt(l,"inlet") << std::endl;
-                        }
-                    }else{
-                        std::cout << "        outlet " << oi << " has NO links" << std::endl;
+        // outlets with links
+        pugi::xpath_node_set outlets = getObjectOutlets(id);
+        if(!outlets.empty()){
+            std::cout << "has the following outlets:" << std::endl;
+            int oi = 0;
+            for(auto & outlet: outlets){
+                auto i = outlet.node();
+                std::cout << "    " << getPatchChildString(i,"name") << " of type  " << getPatchChildFloat(i,"type") << std::endl;
+                pugi::xpath_node_set links = getObjectLinks(id,oi);
+                if(!links.empty()){
+                    std::cout << "        with links to:" << std::endl;
+                    for(auto & link: links){
+                        auto l = link.node();
+                        std::cout << "        Link to object " << getObjectName(getPatchChildInt(l,"id")) << " : to inlet  " << getPatchChildInt(l,"inlet") << std::endl;
                     }
-                    oi++;
+                }else{
+                    std::cout << "        outlet " << oi << " has NO links" << std::endl;
                 }
-            }else{
-                std::cout << "has NO outlets" << std::endl;
+                oi++;
             }
+        }else{
+            std::cout << "has NO outlets" << std::endl;
+        }
 
-            // vars
-            pugi::xpath_node_set vars = getObjectVars(id);
-            if(!vars.empty()){
-                std::cout << "has the following vars:" << std::endl;
-                for(auto & var: vars){
-                    auto v = var.node();
-                    std::cout << "    " << getPatchChildString(v,"name") << " : " << getPatchChildFloat(v,"value") << std::endl;
-                }
-            }else{
-                std::cout << "has NO vars" << std::endl;
+        // vars
+        pugi::xpath_node_set vars = getObjectVars(id);
+        if(!vars.empty()){
+            std::cout << "has the following vars:" << std::endl;
+            for(auto & var: vars){
+                auto v = var.node();
+                std::cout << "    " << getPatchChildString(v,"name") << " : " << getPatchChildFloat(v,"value") << std::endl;
             }
-
+        }else{
+            std::cout << "has NO vars" << std::endl;
         }
+
     }
 }
 
@@ -311,7 +334,7 @@ void ofxVPXmlEngine::printPatchConnections(){
             int index = 0;
             for(auto & outlet: outlets){
                 auto o = outlet.node();
-                pugi::xpath_node_set links = getObjectLinks(objID,index);
+                pugi::xpath_node_set links = o.select_nodes("to");
                 if(!links.empty()){
                     for(auto & link: links){
                         auto l = link.node();
@@ -337,7 +360,90 @@ void ofxVPXmlEngine::scrambleObjectVars(int id){
         setPatchValue(v, "value", ofRandomuf());
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
+}
+
+//--------------------------------------------------------------
+ofxVPXmlBenchmark ofxVPXmlEngine::benchmarkObjectsLookup(int numObjects, std::string tempPath, bool verbose){
+    ofxVPXmlBenchmark res;
+    res.numObjects = numObjects;
+
+    // build an in-memory chain patch, written to disk only if a temp path is given
+    ofxVPXmlEngine bench;
+    bench.setAutosave(false);
+    bench.xml.append_child("www").text().set(MOSAIC_CHECK_STRING);
+    bench.isLoaded = true;
+    bench.isMosaicPatch = true;
+
+    uint64_t startTime = ofGetElapsedTimeMicros();
+    for(int i=0;i<numObjects;i++){
+        bench.addNewObject("bench","none","root",ofVec2f(i,0));
+        int lid = bench.getLastObjectID();
+        bench.addObjectInlet(lid,0,"in");
+        bench.addObjectOutlet(lid,0,"out");
+        bench.addObjectVar(lid,"BENCH",static_cast<float>(i));
+        if(lid > 1){
+            bench.addObjectLink(lid-1,0,lid,0);
+        }
+    }
+    res.buildTime = ofGetElapsedTimeMicros() - startTime;
+
+    if(tempPath != ""){
+        // save/load round trip ( load includes the index build )
+        startTime = ofGetElapsedTimeMicros();
+        bench.saveMosaicPatch(tempPath);
+        res.saveTime = ofGetElapsedTimeMicros() - startTime;
+
+        startTime = ofGetElapsedTimeMicros();
+        bench.loadMosaicPatch(tempPath);
+        res.loadTime = ofGetElapsedTimeMicros() - startTime;
+
+        std::error_code ec;
+        std::filesystem::remove(tempPath,ec);
+    }
+
+    startTime = ofGetElapsedTimeMicros();
+    bench.buildObjectsIndex();
+    res.indexTime = ofGetElapsedTimeMicros() - startTime;
+
+    // indexed lookup of every object, as done while loading a patch
+    startTime = ofGetElapsedTimeMicros();
+    for(int i=1;i<=numObjects;i++){
+        if(bench.checkIsObjectNode(bench.getObjectNode(i))){
+            res.links += bench.getObjectLinks(i,0).size();
+            res.found++;
+        }
+    }
+    res.lookupTime = ofGetElapsedTimeMicros() - startTime;
+
+    // same lookups with the old whole document XPath query
+    startTime = ofGetElapsedTimeMicros();
+    int foundXPath = 0;
+    for(int i=1;i<=numObjects;i++){
+        auto objectsXml = bench.getPatchObjects();
+        for(auto & obj: objectsXml){
+            auto n = obj.node();
+            if(bench.getPatchChildInt(n,"id") == i){
+                foundXPath++;
+                break;
+            }
+        }
+    }
+    res.xpathTime = ofGetElapsedTimeMicros() - startTime;
+
+    if(verbose){
+        std::cout << "Objects lookup benchmark with " << numObjects << " objects --------------------" << std::endl;
+        std::cout << "patch build: " << res.buildTime << " us" << std::endl;
+        if(tempPath != ""){
+            std::cout << "patch save: " << res.saveTime << " us" << std::endl;
+            std::cout << "patch load: " << res.loadTime << " us" << std::endl;
+        }
+        std::cout << "index build: " << res.indexTime << " us" << std::endl;
+        std::cout << "indexed lookup: " << res.lookupTime << " us (" << res.found << " objects, " << res.links << " links)" << std::endl;
+        std::cout << "xpath lookup: " << res.xpathTime << " us (" << foundXPath << " objects)" << std::endl;
+    }
+
+    return res;
 }
 
 //--------------------------------------------------------------
@@ -350,23 +456,13 @@ bool ofxVPXmlEngine::checkIsObjectNode(pugi::xml_node node){
 
 //--------------------------------------------------------------
 int ofxVPXmlEngine::getLastObjectID(){
-    int res = 0;
-    auto objectsXml = getPatchObjects();
-    for(auto & obj: objectsXml){
-        auto n = obj.node();
-        int nid = getPatchChildInt(n,"id") ;
-        if(nid > res){
-            res = nid;
-        }
-    }
-
-    return res;
+    return lastObjectID;
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::addNewObject(std::string name, std::string _filepath, std::string subpatch, ofVec2f pos){
     pugi::xml_node newObject = xml.append_child("object");
-    int nextID = getLastObjectID() + 1;
+    int nextID = lastObjectID + 1;
     newObject.append_child("id");
     newObject.append_child("name");
     newObject.append_child("filepath");
@@ -385,7 +481,9 @@ void ofxVPXmlEngine::addNewObject(std::string name, std::string _filepath, std::
     setPatchValue(objPos,"x", pos.x);
     setPatchValue(objPos,"y", pos.y);
 
-    saveMosaicPatch(filepath);
+    indexObjectNode(newObject);
+
+    autosavePatch();
 
 }
 
@@ -395,7 +493,7 @@ void ofxVPXmlEngine::setObjectFilepath(int objid, std::string _filepath){
 
     setPatchValue(n,"filepath", _filepath);
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
@@ -404,7 +502,7 @@ void ofxVPXmlEngine::setObjectSubpatch(int objid, std::string subpatch){
 
     setPatchValue(n,"subpatch", subpatch);
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
@@ -414,16 +512,27 @@ void ofxVPXmlEngine::setObjectPos(int objid, ofVec2f pos){
     setPatchValue(op,"x", pos.x);
     setPatchValue(op,"y", pos.y);
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::removeObject(int id){
-    pugi::xml_node n = getObjectNode(id);
-
-    xml.remove_child(n);
+    std::unordered_map<int,ofxVPXmlObjectNodes>::iterator it = objectsIndex.find(id);
+    if(it != objectsIndex.end()){
+        xml.remove_child(it->second.node);
+        objectsIndex.erase(it);
+
+        if(id == lastObjectID){
+            lastObjectID = 0;
+            for(auto & obj: objectsIndex){
+                if(obj.first > lastObjectID){
+                    lastObjectID = obj.first;
+                }
+            }
+        }
+    }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
@@ -438,62 +547,37 @@ void ofxVPXmlEngine::addObjectInlet(int objid, int type, std::string name){
     setPatchValue(ni,"type", type);
     setPatchValue(ni,"name", name);
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::setObjectInletType(int objid, int inlet_order, int type){
-    pugi::xpath_node_set inlets = getObjectInlets(objid);
-    if(!inlets.empty()){
-        int index = 0;
-        for(auto & inlet: inlets){
-            if(index == inlet_order){
-                auto i = inlet.node();
-                setPatchValue(i,"type", type);
-                break;
-            }
-            index++;
-        }
+    pugi::xml_node i = getObjectInletNode(objid,inlet_order);
+    if(i){
+        setPatchValue(i,"type", type);
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::setObjectInletName(int objid, int inlet_order, std::string name){
-    pugi::xpath_node_set inlets = getObjectInlets(objid);
-    if(!inlets.empty()){
-        int index = 0;
-        for(auto & inlet: inlets){
-            if(index == inlet_order){
-                auto i = inlet.node();
-                setPatchValue(i,"name", name);
-                break;
-            }
-            index++;
-        }
+    pugi::xml_node i = getObjectInletNode(objid,inlet_order);
+    if(i){
+        setPatchValue(i,"name", name);
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::removeObjectInlet(int objid, int inlet_order){
-    pugi::xml_node oi = getObjectNode(objid).child("inlets");
-    pugi::xpath_node_set inlets = getObjectInlets(objid);
-    if(!inlets.empty()){
-        int index = 0;
-        for(auto & inlet: inlets){
-            if(index == inlet_order){
-                auto i = inlet.node();
-                oi.remove_child(i);
-                break;
-            }
-            index++;
-        }
+    pugi::xml_node i = getObjectInletNode(objid,inlet_order);
+    if(i){
+        i.parent().remove_child(i);
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
@@ -508,84 +592,51 @@ void ofxVPXmlEngine::addObjectOutlet(int objid, int type, std::string name){
     setPatchValue(no,"type", type);
     setPatchValue(no,"name", name);
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::setObjectOutletType(int objid, int outlet_order, int type){
-    pugi::xpath_node_set outlets = getObjectOutlets(objid);
-    if(!outlets.empty()){
-        int index = 0;
-        for(auto & outlet: outlets){
-            if(index == outlet_order){
-                auto o = outlet.node();
-                setPatchValue(o,"type", type);
-                break;
-            }
-            index++;
-        }
+    pugi::xml_node o = getObjectOutletNode(objid,outlet_order);
+    if(o){
+        setPatchValue(o,"type", type);
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::setObjectOutletName(int objid, int outlet_order, std::string name){
-    pugi::xpath_node_set outlets = getObjectOutlets(objid);
-    if(!outlets.empty()){
-        int index = 0;
-        for(auto & outlet: outlets){
-            if(index == outlet_order){
-                auto o = outlet.node();
-                setPatchValue(o,"name", name);
-                break;
-            }
-            index++;
-        }
+    pugi::xml_node o = getObjectOutletNode(objid,outlet_order);
+    if(o){
+        setPatchValue(o,"name", name);
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::removeObjectOutlet(int objid, int outlet_order){
-    pugi::xml_node oo = getObjectNode(objid).child("outlets");
-    pugi::xpath_node_set outlets = getObjectOutlets(objid);
-    if(!outlets.empty()){
-        int index = 0;
-        for(auto & outlet: outlets){
-            if(index == outlet_order){
-                auto o = outlet.node();
-                oo.remove_child(o);
-                break;
-            }
-            index++;
-        }
+    pugi::xml_node o = getObjectOutletNode(objid,outlet_order);
+    if(o){
+        o.parent().remove_child(o);
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::addObjectLink(int objid, int outlet_order, int toObjId, int toInletId){
-    pugi::xpath_node_set outlets = getObjectOutlets(objid);
-    if(!outlets.empty()){
-        int index = 0;
-        for(auto & outlet: outlets){
-            if(index == outlet_order){
-                auto o = outlet.node();
-                pugi::xml_node nl = o.append_child("to");
-                nl.append_child("id");
-                nl.append_child("inlet");
-                setPatchValue(nl,"id",toObjId);
-                setPatchValue(nl,"inlet",toInletId);
-                break;
-            }
-            index++;
-        }
+    pugi::xml_node o = getObjectOutletNode(objid,outlet_order);
+    if(o){
+        pugi::xml_node nl = o.append_child("to");
+        nl.append_child("id");
+        nl.append_child("inlet");
+        setPatchValue(nl,"id",toObjId);
+        setPatchValue(nl,"inlet",toInletId);
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
@@ -603,7 +654,7 @@ void ofxVPXmlEngine::setObjectLinkToObjID(int objid, int outlet_order, int link_
         }
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
@@ -621,25 +672,15 @@ void ofxVPXmlEngine::setObjectLinkToInletID(int objid, int outlet_order, int lin
         }
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::removeObjectLink(int objid, int outlet_order, int link_order){
-    pugi::xpath_node_set outlets = getObjectOutlets(objid);
-    pugi::xml_node outletParent;
-
-    if(!outlets.empty()){
-        int index = 0;
-        for(auto & outlet: outlets){
-            if(index == outlet_order){
-                outletParent = outlet.node();
-                break;
-            }
-            index++;
-        }
+    pugi::xml_node outletParent = getObjectOutletNode(objid,outlet_order);
 
-        pugi::xpath_node_set links = getObjectLinks(objid,outlet_order);
+    if(outletParent){
+        pugi::xpath_node_set links = outletParent.select_nodes("to");
         if(!links.empty()){
             int index2 = 0;
             for(auto & link: links){
@@ -653,25 +694,15 @@ void ofxVPXmlEngine::removeObjectLink(int objid, int outlet_order, int link_orde
         }
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::removeAllObjectOutletLinks(int objid, int outlet_order){
-    pugi::xpath_node_set outlets = getObjectOutlets(objid);
-    pugi::xml_node outletParent;
-
-    if(!outlets.empty()){
-        int index = 0;
-        for(auto & outlet: outlets){
-            if(index == outlet_order){
-                outletParent = outlet.node();
-                break;
-            }
-            index++;
-        }
+    pugi::xml_node outletParent = getObjectOutletNode(objid,outlet_order);
 
-        pugi::xpath_node_set links = getObjectLinks(objid,outlet_order);
+    if(outletParent){
+        pugi::xpath_node_set links = outletParent.select_nodes("to");
         if(!links.empty()){
             for(auto & link: links){
                 auto l = link.node();
@@ -680,7 +711,7 @@ void ofxVPXmlEngine::removeAllObjectOutletLinks(int objid, int outlet_order){
         }
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
@@ -691,7 +722,7 @@ void ofxVPXmlEngine::removeAllObjectLinks(int objid){
         int index = 0;
         for(auto & outlet: outlets){
             pugi::xml_node outletParent = outlet.node();
-            pugi::xpath_node_set links = getObjectLinks(objid,index);
+            pugi::xpath_node_set links = outletParent.select_nodes("to");
             if(!links.empty()){
                 for(auto & link: links){
                     auto l = link.node();
@@ -702,7 +733,7 @@ void ofxVPXmlEngine::removeAllObjectLinks(int objid){
         }
     }
 
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 
@@ -719,11 +750,25 @@ void ofxVPXmlEngine::addObjectVar(int objid, std::string varName, float varValue
         setPatchValue(newVar,"name", varName);
         setPatchValue(newVar,"value", varValue);
 
-        saveMosaicPatch(filepath);
+        autosavePatch();
     }
 
 }
 
+//--------------------------------------------------------------
+bool ofxVPXmlEngine::hasObjectVar(int objid, std::string varName){
+    pugi::xpath_node_set vars = getObjectVars(objid);
+
+    for(auto & var: vars){
+        auto v = var.node();
+        if(getPatchChildString(v,"name") == varName){
+            return true;
+        }
+    }
+
+    return false;
+}
+
 //--------------------------------------------------------------
 void ofxVPXmlEngine::setObjectVar(int objid, std::string varName, float varValue){
     pugi::xpath_node_set vars = getObjectVars(objid);
@@ -737,7 +782,7 @@ void ofxVPXmlEngine::setObjectVar(int objid, std::string varName, float varValue
             }
         }
 
-        saveMosaicPatch(filepath);
+        autosavePatch();
     }
 }
 
@@ -756,14 +801,14 @@ void ofxVPXmlEngine::removeObjectVar(int objid, std::string varName){
             }
         }
 
-        saveMosaicPatch(filepath);
+        autosavePatch();
     }
 }
 
 //--------------------------------------------------------------
 void ofxVPXmlEngine::setMosaicConfig(std::string configVar, int value){
     setPatchValue(settingNode,configVar,value);
-    saveMosaicPatch(filepath);
+    autosavePatch();
 }
 
 //--------------------------------------------------------------
@@ -771,14 +816,72 @@ int ofxVPXmlEngine::getMosaicConfig(std::string configVar){
     return getPatchChildInt(settingNode,configVar);
 }
 
+//--------------------------------------------------------------
+void ofxVPXmlEngine::buildObjectsIndex(){
+    objectsIndex.clear();
+    lastObjectID = 0;
+
+    // one linear pass over the patch objects
+    for(pugi::xml_node n = xml.child("object"); n; n = n.next_sibling("object")){
+        indexObjectNode(n);
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPXmlEngine::indexObjectNode(pugi::xml_node n){
+    ofxVPXmlObjectNodes objNodes;
+    objNodes.node       = n;
+    objNodes.inlets     = n.child("inlets");
+    objNodes.outlets    = n.child("outlets");
+    objNodes.vars       = n.child("vars");
+
+    int nid = getPatchChildInt(n,"id");
+    objectsIndex[nid] = objNodes;
+
+    if(nid > lastObjectID){
+        lastObjectID = nid;
+    }
+}
+
 //--------------------------------------------------------------
 pugi::xml_node ofxVPXmlEngine::getObjectNode(int id){
     if(isMosaicPatch){
-        auto objectsXml = getPatchObjects();
-        for(auto & obj: objectsXml){
-            auto n = obj.node();
-            if(getPatchChildInt(n,"id") == id){
-                return n;
+        std::unordered_map<int,ofxVPXmlObjectNodes>::iterator it = objectsIndex.find(id);
+        if(it != objectsIndex.end()){
+            return it->second.node;
+        }
+    }
+    return empty;
+}
+
+//--------------------------------------------------------------
+pugi::xml_node ofxVPXmlEngine::getObjectInletNode(int objid, int inlet_order){
+    if(isMosaicPatch){
+        std::unordered_map<int,ofxVPXmlObjectNodes>::iterator it = objectsIndex.find(objid);
+        if(it != objectsIndex.end()){
+            int index = 0;
+            for(pugi::xml_node i = it->second.inlets.child("link"); i; i = i.next_sibling("link")){
+                if(index == inlet_order){
+                    return i;
+                }
+                index++;
+            }
+        }
+    }
+    return empty;
+}
+
+//--------------------------------------------------------------
+pugi::xml_node ofxVPXmlEngine::getObjectOutletNode(int objid, int outlet_order){
+    if(isMosaicPatch){
+        std::unordered_map<int,ofxVPXmlObjectNodes>::iterator it = objectsIndex.find(objid);
+        if(it != objectsIndex.end()){
+            int index = 0;
+            for(pugi::xml_node o = it->second.outlets.child("link"); o; o = o.next_sibling("link")){
+                if(index == outlet_order){
+                    return o;
+                }
+                index++;
             }
         }
     }
@@ -825,10 +928,9 @@ ofVec2f ofxVPXmlEngine::getObjectPosition(int id){
 
 //--------------------------------------------------------------
 pugi::xpath_node_set ofxVPXmlEngine::getObjectVars(int id){
-    pugi::xml_node n = getObjectNode(id);
-    if(checkIsObjectNode(n)){
-        pugi::xml_node vars = getPatchChildNode(n,"vars");
-        auto objVars = vars.select_nodes("var");
+    std::unordered_map<int,ofxVPXmlObjectNodes>::iterator it = objectsIndex.find(id);
+    if(isMosaicPatch && it != objectsIndex.end()){
+        auto objVars = it->second.vars.select_nodes("var");
         if(objVars.empty()){
             return empty_set;
         }else{
@@ -840,10 +942,9 @@ pugi::xpath_node_set ofxVPXmlEngine::getObjectVars(int id){
 
 //--------------------------------------------------------------
 pugi::xpath_node_set ofxVPXmlEngine::getObjectInlets(int id){
-    pugi::xml_node n = getObjectNode(id);
-    if(checkIsObjectNode(n)){
-        pugi::xml_node inlets = getPatchChildNode(n,"inlets");
-        auto objInlets = inlets.select_nodes("link");
+    std::unordered_map<int,ofxVPXmlObjectNodes>::iterator it = objectsIndex.find(id);
+    if(isMosaicPatch && it != objectsIndex.end()){
+        auto objInlets = it->second.inlets.select_nodes("link");
         if(objInlets.empty()){
             return empty_set;
         }else{
@@ -855,10 +956,9 @@ pugi::xpath_node_set ofxVPXmlEngine::getObjectInlets(int id){
 
 //--------------------------------------------------------------
 pugi::xpath_node_set ofxVPXmlEngine::getObjectOutlets(int id){
-    pugi::xml_node n = getObjectNode(id);
-    if(checkIsObjectNode(n)){
-        pugi::xml_node outlets = getPatchChildNode(n,"outlets");
-        auto objOutlets = outlets.select_nodes("link");
+    std::unordered_map<int,ofxVPXmlObjectNodes>::iterator it = objectsIndex.find(id);
+    if(isMosaicPatch && it != objectsIndex.end()){
+        auto objOutlets = it->second.outlets.select_nodes("link");
         if(objOutlets.empty()){
             return empty_set;
         }else{
@@ -870,27 +970,13 @@ pugi::xpath_node_set ofxVPXmlEngine::getObjectOutlets(int id){
 
 //--------------------------------------------------------------
 pugi::xpath_node_set ofxVPXmlEngine::getObjectLinks(int objid, int outlet_order){
-    pugi::xml_node n = getObjectNode(objid);
-    if(checkIsObjectNode(n)){
-        pugi::xml_node outlets = getPatchChildNode(n,"outlets");
-        auto objOutlets = outlets.select_nodes("link");
-        if(objOutlets.empty()){
+    pugi::xml_node selectedOutlet = getObjectOutletNode(objid,outlet_order);
+    if(selectedOutlet){
+        auto outletLinks = selectedOutlet.select_nodes("to");
+        if(outletLinks.empty()){
             return empty_set;
         }else{
-            int index = 0;
-            for(auto & link: objOutlets){
-                if(index == outlet_order){
-                    pugi::xml_node selectedOutlet = link.node();
-
-                    auto outletLinks = selectedOutlet.select_nodes("to");
-                    if(outletLinks.empty()){
-                        return empty_set;
-                    }else{
-                        return outletLinks;
-                    }
-                }
-                index++;
-            }
+            return outletLinks;
         }
     }
     return empty_set;
@@ -42,6 +42,27 @@ inline TYPE ofxVP_XML_ENGINE_VALUE_CAST(const pugi::char_t* _value){
 }
 
 
+// cached object node handles, to avoid whole document queries on every accessor call
+struct ofxVPXmlObjectNodes{
+    pugi::xml_node  node;
+    pugi::xml_node  inlets;
+    pugi::xml_node  outlets;
+    pugi::xml_node  vars;
+};
+
+// objects lookup benchmark results, all times in microseconds
+struct ofxVPXmlBenchmark{
+    int         numObjects  = 0;
+    int         found       = 0;
+    size_t      links       = 0;
+    uint64_t    buildTime   = 0;
+    uint64_t    saveTime    = 0;
+    uint64_t    loadTime    = 0;
+    uint64_t    indexTime   = 0;
+    uint64_t    lookupTime  = 0;
+    uint64_t    xpathTime   = 0;
+};
+
 // A pugiXml interface engine for ofxVisualProgramming
 class ofxVPXmlEngine{
     
@@ -52,7 +73,9 @@ public:
 
     // LOAD/SAVE
     void loadMosaicPatch(std::string path);
-    void saveMosaicPatch(std::string path);
+    bool saveMosaicPatch(std::string path);
+    void setAutosave(bool as) { autosave = as; }
+    bool getIsMosaicPatch() { return isMosaicPatch; }
 
     // TESTING
     void printTests();
@@ -66,6 +89,7 @@ public:
     void printObject(int id);
     void printPatchConnections();
     void scrambleObjectVars(int id);
+    ofxVPXmlBenchmark benchmarkObjectsLookup(int numObjects, std::string tempPath="", bool verbose=true);
 
     // CHECKS
     bool checkIsMosaicPatch();
@@ -97,6 +121,7 @@ public:
     void removeAllObjectOutletLinks(int objid, int outlet_order);
     void removeAllObjectLinks(int objid);
 
+    bool hasObjectVar(int objid, std::string varName);
     void addObjectVar(int objid, std::string varName, float varValue);
     void setObjectVar(int objid, std::string varName, float varValue);
     void removeObjectVar(int objid, std::string varName);
@@ -111,7 +136,14 @@ public:
     
 
 private:
-    
+
+    void autosavePatch();
+
+    void buildObjectsIndex();
+    void indexObjectNode(pugi::xml_node n);
+    pugi::xml_node getObjectInletNode(int objid, int inlet_order);
+    pugi::xml_node getObjectOutletNode(int objid, int outlet_order);
+
     pugi::xml_node getPatchChildNode(pugi::xml_node parent, std::string name) { assert(isLoaded); return parent.select_node(name.c_str()).node(); }
 
     pugi::xml_node getObjectNode(int id);
@@ -152,10 +184,14 @@ private:
     pugi::xml_node          empty;
     pugi::xpath_node_set    empty_set;
 
+    std::unordered_map<int,ofxVPXmlObjectNodes> objectsIndex;
+    int                     lastObjectID=0;
+
     string                  filepath;
     string                  release;
 
     bool                    isLoaded=false;
     bool                    isMosaicPatch=false;
+    bool                    autosave=true;
 
 };
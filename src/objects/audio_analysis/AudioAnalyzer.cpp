@@ -34,8 +34,6 @@
 
 #include "AudioAnalyzer.h"
 
-int	melBandsEdges[MEL_SCALE_CRITICAL_BANDS] = {100,200,300,400,510,630,770,920,1080,1270,1480,1720,2000,2320,2700,3150,3700,4400,5300,6400,7700,9500,12000,20000};
-
 //--------------------------------------------------------------
 AudioAnalyzer::AudioAnalyzer() : PatchObject("audio analyzer"){
 
@@ -54,9 +52,26 @@ AudioAnalyzer::AudioAnalyzer() : PatchObject("audio analyzer"){
     this->initInletsState();
 
     isAudioOUTObject                = true;
+    isLockFreeAudioObject           = true;
 
     smoothingValue                  = 0.0f;
     audioInputLevel                 = 1.0f;
+    pitchDetector                   = Pitch_Detector_YIN;
+
+    audioParams.level               = audioInputLevel;
+    audioParams.smoothing           = smoothingValue;
+    audioParams.pitchDetector       = pitchDetector;
+    audioParams.windowSize          = 0;
+    audioParams.fftBinSize          = 0;
+    audioParams.active              = false;
+    paramsChannel.reset(audioParams);
+    beatDetected                    = false;
+
+    engineSource                    = nullptr;
+    lastFrameCount                  = 0;
+    lastBeatCount                   = 0;
+
+    analysisFrame                   = ofxVPAnalysisFrame();
 
     startTime                       = ofGetElapsedTimeMillis();
     waitTime                        = 500;
@@ -66,6 +81,19 @@ AudioAnalyzer::AudioAnalyzer() : PatchObject("audio analyzer"){
 
     isLoaded                        = false;
 
+    windowSize                      = 0;
+    hopSize                         = 0;
+    fftBinSize                      = 0;
+
+    melBins.assign(MEL_SCALE_CRITICAL_BANDS,0.0f);
+    _s_melBins.assign(MEL_SCALE_CRITICAL_BANDS,0.0f);
+    rms                             = 0.0f;
+    pitch                           = 0.0f;
+    pitchConfidence                 = 0.0f;
+    bpm                             = 0.0f;
+    _s_rms                          = 0.0f;
+    _s_pitch                        = 0.0f;
+
     this->width     *= 1.3f;
     this->height    *= 2.0f;
 }
@@ -82,12 +110,18 @@ void AudioAnalyzer::newObject(){
 
     this->setCustomVar(static_cast<float>(audioInputLevel),"INPUT_LEVEL");
     this->setCustomVar(static_cast<float>(smoothingValue),"SMOOTHING");
+    this->setCustomVar(0.0f,"WINDOW_SIZE");
+    this->setCustomVar(0.0f,"HOP_SIZE");
+    this->setCustomVar(static_cast<float>(Pitch_Detector_YIN),"PITCH_DETECTOR");
 }
 
 //--------------------------------------------------------------
 void AudioAnalyzer::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     unusedArgs(mainWindow);
 
+    // the outlet vector stays the same object for the whole life of the analyzer
+    getAnalysisRegistry().add(this->_outletParams[0],&analysisFrame);
+
     loadAudioSettings();
 }
 
@@ -106,39 +140,55 @@ void AudioAnalyzer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchO
             loadAudioSettings();
         }
 
-        if(isConnected && ofGetElapsedTimeMillis()-startTime > waitTime){
-            // Get analysis data
-
-
-            bpm     = beatTrack->getEstimatedBPM();
-            beat    = beatTrack->hasBeat();
-
-
-            unique_lock<mutex> lock(audioMutex);
-
-            int index = 0;
-
-
-            index += lastBuffer.getNumFrames();
-            // SPECTRUM
-            for(int i = 0; i < fftBinSize; i++){
-                ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->at(i+index) = _s_spectrum[i];
-            }
+        // shared analysis engine for the connected source ( same source and settings, same engine )
+        if(this->_inletParams[0] != engineSource){
+            engineSource = this->_inletParams[0];
+            engine = getAnalysisService().acquire(engineSource,windowSize,hopSize,sampleRate);
+            engineChannel.getWriteBuffer() = engine;
+            engineChannel.publish();
+        }
 
-            index += fftBinSize;
-            // MEL BANDS
-            for(int i=0;i<MEL_SCALE_CRITICAL_BANDS-1;i++){
-                ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->at(i+index) = _s_melBins[i];
+        if(isConnected && ofGetElapsedTimeMillis()-startTime > waitTime){
+            // Get analysis data ( latest snapshot from the audio thread, no locks )
+            if(analysisChannel.update()){
+                vector<float> *analysisData = ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]);
+                if(analysisChannel.getReadBuffer().size() == analysisData->size()){
+                    // swap the storage, the outlet vector object stays the same
+                    analysisData->swap(analysisChannel.getReadBuffer());
+
+                    // SIGNAL BUFFER
+                    ofxVPDsp::clip(analysisData->data(),plot_data.data(),windowSize);
+
+                    size_t index = windowSize + fftBinSize + MEL_SCALE_CRITICAL_BANDS-1;
+
+                    // BEAT
+                    beat = beatDetected.exchange(false);
+                    analysisData->at(index+3) = static_cast<float>(beat);
+
+                    // structured frame, named views on the same data ( no copies )
+                    analysisFrame.windowSize    = windowSize;
+                    analysisFrame.sampleRate    = sampleRate;
+                    analysisFrame.signal        = { analysisData->data(), static_cast<size_t>(windowSize) };
+                    analysisFrame.spectrum      = { analysisData->data() + windowSize, static_cast<size_t>(fftBinSize) };
+                    analysisFrame.melBands      = { analysisData->data() + windowSize + fftBinSize, static_cast<size_t>(MEL_SCALE_CRITICAL_BANDS-1) };
+                    analysisFrame.rms           = analysisData->at(index);
+                    analysisFrame.pitch         = analysisData->at(index+1);
+                    analysisFrame.bpm           = analysisData->at(index+2);
+                    analysisFrame.beat          = analysisData->at(index+3);
+                    index += 4;
+                    analysisFrame.centroid      = analysisData->at(index);
+                    analysisFrame.flatness      = analysisData->at(index+1);
+                    analysisFrame.flux          = analysisData->at(index+2);
+                    analysisFrame.rolloff       = analysisData->at(index+3);
+                    analysisFrame.onset         = analysisData->at(index+4);
+                    index += SPECTRAL_FEATURES;
+                    analysisFrame.mfcc          = { analysisData->data() + index, static_cast<size_t>(MFCC_COEFFICIENTS) };
+                    analysisFrame.chroma        = { analysisData->data() + index + MFCC_COEFFICIENTS, static_cast<size_t>(CHROMA_BANDS) };
+                    analysisFrame.pitchConfidence = analysisData->at(index + MFCC_COEFFICIENTS + CHROMA_BANDS);
+                    analysisFrame.sequence++;
+                }
             }
 
-            index += MEL_SCALE_CRITICAL_BANDS-1;
-
-            // SINGLE VALUES (RMS, PITCH, BPM, BEAT)
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->at(index) = _s_rms;
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->at(index+1) = _s_pitch;
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->at(index+2) = bpm;
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->at(index+3) = static_cast<float>(beat);
-
         }
     }else{
         isConnected     = false;
@@ -158,8 +208,19 @@ void AudioAnalyzer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchO
         isLoaded = true;
         audioInputLevel = this->getCustomVar("INPUT_LEVEL");
         smoothingValue = this->getCustomVar("SMOOTHING");
+        pitchDetector = ofClamp(static_cast<int>(floor(this->getCustomVar("PITCH_DETECTOR"))),0,Pitch_Detector_COUNT-1);
     }
 
+    // send the parameters to the audio thread
+    AudioAnalyzerParams &params = paramsChannel.getWriteBuffer();
+    params.level        = audioInputLevel;
+    params.smoothing    = smoothingValue;
+    params.pitchDetector = pitchDetector;
+    params.windowSize   = windowSize;
+    params.fftBinSize   = fftBinSize;
+    params.active       = this->inletsConnected[0] && isConnected && ofGetElapsedTimeMillis()-startTime > waitTime;
+    paramsChannel.publish();
+
 }
 
 //--------------------------------------------------------------
@@ -196,7 +257,7 @@ void AudioAnalyzer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
     if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
 
         // draw waveform
-        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImVec2(ImGui::GetWindowSize().x,this->height*0.5f*_nodeCanvas.GetCanvasScale()), plot_data, bufferSize, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor);
+        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImVec2(ImGui::GetWindowSize().x,this->height*0.5f*_nodeCanvas.GetCanvasScale()), plot_data.data(), windowSize, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor);
 
         // draw signal RMS amplitude
         _nodeCanvas.getNodeDrawList()->AddRectFilled(ImGui::GetWindowPos()+ImVec2(0,this->height*0.5f*_nodeCanvas.GetCanvasScale()),ImGui::GetWindowPos()+ImVec2(ImGui::GetWindowSize().x,this->height*0.5f*_nodeCanvas.GetCanvasScale() * (1.0f - ofClamp(ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getRMSAmplitude()*audioInputLevel,0.0,1.0))),IM_COL32(255,255,120,12));
@@ -225,6 +286,48 @@ void AudioAnalyzer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
 
 //--------------------------------------------------------------
 void AudioAnalyzer::drawObjectNodeConfig(){
+    int windowSetting   = static_cast<int>(floor(this->getCustomVar("WINDOW_SIZE")));
+    int hopSetting      = static_cast<int>(floor(this->getCustomVar("HOP_SIZE")));
+
+    ImGui::Spacing();
+    if(ImGui::BeginCombo("Window", windowSetting > 0 ? ofToString(windowSetting).c_str() : "buffer size")){
+        for(int w : {0,256,512,1024,2048,4096}){
+            bool is_selected = (windowSetting == w);
+            if (ImGui::Selectable(w > 0 ? ofToString(w).c_str() : "buffer size", is_selected)){
+                this->setCustomVar(static_cast<float>(w),"WINDOW_SIZE");
+            }
+            if (is_selected) ImGui::SetItemDefaultFocus();
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine(); ImGuiEx::HelpMarker("Analysis window size in samples ( FFT resolution ), independent from the audio device buffer size. Applied on patch reload.");
+
+    if(ImGui::BeginCombo("Hop", hopSetting > 0 ? ofToString(hopSetting).c_str() : "window size")){
+        for(int h : {0,64,128,256,512,1024,2048}){
+            bool is_selected = (hopSetting == h);
+            if (ImGui::Selectable(h > 0 ? ofToString(h).c_str() : "window size", is_selected)){
+                this->setCustomVar(static_cast<float>(h),"HOP_SIZE");
+            }
+            if (is_selected) ImGui::SetItemDefaultFocus();
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine(); ImGuiEx::HelpMarker("Samples between two analysis frames. Applied on patch reload.");
+
+    static const char* pitchDetectors[Pitch_Detector_COUNT] = { "YIN", "MPM", "autocorrelation" };
+    if(ImGui::BeginCombo("Pitch", pitchDetectors[pitchDetector])){
+        for(int d=0;d<Pitch_Detector_COUNT;d++){
+            bool is_selected = (pitchDetector == d);
+            if (ImGui::Selectable(pitchDetectors[d], is_selected)){
+                pitchDetector = d;
+                this->setCustomVar(static_cast<float>(d),"PITCH_DETECTOR");
+            }
+            if (is_selected) ImGui::SetItemDefaultFocus();
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine(); ImGuiEx::HelpMarker("Pitch detection algorithm. YIN and MPM ( McLeod ) are accurate on monophonic sources and report a confidence, autocorrelation is the previous detector.");
+
     ImGuiEx::ObjectInfo(
                 "This object is an audio analysis station which transmits a vector with all the analyzed data. Each type of audio data is available in the different extractor objects inside the same category.",
                 "https://mosaic.d3cod3.org/reference.php?r=audio-analyzer", scaleFactor);
@@ -233,6 +336,13 @@ void AudioAnalyzer::drawObjectNodeConfig(){
 //--------------------------------------------------------------
 void AudioAnalyzer::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
+
+    getAnalysisRegistry().remove(this->_outletParams[0]);
+
+    // release the shared engine ( the service frees it when the last analyzer is gone )
+    engine.reset();
+    engineChannel.getWriteBuffer() = nullptr;
+    engineChannel.publish();
 }
 
 //--------------------------------------------------------------
@@ -241,65 +351,114 @@ void AudioAnalyzer::audioOutObject(ofSoundBuffer &inputBuffer){
 
     if(ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getBuffer().empty()) return;
 
-    if(this->inletsConnected[0] && isConnected && ofGetElapsedTimeMillis()-startTime > waitTime){
+    // get the latest parameters from the main thread
+    if(paramsChannel.update()){
+        audioParams = paramsChannel.getReadBuffer();
+    }
 
-        lastBuffer = *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0]);
+    // get the shared engine from the main thread
+    if(engineChannel.update()){
+        audioEngine = engineChannel.getReadBuffer();
+    }
 
-        lastBuffer *= audioInputLevel;
+    if(audioParams.active && audioEngine){
 
-        for(size_t i = 0; i < lastBuffer.getNumFrames(); i++) {
-            //float sample = lastBuffer.getSample(i,0);
-            plot_data[i] = hardClip(lastBuffer.getSample(i,0));
+        // computed once per block for all the analyzers sharing the engine
+        audioEngine->process(*ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0]),getAudioClock().getBlockIndex());
 
-            // SIGNAL BUFFER
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->at(i) = lastBuffer.getSample(i,0);
+        if(audioEngine->getFrameCount() != lastFrameCount){
+            lastFrameCount = audioEngine->getFrameCount();
+            publishFrame();
         }
+    }
+}
+
+//--------------------------------------------------------------
+void AudioAnalyzer::publishFrame(){
 
-        lastBuffer.copyTo(monoBuffer, lastBuffer.getNumFrames(), 1, 0);
+    int window      = audioParams.windowSize;
+    int bins        = audioParams.fftBinSize;
 
-        // autocorrelation + normalization
-        //doAutoCorrelation(monoBuffer.getBuffer().data());
+    // the engine still runs with the previous settings
+    if(audioEngine->getBinSize() != bins) return;
 
-        memcpy(autoCorrelationNorm, &monoBuffer.getBuffer().data()[0], bufferSize * sizeof(float));
+    // analysis layout changed ( settings reloaded on the main thread ), resize the audio thread buffers
+    if(static_cast<int>(spectrum.size()) != bins){
+        spectrum.assign(bins,0.0f);
+        _s_spectrum.assign(bins,0.0f);
+        std::fill(_s_melBins.begin(),_s_melBins.end(),0.0f);
+        _s_rms      = 0.0f;
+        _s_pitch    = 0.0f;
+    }
+    vector<float> &analysisData = analysisChannel.getWriteBuffer();
+    size_t layoutSize = static_cast<size_t>(window+bins+MEL_SCALE_CRITICAL_BANDS-1+4+AUDIO_EXTENDED_FEATURES);
+    if(analysisData.size() != layoutSize){
+        analysisData.assign(layoutSize,0.0f);
+    }
 
+    // engine results are at unity gain, apply this analyzer input level
+    float level = audioParams.level;
 
-        // get volume
-        detectRMS();
+    // SIGNAL BUFFER
+    ofxVPDsp::scale(audioEngine->getSignal(), analysisData.data(), level, window);
 
-        // get pitch
-        detectPitch();
+    ofxVPDsp::scale(audioEngine->getSpectrum(), spectrum.data(), level, bins);
+    ofxVPDsp::scale(audioEngine->getMelBands(), melBins.data(), level, MEL_SCALE_CRITICAL_BANDS-1);
 
-        // FFT Analyze Audio
-        fft->setSignal(autoCorrelationNorm);
-        memcpy(spectrum, fft->getAmplitude(), sizeof(float) * fftBinSize);
+    rms     = ofClamp(audioEngine->getRMS()*level,0.0,1.0);
+    pitch   = audioEngine->getPitch(audioParams.pitchDetector);
+    pitchConfidence = audioEngine->getPitchConfidence(audioParams.pitchDetector);
+    bpm     = audioEngine->getBPM();
 
-        fft_StrongestBinValue	= 0.0f;
+    if(audioEngine->getBeatCount() != lastBeatCount){
+        lastBeatCount = audioEngine->getBeatCount();
+        beatDetected = true;
+    }
 
-        for(unsigned int j=0;j<MEL_SCALE_CRITICAL_BANDS-1;j++){
-            melBins[j] = 0.0f;
-        }
+    smoothingValues();
 
-        for(int i = 0; i < fftBinSize; i++){
-            // storing strongest bin for pitch detection
-            if(spectrum[i] > fft_StrongestBinValue){
-                fft_StrongestBinValue = spectrum[i];
-                fft_StrongestBinIndex = i;
-            }
-            // calculate Mel scale bins from fft bins
-            updateMelScale(i);
-        }
+    int index = window;
+    // SPECTRUM
+    memcpy(analysisData.data()+index, _s_spectrum.data(), bins * sizeof(float));
 
-        fft->setPolar(spectrum, fft->getPhase());
-        fft->clampSignal();
+    index += bins;
+    // MEL BANDS
+    memcpy(analysisData.data()+index, _s_melBins.data(), (MEL_SCALE_CRITICAL_BANDS-1) * sizeof(float));
 
-        smoothingValues();
+    index += MEL_SCALE_CRITICAL_BANDS-1;
 
-        // BTrack (BPM and Beat tracker)
-        beatTrack->audioIn(&monoBuffer.getBuffer()[0], bufferSize, 1);
+    // SINGLE VALUES (RMS, PITCH, BPM, BEAT)
+    analysisData.at(index) = _s_rms;
+    analysisData.at(index+1) = _s_pitch;
+    analysisData.at(index+2) = bpm;
+    analysisData.at(index+3) = 0.0f; // beat is set on the main thread
 
-        unique_lock<mutex> lock(audioMutex);
-        lastBuffer = monoBuffer;
+    index += 4;
+
+    // SPECTRAL FEATURES (CENTROID, FLATNESS, FLUX, ROLLOFF, ONSET), flux and onset scale with the level
+    const ofxVPAudioFeatures &features = audioEngine->getFeatures();
+    analysisData.at(index) = features.getCentroid();
+    analysisData.at(index+1) = features.getFlatness();
+    analysisData.at(index+2) = features.getFlux()*level;
+    analysisData.at(index+3) = features.getRolloff();
+    analysisData.at(index+4) = features.getOnset()*level;
+
+    index += SPECTRAL_FEATURES;
+    // MFCC, the level only shifts the first coefficient ( log of the mel bands )
+    memcpy(analysisData.data()+index, features.getMFCC(), MFCC_COEFFICIENTS * sizeof(float));
+    if(level > 0.0f){
+        analysisData.at(index) += std::log(level)*std::sqrt(static_cast<float>(MEL_SCALE_CRITICAL_BANDS-1));
     }
+
+    index += MFCC_COEFFICIENTS;
+    // CHROMA
+    memcpy(analysisData.data()+index, features.getChroma(), CHROMA_BANDS * sizeof(float));
+
+    index += CHROMA_BANDS;
+    // PITCH CONFIDENCE
+    analysisData.at(index) = pitchConfidence;
+
+    analysisChannel.publish();
 }
 
 //--------------------------------------------------------------
@@ -317,164 +476,42 @@ void AudioAnalyzer::loadAudioSettings(){
             XML.popTag();
         }
 
-        // Beat Tracking
-        beatTrack = new ofxBTrack();
-        beatTrack->setup(bufferSize);
-        beatTrack->setConfidentThreshold(0.35);
-
-        // Audio Analysis
-        fft = ofxFft::create(bufferSize, OF_FFT_WINDOW_HAMMING);
+        // analysis window and hop, independent from the device buffer size ( 0 = device buffer size )
+        windowSize  = static_cast<int>(floor(this->getCustomVar("WINDOW_SIZE")));
+        hopSize     = static_cast<int>(floor(this->getCustomVar("HOP_SIZE")));
+        if(windowSize <= 0) windowSize = bufferSize;
+        if(hopSize <= 0 || hopSize > windowSize) hopSize = windowSize;
 
-        fftBinSize              = fft->getBinSize();
-        fft_binSizeHz           = ((sampleRate/2)/(fftBinSize-1));
-        fft_StrongestBinValue   = 0.0f;
-        fft_StrongestBinIndex	= 0;
-        fft_pitchBin			= 0;
+        // fft bins of the shared engine ( window/2 + 1 )
+        fftBinSize              = windowSize/2 + 1;
 
-        autoCorrelation			= new float[bufferSize];
-        autoCorrelationNorm		= new float[bufferSize];
-        spectrum                = new float[fftBinSize];
-        binsToMel               = new int[fftBinSize];
-        melBins                 = new float[MEL_SCALE_CRITICAL_BANDS];
-
-        _s_spectrum            = new float[fftBinSize];
-        _s_melBins             = new float[MEL_SCALE_CRITICAL_BANDS];
-
-
-        rms                     = 0.0f;
-        pitch                   = 0.0f;
-        _s_rms                  = 0.0f;
-        _s_pitch                = 0.0f;
-
-        setupMelScale();
+        // engine settings changed, acquire it again on the next update
+        engineSource            = nullptr;
 
         audioInputLevel = this->getCustomVar("INPUT_LEVEL");
         smoothingValue  = this->getCustomVar("SMOOTHING");
-
-        _outletParams[0] = new vector<float>();
-        // SIGNAL BUFFER
-        plot_data = new float[bufferSize];
-        for(int i=0;i<bufferSize;i++){
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->push_back(0.0f);
-            plot_data[i] = 0.0f;
-        }
-        // SPECTRUM
-        for(int i=0;i<fftBinSize;i++){
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->push_back(0.0f);
-        }
-
-        // MEL BANDS
-        for(int i=0;i<MEL_SCALE_CRITICAL_BANDS-1;i++){
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->push_back(0.0f);
-        }
-
-        // SINGLE VALUES (RMS, PITCH, BPM, BEAT)
-        for(int i=0;i<4;i++){
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->push_back(0.0f);
-        }
-    }
-}
-
-//--------------------------------------------------------------
-void AudioAnalyzer::doAutoCorrelation(float* signal){
-
-    float sum;
-    std::vector<float> autoCorrelationResults(bufferSize);
-
-    for (int i = 0; i < bufferSize; i++) {
-        sum = 0;
-        for (int j = 0; j < bufferSize-i; j++) {
-            sum += signal[j]*signal[j+i];
-        }
-        autoCorrelationResults[i]=sum;
-
-    }
-
-    memcpy(autoCorrelation, &autoCorrelationResults[0], bufferSize * sizeof(float));
-
-    float maxValue = 0;
-
-    for (int i=0;i<bufferSize;i++) {
-        if (fabs(autoCorrelationResults[i]) > maxValue){
-            maxValue = fabs(autoCorrelationResults[i]);
-        }
-    }
-
-    if (maxValue > 0){
-        for(int i=0;i<bufferSize;i++) {
-            autoCorrelationResults[i] /= maxValue;
-        }
-    }
-
-    memcpy(autoCorrelationNorm, &autoCorrelationResults[0], bufferSize * sizeof(float));
-
-}
-
-//--------------------------------------------------------------
-void AudioAnalyzer::detectRMS(){
-    /*for (int i = 0; i < bufferSize; i++) {
-        rms += abs(autoCorrelation[i]);
-    }
-    rms /= bufferSize;*/
-
-    rms = ofClamp(ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getRMSAmplitude()*audioInputLevel,0.0,1.0);
-}
-
-//--------------------------------------------------------------
-void AudioAnalyzer::detectPitch(){
-    pitch = (fft_StrongestBinIndex*fft_binSizeHz) + (fft_binSizeHz/2.0f);
-
-    fft_pitchBin = pitch * fftBinSize /(sampleRate / 2);
-}
-
-//--------------------------------------------------------------
-void AudioAnalyzer::setupMelScale(){
-    // setup Mel scale reduction (it depends on samplerate and buffersize)
-    // first bin is the 0 Hz component (a constant DC offset to the signal), we do not consider it
-    int tempFreq = 0;
-    for(unsigned int j=0;j<MEL_SCALE_CRITICAL_BANDS-1;j++){
-        melBins[j]	   = 0.0f;
-        for(int i = 0; i < fftBinSize; i++){
-            tempFreq = (int)((i*fft_binSizeHz) + (fft_binSizeHz/2.0f));
-            if(j == 0){
-                if(tempFreq <= melBandsEdges[j]){
-                    binsToMel[i] = j;
-                }else{
-                    i = fftBinSize;
-                }
-            }else if(j > 0){
-                if(tempFreq > melBandsEdges[j-1] && tempFreq <= melBandsEdges[j]){
-                    binsToMel[i] = j;
-                }
-            }
-        }
-    }
-    binsToMel[fft->getBinSize()-1] = 23;
-}
-
-//--------------------------------------------------------------
-void AudioAnalyzer::updateMelScale(int i){
-    for(int j=0;j<MEL_SCALE_CRITICAL_BANDS-1;j++){
-        if(binsToMel[i] == j){
-            melBins[j] += spectrum[i];
-        }
+        pitchDetector   = ofClamp(static_cast<int>(floor(this->getCustomVar("PITCH_DETECTOR"))),0,Pitch_Detector_COUNT-1);
+
+        // new layout, resized in place ( the audio thread resizes its own snapshots from the published params,
+        // the snapshots of the old layout are skipped until then )
+        analysisFrame = ofxVPAnalysisFrame();
+        plot_data.assign(windowSize,0.0f);
+        // SIGNAL BUFFER, SPECTRUM, MEL BANDS, SINGLE VALUES (RMS, PITCH, BPM, BEAT), SPECTRAL FEATURES, MFCC, CHROMA, PITCH CONFIDENCE
+        ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->assign(static_cast<size_t>(windowSize+fftBinSize+MEL_SCALE_CRITICAL_BANDS-1+4+AUDIO_EXTENDED_FEATURES),0.0f);
     }
 }
 
 //--------------------------------------------------------------
 void AudioAnalyzer::smoothingValues(){
+    float smoothing = audioParams.smoothing;
     // volume detection
-    _s_rms = _s_rms*smoothingValue + (1.0-smoothingValue)*rms;
+    _s_rms = _s_rms*smoothing + (1.0-smoothing)*rms;
     // pitch detection
-    _s_pitch = _s_pitch*smoothingValue + (1.0-smoothingValue)*pitch;
+    _s_pitch = _s_pitch*smoothing + (1.0-smoothing)*pitch;
     // fft spectrum
-    for(int i=0;i<fftBinSize;i++){
-        _s_spectrum[i] = _s_spectrum[i]*smoothingValue + (1.0-smoothingValue)*spectrum[i];
-    }
+    ofxVPDsp::smooth(_s_spectrum.data(),spectrum.data(),smoothing,spectrum.size());
     // bark scale bins
-    for(int i=0;i<MEL_SCALE_CRITICAL_BANDS-1;i++){
-        _s_melBins[i] = _s_melBins[i]*smoothingValue + (1.0-smoothingValue)*melBins[i];
-    }
+    ofxVPDsp::smooth(_s_melBins.data(),melBins.data(),smoothing,MEL_SCALE_CRITICAL_BANDS-1);
 }
 
 
@@ -35,14 +35,23 @@
 #pragma once
 
 #include "PatchObject.h"
-
-#include "ofxFft.h"
-#include "ofxBTrack.h"
+#include "ofxVPTripleBuffer.h"
+#include "ofxVPAnalysisFrame.h"
+#include "ofxVPAnalysisEngine.h"
 
 #include "imgui_plot.h"
 #include "imgui-knobs.h"
 
 
+struct AudioAnalyzerParams{
+    float   level;
+    float   smoothing;
+    int     pitchDetector;
+    int     windowSize;     // analysis data layout
+    int     fftBinSize;
+    bool    active;         // connected, and past the connection wait time
+};
+
 class AudioAnalyzer : public PatchObject {
 
 public:
@@ -63,11 +72,7 @@ public:
     void            audioOutObject(ofSoundBuffer &inputBuffer) override;
 
     void            loadAudioSettings();
-    void            doAutoCorrelation(float* signal);
-    void            detectRMS();
-    void            detectPitch();
-    void            setupMelScale();
-    void            updateMelScale(int i);
+    void            publishFrame();
 
     void            smoothingValues();
 
@@ -76,37 +81,38 @@ public:
     float                                   smoothingValue;
     float                                   audioInputLevel;
 
-    // Audio Input Signal variables
-    ofSoundBuffer                           lastBuffer;
-    ofSoundBuffer                           monoBuffer;
-    std::mutex                              audioMutex;
-
-    // Analysis variables
-    ofxFft                                  *fft;
-    ofxBTrack                               *beatTrack;
+    // Shared analysis ( one engine for every analyzer on the same source with the same settings )
+    std::shared_ptr<ofxVPAnalysisEngine>                    engine;             // main thread reference
+    ofxVPTripleBuffer<std::shared_ptr<ofxVPAnalysisEngine>> engineChannel;      // control -> audio
+    std::shared_ptr<ofxVPAnalysisEngine>                    audioEngine;        // audio thread reference
+    void                                    *engineSource;
+    uint64_t                                lastFrameCount;
+    uint64_t                                lastBeatCount;
 
-    float                                   *plot_data;
+    // Lock-free channels between the audio thread and the main thread
+    ofxVPTripleBuffer<vector<float>>        analysisChannel;    // audio -> control, analysis data
+    ofxVPTripleBuffer<AudioAnalyzerParams>  paramsChannel;      // control -> audio, level, smoothing, pitch detector and data layout
+    AudioAnalyzerParams                     audioParams;        // audio thread copy of the parameters
+    std::atomic<bool>                       beatDetected;
 
-    float                                   *spectrum;
-    float                                   *melBins;
-    float                                   *autoCorrelation;
-    float                                   *autoCorrelationNorm;
-    int                                     *binsToMel;
+    // Structured view on the analysis data outlet ( read by the extractors )
+    ofxVPAnalysisFrame                      analysisFrame;
 
-    float                                   fft_binSizeHz;
-    int                                     fft_StrongestBinIndex;
-    float                                   fft_StrongestBinValue;
-    int                                     fft_pitchBin;
+    vector<float>                           plot_data;
 
+    // Analysis variables ( audio thread, engine results at the input level )
+    vector<float>                           spectrum;
+    vector<float>                           melBins;
 
     float                                   rms;
     float                                   pitch;
+    float                                   pitchConfidence;
     float                                   bpm;
     bool                                    beat;
 
 
-    float                                   *_s_spectrum;
-    float                                   *_s_melBins;
+    vector<float>                           _s_spectrum;
+    vector<float>                           _s_melBins;
     float                                   _s_rms;
     float                                   _s_pitch;
 
@@ -119,6 +125,9 @@ public:
 
     // Object vars
     int                                     bufferSize;
+    int                                     windowSize;
+    int                                     hopSize;
+    int                                     pitchDetector;
     int                                     sampleRate;
     bool                                    newConnection;
     size_t                                  waitTime;
@@ -0,0 +1,176 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#ifndef OFXVP_BUILD_WITH_MINIMAL_OBJECTS
+
+#include "ChromaExtractor.h"
+
+//--------------------------------------------------------------
+ChromaExtractor::ChromaExtractor() : PatchObject("chroma extractor"){
+
+    this->numInlets  = 1;
+    this->numOutlets = 1;
+
+    _inletParams[0] = new vector<float>();  // RAW Data
+
+    _outletParams[0] = new vector<float>();  // CHROMA Data
+
+    this->initInletsState();
+
+    analysisSource      = nullptr;
+    analysisFrame       = nullptr;
+    lastSequence        = 0;
+
+    this->setIsThreadSafeObj(true);
+}
+
+//--------------------------------------------------------------
+void ChromaExtractor::newObject(){
+    PatchObject::setName( this->objectName );
+
+    this->addInlet(VP_LINK_ARRAY,"data");
+
+    this->addOutlet(VP_LINK_ARRAY,"chroma");
+}
+
+//--------------------------------------------------------------
+void ChromaExtractor::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
+    unusedArgs(mainWindow);
+
+    // INIT CHROMA BUFFER
+    for(int i=0;i<CHROMA_BANDS;i++){
+        ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->push_back(0.0f);
+    }
+
+}
+
+//--------------------------------------------------------------
+void ChromaExtractor::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
+    unusedArgs(patchObjects);
+
+    // structured analysis frame of the source analyzer ( looked up only when the link changes )
+    if(this->inletsConnected[0]){
+        if(this->_inletParams[0] != analysisSource){
+            analysisSource  = this->_inletParams[0];
+            analysisFrame   = getAnalysisRegistry().find(analysisSource);
+            lastSequence    = 0;
+        }
+    }else{
+        analysisSource  = nullptr;
+        analysisFrame   = nullptr;
+    }
+
+    vector<float> *chromaData = ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]);
+
+    if(analysisFrame != nullptr){
+        // new analysis only
+        if(analysisFrame->sequence != lastSequence){
+            lastSequence = analysisFrame->sequence;
+            for(size_t i=0;i<analysisFrame->chroma.size && i<chromaData->size();i++){
+                chromaData->at(i) = analysisFrame->chroma[i];
+            }
+        }
+    }else if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
+        // packed analysis data ( file to data ), layout from the data size
+        vector<float> *data = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0]);
+        int position = analysisFeaturesFromDataSize(data->size());
+        if(position < 0){
+            if(analysisWindowFromDataSize(data->size()) > 0){
+                ofLog(OF_LOG_ERROR,"%s --> This audio analysis data has no spectral features ( saved with an older version )",this->getName().c_str());
+            }else{
+                ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer object ONLY! Just reconnect it right!",this->getName().c_str());
+            }
+        }else{
+            for(int i=0;i<CHROMA_BANDS && i<static_cast<int>(chromaData->size());i++){
+                chromaData->at(i) = data->at(position+SPECTRAL_FEATURES+MFCC_COEFFICIENTS+i);
+            }
+        }
+    }
+
+}
+
+//--------------------------------------------------------------
+void ChromaExtractor::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer){
+    unusedArgs(font,glRenderer);
+
+    ofSetColor(255);
+
+}
+
+//--------------------------------------------------------------
+void ChromaExtractor::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
+
+    // CONFIG GUI inside Menu
+    if(_nodeCanvas.BeginNodeMenu()){
+
+        ImGui::Separator();
+        ImGui::Separator();
+        ImGui::Separator();
+
+        if (ImGui::BeginMenu("CONFIG"))
+        {
+
+            drawObjectNodeConfig(); this->configMenuWidth = ImGui::GetWindowWidth();
+
+
+            ImGui::EndMenu();
+        }
+
+        _nodeCanvas.EndNodeMenu();
+    }
+
+    // Visualize (Object main view)
+    if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
+
+        // draw CHROMA
+        ImGuiEx::PlotBands(_nodeCanvas.getNodeDrawList(), 0, (this->height*_nodeCanvas.GetCanvasScale()) - (26*this->scaleFactor), ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]));
+
+        _nodeCanvas.EndNodeContent();
+    }
+
+}
+
+//--------------------------------------------------------------
+void ChromaExtractor::drawObjectNodeConfig(){
+    ImGuiEx::ObjectInfo(
+                "Extracts the 12 chroma bands (pitch classes from C to B, between 0.0 and 1.0) from the audio analysis data vector, the harmonic content of the sound.",
+                "https://mosaic.d3cod3.org/reference.php?r=chroma-extractor", scaleFactor);
+}
+
+//--------------------------------------------------------------
+void ChromaExtractor::removeObjectContent(bool removeFileFromData){
+    unusedArgs(removeFileFromData);
+}
+
+OBJECT_REGISTER( ChromaExtractor , "chroma extractor", OFXVP_OBJECT_CAT_AUDIOANALYSIS)
+
+#endif
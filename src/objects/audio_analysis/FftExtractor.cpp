@@ -48,13 +48,16 @@ FftExtractor::FftExtractor() : PatchObject("fft extractor"){
 
     multiplier          = 1.0f;
 
-    isNewConnection     = false;
-    isConnectionRight   = false;
+    analysisSource      = nullptr;
+    analysisFrame       = nullptr;
+    lastSequence        = 0;
 
     this->width         *= 2.0f;
 
     loaded              = false;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -95,38 +98,49 @@ void FftExtractor::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
 //--------------------------------------------------------------
 void FftExtractor::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
+    unusedArgs(patchObjects);
 
+    // structured analysis frame of the source analyzer ( looked up only when the link changes )
     if(this->inletsConnected[0]){
-        if(!isNewConnection){
-            isNewConnection = true;
-            for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-                if(it->second != nullptr){
-                    if(patchObjects[it->first] != nullptr && it->first != this->getId() && !patchObjects[it->first]->getWillErase()){
-                        for(int o=0;o<static_cast<int>(it->second->outPut.size());o++){
-                            if(!it->second->outPut[o]->isDisabled && it->second->outPut[o]->toObjectID == this->getId()){
-                                if(it->second->getName() == "audio analyzer" || it->second->getName() == "file to data"){
-                                    isConnectionRight = true;
-                                }
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
+        if(this->_inletParams[0] != analysisSource){
+            analysisSource  = this->_inletParams[0];
+            analysisFrame   = getAnalysisRegistry().find(analysisSource);
+            lastSequence    = 0;
         }
     }else{
-        isNewConnection = false;
-        isConnectionRight = false;
+        analysisSource  = nullptr;
+        analysisFrame   = nullptr;
     }
 
-    if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty() && isConnectionRight){
-        int index = 0;
-        for(int i=bufferSize;i<bufferSize + spectrumSize;i++){
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->at(index) = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->at(i)*multiplier;
-            index++;
+    if(analysisFrame != nullptr){
+        // new analysis only
+        if(analysisFrame->sequence != lastSequence){
+            lastSequence = analysisFrame->sequence;
+            vector<float> *fftData = ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]);
+            if(fftData->size() != analysisFrame->spectrum.size){
+                fftData->assign(analysisFrame->spectrum.size,0.0f);
+            }
+            for(size_t i=0;i<analysisFrame->spectrum.size;i++){
+                fftData->at(i) = analysisFrame->spectrum[i]*multiplier;
+            }
+        }
+    }else if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
+        // packed analysis data ( file to data ), layout from the data size
+        int window = analysisWindowFromDataSize(ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->size());
+        if(window == 0){
+            ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer, or file data, objects ONLY! Just reconnect it right!",this->getName().c_str());
+        }else{
+            if(window != bufferSize){
+                bufferSize      = window;
+                spectrumSize    = (bufferSize/2) + 1;
+                ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->assign(spectrumSize,0.0f);
+            }
+            int index = 0;
+            for(int i=bufferSize;i<bufferSize + spectrumSize;i++){
+                ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->at(index) = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->at(i)*multiplier;
+                index++;
+            }
         }
-    }else if(this->inletsConnected[0] && !isConnectionRight){
-        ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer, or file data, objects ONLY! Just reconnect it right!",this->getName().c_str());
     }
 
     if(!loaded){
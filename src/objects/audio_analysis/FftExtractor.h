@@ -35,6 +35,7 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPAnalysisFrame.h"
 
 #include "imgui_plot.h"
 
@@ -59,8 +60,9 @@ public:
     int             bufferSize;
     int             spectrumSize;
 
-    bool            isNewConnection;
-    bool            isConnectionRight;
+    void            *analysisSource;
+    const ofxVPAnalysisFrame *analysisFrame;
+    uint64_t        lastSequence;
 
     bool            loaded;
 
@@ -0,0 +1,185 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#ifndef OFXVP_BUILD_WITH_MINIMAL_OBJECTS
+
+#include "MFCCExtractor.h"
+
+//--------------------------------------------------------------
+MFCCExtractor::MFCCExtractor() : PatchObject("mfcc extractor"){
+
+    this->numInlets  = 1;
+    this->numOutlets = 1;
+
+    _inletParams[0] = new vector<float>();  // RAW Data
+
+    _outletParams[0] = new vector<float>();  // MFCC Data
+
+    this->initInletsState();
+
+    analysisSource      = nullptr;
+    analysisFrame       = nullptr;
+    lastSequence        = 0;
+
+    this->setIsThreadSafeObj(true);
+}
+
+//--------------------------------------------------------------
+void MFCCExtractor::newObject(){
+    PatchObject::setName( this->objectName );
+
+    this->addInlet(VP_LINK_ARRAY,"data");
+
+    this->addOutlet(VP_LINK_ARRAY,"mfcc");
+}
+
+//--------------------------------------------------------------
+void MFCCExtractor::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
+    unusedArgs(mainWindow);
+
+    // INIT MFCC BUFFER
+    for(int i=0;i<MFCC_COEFFICIENTS;i++){
+        ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->push_back(0.0f);
+        plot_data.push_back(0.0f);
+    }
+
+}
+
+//--------------------------------------------------------------
+void MFCCExtractor::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
+    unusedArgs(patchObjects);
+
+    // structured analysis frame of the source analyzer ( looked up only when the link changes )
+    if(this->inletsConnected[0]){
+        if(this->_inletParams[0] != analysisSource){
+            analysisSource  = this->_inletParams[0];
+            analysisFrame   = getAnalysisRegistry().find(analysisSource);
+            lastSequence    = 0;
+        }
+    }else{
+        analysisSource  = nullptr;
+        analysisFrame   = nullptr;
+    }
+
+    vector<float> *mfccData = ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]);
+
+    if(analysisFrame != nullptr){
+        // new analysis only
+        if(analysisFrame->sequence != lastSequence){
+            lastSequence = analysisFrame->sequence;
+            for(size_t i=0;i<analysisFrame->mfcc.size && i<mfccData->size();i++){
+                mfccData->at(i) = analysisFrame->mfcc[i];
+            }
+        }
+    }else if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
+        // packed analysis data ( file to data ), layout from the data size
+        vector<float> *data = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0]);
+        int position = analysisFeaturesFromDataSize(data->size());
+        if(position < 0){
+            if(analysisWindowFromDataSize(data->size()) > 0){
+                ofLog(OF_LOG_ERROR,"%s --> This audio analysis data has no spectral features ( saved with an older version )",this->getName().c_str());
+            }else{
+                ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer object ONLY! Just reconnect it right!",this->getName().c_str());
+            }
+        }else{
+            for(int i=0;i<MFCC_COEFFICIENTS && i<static_cast<int>(mfccData->size());i++){
+                mfccData->at(i) = data->at(position+SPECTRAL_FEATURES+i);
+            }
+        }
+    }
+
+}
+
+//--------------------------------------------------------------
+void MFCCExtractor::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer){
+    unusedArgs(font,glRenderer);
+
+    ofSetColor(255);
+
+}
+
+//--------------------------------------------------------------
+void MFCCExtractor::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
+
+    // CONFIG GUI inside Menu
+    if(_nodeCanvas.BeginNodeMenu()){
+
+        ImGui::Separator();
+        ImGui::Separator();
+        ImGui::Separator();
+
+        if (ImGui::BeginMenu("CONFIG"))
+        {
+
+            drawObjectNodeConfig(); this->configMenuWidth = ImGui::GetWindowWidth();
+
+
+            ImGui::EndMenu();
+        }
+
+        _nodeCanvas.EndNodeMenu();
+    }
+
+    // Visualize (Object main view)
+    if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
+
+        // draw MFCC ( normalized magnitude )
+        vector<float> *mfccData = ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]);
+        float maxValue = 0.0f;
+        for(size_t i=0;i<mfccData->size();i++){
+            maxValue = std::max(maxValue,fabsf(mfccData->at(i)));
+        }
+        for(size_t i=0;i<mfccData->size() && i<plot_data.size();i++){
+            plot_data[i] = maxValue > 0.0f ? fabsf(mfccData->at(i))/maxValue : 0.0f;
+        }
+        ImGuiEx::PlotBands(_nodeCanvas.getNodeDrawList(), 0, (this->height*_nodeCanvas.GetCanvasScale()) - (26*this->scaleFactor), &plot_data);
+
+        _nodeCanvas.EndNodeContent();
+    }
+
+}
+
+//--------------------------------------------------------------
+void MFCCExtractor::drawObjectNodeConfig(){
+    ImGuiEx::ObjectInfo(
+                "Extracts the 13 MFCC (Mel Frequency Cepstral Coefficients) from the audio analysis data vector, a compact description of the timbre of the sound.",
+                "https://mosaic.d3cod3.org/reference.php?r=mfcc-extractor", scaleFactor);
+}
+
+//--------------------------------------------------------------
+void MFCCExtractor::removeObjectContent(bool removeFileFromData){
+    unusedArgs(removeFileFromData);
+}
+
+OBJECT_REGISTER( MFCCExtractor , "mfcc extractor", OFXVP_OBJECT_CAT_AUDIOANALYSIS)
+
+#endif
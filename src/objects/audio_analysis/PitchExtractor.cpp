@@ -38,17 +38,23 @@
 PitchExtractor::PitchExtractor() : PatchObject("pitch extractor"){
 
     this->numInlets  = 1;
-    this->numOutlets = 1;
+    this->numOutlets = 2;
 
     _inletParams[0] = new vector<float>();  // RAW Data
 
     _outletParams[0] = new float(); // Pitch
     *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0.0f;
 
+    _outletParams[1] = new float(); // Confidence
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = 0.0f;
+
     this->initInletsState();
 
-    isNewConnection   = false;
-    isConnectionRight = false;
+    analysisSource      = nullptr;
+    analysisFrame       = nullptr;
+    lastSequence        = 0;
+
+    this->setIsThreadSafeObj(true);
 }
 
 //--------------------------------------------------------------
@@ -58,6 +64,7 @@ void PitchExtractor::newObject(){
     this->addInlet(VP_LINK_ARRAY,"data");
 
     this->addOutlet(VP_LINK_NUMERIC,"pitch");
+    this->addOutlet(VP_LINK_NUMERIC,"confidence");
 }
 
 //--------------------------------------------------------------
@@ -83,33 +90,45 @@ void PitchExtractor::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow)
 
 //--------------------------------------------------------------
 void PitchExtractor::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
+    unusedArgs(patchObjects);
+
+    // structured analysis frame of the source analyzer ( looked up only when the link changes )
     if(this->inletsConnected[0]){
-        if(!isNewConnection){
-            isNewConnection = true;
-            for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-                if(it->second != nullptr){
-                    if(patchObjects[it->first] != nullptr && it->first != this->getId() && !patchObjects[it->first]->getWillErase()){
-                        for(int o=0;o<static_cast<int>(it->second->outPut.size());o++){
-                            if(!it->second->outPut[o]->isDisabled && it->second->outPut[o]->toObjectID == this->getId()){
-                                if(it->second->getName() == "audio analyzer" || it->second->getName() == "file to data"){
-                                    isConnectionRight = true;
-                                }
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
+        if(this->_inletParams[0] != analysisSource){
+            analysisSource  = this->_inletParams[0];
+            analysisFrame   = getAnalysisRegistry().find(analysisSource);
+            lastSequence    = 0;
         }
     }else{
-        isNewConnection = false;
-        isConnectionRight = false;
+        analysisSource  = nullptr;
+        analysisFrame   = nullptr;
     }
 
-    if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty() && isConnectionRight){
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->at(arrayPosition);
-    }else if(this->inletsConnected[0] && !isConnectionRight){
-        ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer object ONLY! Just reconnect it right!",this->getName().c_str());
+    if(analysisFrame != nullptr){
+        // new analysis only
+        if(analysisFrame->sequence != lastSequence){
+            lastSequence = analysisFrame->sequence;
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = analysisFrame->pitch;
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = analysisFrame->pitchConfidence;
+        }
+    }else if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
+        // packed analysis data ( file to data ), layout from the data size
+        vector<float> *analysisData = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0]);
+        int window = analysisWindowFromDataSize(analysisData->size());
+        if(window == 0){
+            ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer object ONLY! Just reconnect it right!",this->getName().c_str());
+        }else{
+            if(window != bufferSize){
+                bufferSize      = window;
+                spectrumSize    = (bufferSize/2) + 1;
+                arrayPosition   = bufferSize + spectrumSize + MEL_SCALE_CRITICAL_BANDS;
+            }
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = analysisData->at(arrayPosition);
+
+            // confidence after the chroma ( 0 for analysis data saved without the extended features )
+            int featuresPosition = analysisFeaturesFromDataSize(analysisData->size());
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = featuresPosition >= 0 ? analysisData->at(featuresPosition+SPECTRAL_FEATURES+MFCC_COEFFICIENTS+CHROMA_BANDS) : 0.0f;
+        }
     }
 
 }
@@ -154,7 +173,7 @@ void PitchExtractor::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
 //--------------------------------------------------------------
 void PitchExtractor::drawObjectNodeConfig(){
     ImGuiEx::ObjectInfo(
-                "Extracts the pitch data of the audio signal as a float value (between 0.0 and 4186.0).",
+                "Extracts the pitch data of the audio signal as a float value (between 0.0 and 4186.0), and the confidence of the detection (between 0.0 and 1.0). Unvoiced frames keep the last detected pitch, the pitch detector is selected in the audio analyzer.",
                 "https://mosaic.d3cod3.org/reference.php?r=pitch-extractor", scaleFactor);
 }
 
@@ -47,8 +47,11 @@ RMSExtractor::RMSExtractor() : PatchObject("rms extractor"){
 
     this->initInletsState();
 
-    isNewConnection   = false;
-    isConnectionRight = false;
+    analysisSource      = nullptr;
+    analysisFrame       = nullptr;
+    lastSequence        = 0;
+
+    this->setIsThreadSafeObj(true);
 }
 
 //--------------------------------------------------------------
@@ -83,33 +86,39 @@ void RMSExtractor::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
 //--------------------------------------------------------------
 void RMSExtractor::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
+    unusedArgs(patchObjects);
+
+    // structured analysis frame of the source analyzer ( looked up only when the link changes )
     if(this->inletsConnected[0]){
-        if(!isNewConnection){
-            isNewConnection = true;
-            for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-                if(it->second != nullptr){
-                    if(patchObjects[it->first] != nullptr && it->first != this->getId() && !patchObjects[it->first]->getWillErase()){
-                        for(int o=0;o<static_cast<int>(it->second->outPut.size());o++){
-                            if(!it->second->outPut[o]->isDisabled && it->second->outPut[o]->toObjectID == this->getId()){
-                                if(it->second->getName() == "audio analyzer" || it->second->getName() == "file to data"){
-                                    isConnectionRight = true;
-                                }
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
+        if(this->_inletParams[0] != analysisSource){
+            analysisSource  = this->_inletParams[0];
+            analysisFrame   = getAnalysisRegistry().find(analysisSource);
+            lastSequence    = 0;
         }
     }else{
-        isNewConnection = false;
-        isConnectionRight = false;
+        analysisSource  = nullptr;
+        analysisFrame   = nullptr;
     }
 
-    if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty() && isConnectionRight){
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->at(arrayPosition);
-    }else if(this->inletsConnected[0] && !isConnectionRight){
-        ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer object ONLY! Just reconnect it right!",this->getName().c_str());
+    if(analysisFrame != nullptr){
+        // new analysis only
+        if(analysisFrame->sequence != lastSequence){
+            lastSequence = analysisFrame->sequence;
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = analysisFrame->rms;
+        }
+    }else if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
+        // packed analysis data ( file to data ), layout from the data size
+        int window = analysisWindowFromDataSize(ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->size());
+        if(window == 0){
+            ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer object ONLY! Just reconnect it right!",this->getName().c_str());
+        }else{
+            if(window != bufferSize){
+                bufferSize      = window;
+                spectrumSize    = (bufferSize/2) + 1;
+                arrayPosition   = bufferSize + spectrumSize + MEL_SCALE_CRITICAL_BANDS - 1;
+            }
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->at(arrayPosition);
+        }
     }
 
 }
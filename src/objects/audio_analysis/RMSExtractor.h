@@ -35,6 +35,7 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPAnalysisFrame.h"
 
 class RMSExtractor : public PatchObject {
 
@@ -57,8 +58,9 @@ public:
 
     int             arrayPosition;
 
-    bool            isNewConnection;
-    bool            isConnectionRight;
+    void            *analysisSource;
+    const ofxVPAnalysisFrame *analysisFrame;
+    uint64_t        lastSequence;
 
 private:
 
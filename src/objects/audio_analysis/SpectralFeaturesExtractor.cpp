@@ -0,0 +1,180 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2025 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#ifndef OFXVP_BUILD_WITH_MINIMAL_OBJECTS
+
+#include "SpectralFeaturesExtractor.h"
+
+//--------------------------------------------------------------
+SpectralFeaturesExtractor::SpectralFeaturesExtractor() : PatchObject("spectral features extractor"){
+
+    this->numInlets  = 1;
+    this->numOutlets = SPECTRAL_FEATURES;
+
+    _inletParams[0] = new vector<float>();  // RAW Data
+
+    for(int i=0;i<SPECTRAL_FEATURES;i++){
+        _outletParams[i] = new float(); // centroid, flatness, flux, rolloff, onset
+        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[i]) = 0.0f;
+    }
+
+    this->initInletsState();
+
+    analysisSource      = nullptr;
+    analysisFrame       = nullptr;
+    lastSequence        = 0;
+
+    this->setIsThreadSafeObj(true);
+}
+
+//--------------------------------------------------------------
+void SpectralFeaturesExtractor::newObject(){
+    PatchObject::setName( this->objectName );
+
+    this->addInlet(VP_LINK_ARRAY,"data");
+
+    this->addOutlet(VP_LINK_NUMERIC,"centroid");
+    this->addOutlet(VP_LINK_NUMERIC,"flatness");
+    this->addOutlet(VP_LINK_NUMERIC,"flux");
+    this->addOutlet(VP_LINK_NUMERIC,"rolloff");
+    this->addOutlet(VP_LINK_NUMERIC,"onset");
+}
+
+//--------------------------------------------------------------
+void SpectralFeaturesExtractor::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
+    unusedArgs(mainWindow);
+}
+
+//--------------------------------------------------------------
+void SpectralFeaturesExtractor::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
+    unusedArgs(patchObjects);
+
+    // structured analysis frame of the source analyzer ( looked up only when the link changes )
+    if(this->inletsConnected[0]){
+        if(this->_inletParams[0] != analysisSource){
+            analysisSource  = this->_inletParams[0];
+            analysisFrame   = getAnalysisRegistry().find(analysisSource);
+            lastSequence    = 0;
+        }
+    }else{
+        analysisSource  = nullptr;
+        analysisFrame   = nullptr;
+    }
+
+    if(analysisFrame != nullptr){
+        // new analysis only
+        if(analysisFrame->sequence != lastSequence){
+            lastSequence = analysisFrame->sequence;
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = analysisFrame->centroid;
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = analysisFrame->flatness;
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[2]) = analysisFrame->flux;
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[3]) = analysisFrame->rolloff;
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[4]) = analysisFrame->onset;
+        }
+    }else if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
+        // packed analysis data ( file to data ), layout from the data size
+        vector<float> *data = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0]);
+        int position = analysisFeaturesFromDataSize(data->size());
+        if(position < 0){
+            if(analysisWindowFromDataSize(data->size()) > 0){
+                ofLog(OF_LOG_ERROR,"%s --> This audio analysis data has no spectral features ( saved with an older version )",this->getName().c_str());
+            }else{
+                ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer object ONLY! Just reconnect it right!",this->getName().c_str());
+            }
+        }else{
+            for(int i=0;i<SPECTRAL_FEATURES;i++){
+                *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[i]) = data->at(position+i);
+            }
+        }
+    }
+
+}
+
+//--------------------------------------------------------------
+void SpectralFeaturesExtractor::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer){
+    unusedArgs(font,glRenderer);
+
+    ofSetColor(255);
+
+}
+
+//--------------------------------------------------------------
+void SpectralFeaturesExtractor::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
+
+    // CONFIG GUI inside Menu
+    if(_nodeCanvas.BeginNodeMenu()){
+
+        ImGui::Separator();
+        ImGui::Separator();
+        ImGui::Separator();
+
+        if (ImGui::BeginMenu("CONFIG"))
+        {
+
+            drawObjectNodeConfig(); this->configMenuWidth = ImGui::GetWindowWidth();
+
+
+            ImGui::EndMenu();
+        }
+
+        _nodeCanvas.EndNodeMenu();
+    }
+
+    // Visualize (Object main view)
+    if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
+
+        ImGui::Dummy(ImVec2(0,4*scaleFactor));
+        ImGui::Text("centroid %.0f Hz", *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]));
+        ImGui::Text("flatness %.3f", *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]));
+        ImGui::Text("flux     %.4f", *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[2]));
+        ImGui::Text("rolloff  %.0f Hz", *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[3]));
+        ImGui::Text("onset    %.4f", *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[4]));
+
+        _nodeCanvas.EndNodeContent();
+    }
+}
+
+//--------------------------------------------------------------
+void SpectralFeaturesExtractor::drawObjectNodeConfig(){
+    ImGuiEx::ObjectInfo(
+                "Extracts the spectral features from the audio analysis data vector: centroid (Hz, brightness), flatness (0.0 tonal to 1.0 noise), flux (spectral change), rolloff (Hz, 85% of the spectral energy) and onset strength.",
+                "https://mosaic.d3cod3.org/reference.php?r=spectral-features-extractor", scaleFactor);
+}
+
+//--------------------------------------------------------------
+void SpectralFeaturesExtractor::removeObjectContent(bool removeFileFromData){
+    unusedArgs(removeFileFromData);
+}
+
+OBJECT_REGISTER( SpectralFeaturesExtractor , "spectral features extractor", OFXVP_OBJECT_CAT_AUDIOANALYSIS)
+
+#endif
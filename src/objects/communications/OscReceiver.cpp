@@ -369,6 +369,7 @@ void OscReceiver::resetOutlets(){
         this->height          *= 2;
     }
 
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
     ofxXmlSettings XML;
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
     if (XML.loadFile(this->patchFile)){
@@ -399,11 +400,7 @@ void OscReceiver::resetOutlets(){
             }
         }
 
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,this->patchFile);
     }
 
     this->saveConfig(false);
@@ -60,6 +60,8 @@ BangMultiplexer::BangMultiplexer() : PatchObject("bang multiplexer"){
     prevW                   = this->width;
     prevH                   = this->height;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
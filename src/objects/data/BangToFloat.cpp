@@ -57,6 +57,8 @@ BangToFloat::BangToFloat() : PatchObject("bang to float"){
 
     this->height        *= 0.5f;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
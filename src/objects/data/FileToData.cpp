@@ -51,8 +51,11 @@ FileToData::FileToData() : PatchObject("file to data"){
     readData            = false;
 
     actualIndex         = 0;
+    outputIndex         = std::numeric_limits<size_t>::max();
 
     tmpFileName         = "";
+
+    this->setIsThreadSafeObj(true);
 }
 
 //--------------------------------------------------------------
@@ -84,11 +87,13 @@ void FileToData::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObje
         ofLog(OF_LOG_NOTICE,"%s","FILE DATA IMPORTED!");
         // start reading data from file
         readData = true;
+        outputIndex = std::numeric_limits<size_t>::max();
     }
 
-    if(readData){
-        ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->clear();
+    // copy the data row only when it changes
+    if(readData && outputIndex != actualIndex){
         *ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]) = dataMatrix.at(actualIndex);
+        outputIndex = actualIndex;
     }
 
     if(this->inletsConnected[0] && readData){
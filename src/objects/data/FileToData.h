@@ -63,6 +63,7 @@ public:
     vector<vector<float>>   dataMatrix;
 
     size_t                  actualIndex;
+    size_t                  outputIndex;
 
     imgui_addons::ImGuiFileBrowser  fileDialog;
     string                          tmpFileName;
@@ -60,6 +60,8 @@ FloatMultiplexer::FloatMultiplexer() : PatchObject("float multiplexer"){
     prevW                   = this->width;
     prevH                   = this->height;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -59,6 +59,8 @@ FloatsToVector::FloatsToVector() : PatchObject("floats to vector"){
     prevW                   = this->width;
     prevH                   = this->height;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
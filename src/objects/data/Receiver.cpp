@@ -81,11 +81,6 @@ void vpReceiver::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
     emptyVector->assign(1,0);
 
-    // load kuro
-    ofDisableArbTex();
-    kuro->load("images/kuro.jpg");
-    ofEnableArbTex();
-
     // init wireless receiver
     initWireless();
 
@@ -104,19 +99,27 @@ void vpReceiver::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObje
     if(receiveTypeIndex == VP_LINK_NUMERIC){
         if(this->inletsConnected[0] && isReceivingON){
             *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]);
+            // received bangs keep their own events and times
+            const ofxVPEventList<> &events = this->getInletEvents(0);
+            for(size_t i=0;i<events.size();i++){
+                this->addOutletEvent(0,events[i].timeNs,events[i].value);
+            }
         }else{
             *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0.0f;
         }
     }else if(receiveTypeIndex == VP_LINK_STRING){
+        // pass-through, forward the inlet data without copying it
         if(this->inletsConnected[0] && isReceivingON){
-            *ofxVP_CAST_PIN_PTR<string>(_outletParams[0]) = *ofxVP_CAST_PIN_PTR<string>(this->_inletParams[0]);
+            this->setOutletForward(0,0);
         }else{
-            *ofxVP_CAST_PIN_PTR<string>(_outletParams[0]) = "";
+            this->setOutletForward(0);
+            ofxVP_CAST_PIN_PTR<string>(_outletParams[0])->clear();
         }
     }else if(receiveTypeIndex == VP_LINK_ARRAY){
         if(this->inletsConnected[0] && isReceivingON){
-            *ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]) = *ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0]);
+            this->setOutletForward(0,0);
         }else{
+            this->setOutletForward(0);
             *ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]) = *emptyVector;
         }
 
@@ -124,21 +127,33 @@ void vpReceiver::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObje
         if(this->inletsConnected[0] && isReceivingON){
             *ofxVP_CAST_PIN_PTR<ofTexture>(_outletParams[0]) = *ofxVP_CAST_PIN_PTR<ofTexture>(_inletParams[0]);
         }else{
+            // load kuro only when needed ( texture type only, no GL for the other types )
+            if(!kuro->isAllocated()){
+                ofDisableArbTex();
+                kuro->load("images/kuro.jpg");
+                ofEnableArbTex();
+            }
             *ofxVP_CAST_PIN_PTR<ofTexture>(_outletParams[0]) = kuro->getTexture();
         }
+    }else if(receiveTypeIndex == VP_LINK_AUDIO){
+        // forward only valid buffers
+        if(this->inletsConnected[0] && isReceivingON && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getBuffer().empty()){
+            this->setOutletForward(0,0);
+        }else{
+            this->setOutletForward(0);
+        }
     }
 
-    if(signalSendEvent){
+    // reopen the senders on our channel ( once the wireless routing table is up to date )
+    if(signalSendEvent && !getWirelessBus().isDirty()){
         signalSendEvent = false;
-        for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-            if(it->second != nullptr){
-                if(it->second->getName() == "sender"){
-                    for(int wid=0;wid<it->second->getNumOutlets();wid++){
-                        if(it->second->getOutletWirelessSend(wid) && it->second->getOutletID(wid) == this->varName && this->varName != ""){
-                            it->second->closeWirelessLink(wid);
-                            it->second->openWirelessLink(wid);
-                            break;
-                        }
+        if(this->varName != ""){
+            const vector<ofxVPWirelessPin> *senders = getWirelessBus().getSenders(this->varName,this->getInletType(wirelessPin));
+            if(senders != nullptr){
+                for(size_t s=0;s<senders->size();s++){
+                    if(senders->at(s).object->getName() == "sender"){
+                        senders->at(s).object->closeWirelessLink(senders->at(s).pin);
+                        senders->at(s).object->openWirelessLink(senders->at(s).pin);
                     }
                 }
             }
@@ -275,16 +290,7 @@ void vpReceiver::removeObjectContent(bool removeFileFromData){
 void vpReceiver::audioOutObject(ofSoundBuffer &outBuffer){
     unusedArgs(outBuffer);
 
-    if(receiveTypeIndex == VP_LINK_AUDIO){
-        if(this->inletsConnected[0] && isReceivingON && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getBuffer().empty()){
-            *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0]) = *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0]);
-        }/*else{
-            if(ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0]) != nullptr && ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->getBuffer().empty()){
-                ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->set(0.0f);
-            }
-
-        }*/
-    }
+    // audio buffers are forwarded from updateObjectContent, no copy needed here
 
 }
 
@@ -424,6 +430,7 @@ void vpReceiver::changeDataType(int type, bool init){
 
     // changed inlets/outlet type
     if(!init){ // remove links
+        std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
         ofxXmlSettings XML;
 
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
@@ -454,15 +461,12 @@ void vpReceiver::changeDataType(int type, bool init){
                 }
             }
 
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,this->patchFile);
 
         }
 
         this->outPut.clear();
+        ofNotifyEvent(this->linksChangedEvent, this->nId);
     }
 
 
@@ -80,11 +80,6 @@ void vpSender::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
     emptyVector->assign(1,0);
 
-    // load kuro
-    ofDisableArbTex();
-    kuro->load("images/kuro.jpg");
-    ofEnableArbTex();
-
 }
 
 //--------------------------------------------------------------
@@ -99,19 +94,27 @@ void vpSender::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObject
     if(sendTypeIndex == VP_LINK_NUMERIC){
         if(this->inletsConnected[0] && isSendingON){
             *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]);
+            // pass on every event of the frame ( bangs )
+            const ofxVPEventList<> &events = this->getInletEvents(0);
+            for(size_t i=0;i<events.size();i++){
+                this->addOutletEvent(0,events[i].timeNs,events[i].value);
+            }
         }else{
             *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0.0f;
         }
     }else if(sendTypeIndex == VP_LINK_STRING){
+        // pass-through, forward the inlet data without copying it
         if(this->inletsConnected[0] && isSendingON){
-            *ofxVP_CAST_PIN_PTR<string>(_outletParams[0]) = *ofxVP_CAST_PIN_PTR<string>(this->_inletParams[0]);
+            this->setOutletForward(0,0);
         }else{
-            *ofxVP_CAST_PIN_PTR<string>(_outletParams[0]) = "";
+            this->setOutletForward(0);
+            ofxVP_CAST_PIN_PTR<string>(_outletParams[0])->clear();
         }
     }else if(sendTypeIndex == VP_LINK_ARRAY){
         if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty() && isSendingON){
-            *ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]) = *ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0]);
+            this->setOutletForward(0,0);
         }else{
+            this->setOutletForward(0);
             *ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0]) = *emptyVector;
         }
 
@@ -119,8 +122,21 @@ void vpSender::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObject
         if(this->inletsConnected[0] && isSendingON){
             *ofxVP_CAST_PIN_PTR<ofTexture>(_outletParams[0]) = *ofxVP_CAST_PIN_PTR<ofTexture>(_inletParams[0]);
         }else{
+            // load kuro only when needed ( texture type only, no GL for the other types )
+            if(!kuro->isAllocated()){
+                ofDisableArbTex();
+                kuro->load("images/kuro.jpg");
+                ofEnableArbTex();
+            }
             *ofxVP_CAST_PIN_PTR<ofTexture>(_outletParams[0]) = kuro->getTexture();
         }
+    }else if(sendTypeIndex == VP_LINK_AUDIO){
+        // forward only valid buffers
+        if(this->inletsConnected[0] && isSendingON && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getBuffer().empty()){
+            this->setOutletForward(0,0);
+        }else{
+            this->setOutletForward(0);
+        }
     }
 
     if(resetLinks){
@@ -139,6 +155,7 @@ void vpSender::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObject
                 it->second->outPut = tempBuffer;
             }
         }
+        ofNotifyEvent(this->linksChangedEvent, this->nId);
     }
 
     if(!loaded){
@@ -272,15 +289,7 @@ void vpSender::removeObjectContent(bool removeFileFromData){
 void vpSender::audioOutObject(ofSoundBuffer &outBuffer){
     unusedArgs(outBuffer);
 
-    if(sendTypeIndex == VP_LINK_AUDIO){
-        if(this->inletsConnected[0] && isSendingON && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getBuffer().empty()){
-            *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0]) = *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0]);
-        }/*else{
-            if(ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0]) != nullptr && ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->getBuffer().empty()){
-                ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->set(0.0f);
-            }
-        }*/
-    }
+    // audio buffers are forwarded from updateObjectContent, no copy needed here
 
 }
 
@@ -424,6 +433,7 @@ void vpSender::changeDataType(int type, bool init){
 
     this->setOutletWirelessSend(wirelessPin,true);
 
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
     ofxXmlSettings XML;
 
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
@@ -485,11 +495,7 @@ void vpSender::changeDataType(int type, bool init){
             }
         }
 
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,this->patchFile);
 
     }
 
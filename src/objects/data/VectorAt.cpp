@@ -52,6 +52,8 @@ VectorAt::VectorAt() : PatchObject("vector at"){
     vectorAt            = 0;
     loaded              = false;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -58,6 +58,8 @@ VectorConcat::VectorConcat() : PatchObject("vector concat"){
     prevW                   = this->width;
     prevH                   = this->height;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
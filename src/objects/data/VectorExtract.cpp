@@ -55,6 +55,8 @@ VectorExtract::VectorExtract() : PatchObject("vector extract"){
 
     loaded          = false;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
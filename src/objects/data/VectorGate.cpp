@@ -60,8 +60,6 @@ VectorGate::VectorGate() : PatchObject("vector gate"){
 
     this->setIsResizable(true);
 
-    isAudioOUTObject        = true;
-
     prevW                   = this->width;
     prevH                   = this->height;
 
@@ -93,12 +91,6 @@ void VectorGate::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     initInlets();
 }
 
-//--------------------------------------------------------------
-void VectorGate::setupAudioOutObjectContent(pdsp::Engine &engine){
-    unusedArgs(engine);
-
-}
-
 //--------------------------------------------------------------
 void VectorGate::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
@@ -118,6 +110,18 @@ void VectorGate::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObje
         openInlet = this->getCustomVar("OPEN");
     }
 
+    ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->clear();
+
+    if(this->inletsConnected[0]){
+        openInlet = static_cast<int>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0])));
+    }
+
+    if(openInlet >= 1 && openInlet < this->numInlets && this->inletsConnected[openInlet] && !ofxVP_CAST_PIN_PTR<vector<float>>(_inletParams[openInlet])->empty()){
+        for(size_t s=0;s<static_cast<size_t>(ofxVP_CAST_PIN_PTR<vector<float>>(_inletParams[openInlet])->size());s++){
+            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->push_back(ofxVP_CAST_PIN_PTR<vector<float>>(_inletParams[openInlet])->at(s));
+        }
+    }
+
 }
 
 //--------------------------------------------------------------
@@ -212,23 +216,6 @@ void VectorGate::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
 }
 
-//--------------------------------------------------------------
-void VectorGate::audioOutObject(ofSoundBuffer &outputBuffer){
-    unusedArgs(outputBuffer);
-
-    ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->clear();
-
-    if(this->inletsConnected[0]){
-        openInlet = static_cast<int>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0])));
-    }
-
-    if(openInlet >= 1 && openInlet < this->numInlets && this->inletsConnected[openInlet] && !ofxVP_CAST_PIN_PTR<vector<float>>(_inletParams[openInlet])->empty()){
-        for(size_t s=0;s<static_cast<size_t>(ofxVP_CAST_PIN_PTR<vector<float>>(_inletParams[openInlet])->size());s++){
-            ofxVP_CAST_PIN_PTR<vector<float>>(this->_outletParams[0])->push_back(ofxVP_CAST_PIN_PTR<vector<float>>(_inletParams[openInlet])->at(s));
-        }
-    }
-}
-
 //--------------------------------------------------------------
 void VectorGate::initInlets(){
     dataInlets = this->getCustomVar("NUM_INLETS");
@@ -51,6 +51,9 @@ VectorOperator::VectorOperator() : PatchObject("vector operator"){
     _operator           = Vec_Operator_ADD;
     number              = 0.0f;
     loaded              = false;
+
+    this->setIsPureObj(true);
+    this->setIsThreadSafeObj(true);
 }
 
 //--------------------------------------------------------------
@@ -242,7 +242,13 @@ void ImageLoader::loadImageFile(){
         isNewObject = false;
         img = new ofImage();
         ofDisableArbTex();
-        img->load(filepath);
+        // use the pixels decoded by the patch loader if available, only the texture upload happens here
+        ofPixels prefetched;
+        if(getAssetCache().takePixels(filepath,prefetched)){
+            img->setFromPixels(prefetched);
+        }else{
+            img->load(filepath);
+        }
         ofEnableArbTex();
 
         ofFile tempFile(filepath);
@@ -35,6 +35,7 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPAssetCache.h"
 
 #include "ImGuiFileBrowser.h"
 #include "IconsFontAwesome5.h"
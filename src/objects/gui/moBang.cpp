@@ -52,8 +52,6 @@ moBang::moBang() :
     _outletParams[1] = new string(); // output string
     *ofxVP_CAST_PIN_PTR<string>(_outletParams[1]) = "";
 
-    isAudioOUTObject        = true;
-
     this->initInletsState();
 
     bang            = false;
@@ -82,41 +80,32 @@ void moBang::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 }
 
 //--------------------------------------------------------------
-void moBang::setupAudioOutObjectContent(pdsp::Engine &engine){
-    unusedArgs(engine);
+void moBang::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
+    unusedArgs(patchObjects);
 
-    // ---- this code runs in the audio thread ----
-    sync.code = [&]() noexcept {
-        if(this->inletsConnected[0]){
-            if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) < 1.0){
-                bang = false;
-                isBangFinished = true;
-            }else{
-                bang = true;
-            }
+    if(this->inletsConnected[0]){
+        if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) < 1.0){
+            bang = false;
+            isBangFinished = true;
+        }else{
+            bang = true;
         }
+    }
 
-        if(bang && isBangFinished){
-            isBangFinished = false;
-
-            currentColor = pressColor;
-
-            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = static_cast<float>(bang);
-            *ofxVP_CAST_PIN_PTR<string>(_outletParams[1]) = "bang";
+    if(bang && isBangFinished){
+        isBangFinished = false;
 
-        }else{
-            currentColor = releaseColor;
+        currentColor = pressColor;
 
-            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0;
-            *ofxVP_CAST_PIN_PTR<string>(_outletParams[1]) = "";
-        }
-    };
+        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = static_cast<float>(bang);
+        *ofxVP_CAST_PIN_PTR<string>(_outletParams[1]) = "bang";
 
-}
+    }else{
+        currentColor = releaseColor;
 
-//--------------------------------------------------------------
-void moBang::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
-    unusedArgs(patchObjects);
+        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0;
+        *ofxVP_CAST_PIN_PTR<string>(_outletParams[1]) = "";
+    }
 
 }
 
@@ -185,12 +174,6 @@ void moBang::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
 }
 
-//--------------------------------------------------------------
-void moBang::audioOutObject(ofSoundBuffer &outputBuffer){
-    unusedArgs(outputBuffer);
-
-}
-
 OBJECT_REGISTER( moBang, "bang", OFXVP_OBJECT_CAT_GUI)
 
 #endif
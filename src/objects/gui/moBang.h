@@ -45,7 +45,6 @@ public:
 
     void            newObject() override;
     void            setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow) override;
-    void            setupAudioOutObjectContent(pdsp::Engine &engine) override;
     void            updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects) override;
 
     void            drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer) override;
@@ -54,14 +53,10 @@ public:
 
     void            removeObjectContent(bool removeFileFromData=false) override;
 
-    void            audioOutObject(ofSoundBuffer &outputBuffer) override;
-
 
     bool            bang;
     bool            isBangFinished;
 
-    pdsp::Function  sync;
-
     ImVec4          currentColor;
     ImVec4          pressColor;
     ImVec4          releaseColor;
@@ -205,6 +205,7 @@ void moComment::loadCommentSetting(){
 
 //--------------------------------------------------------------
 void moComment::saveCommentSetting(){
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
     ofxXmlSettings XML;
 
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
@@ -221,11 +222,7 @@ void moComment::saveCommentSetting(){
                 XML.popTag();
             }
         }
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,patchFile);
     }
 }
 
@@ -175,6 +175,7 @@ void moMessage::loadMessageSetting(){
 
 //--------------------------------------------------------------
 void moMessage::saveMessageSetting(){
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
     ofxXmlSettings XML;
 
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
@@ -191,11 +192,7 @@ void moMessage::saveMessageSetting(){
                 XML.popTag();
             }
         }
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,patchFile);
     }
 }
 
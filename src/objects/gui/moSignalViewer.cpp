@@ -58,6 +58,7 @@ moSignalViewer::moSignalViewer() :
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 }
 
 //--------------------------------------------------------------
@@ -90,9 +91,22 @@ void moSignalViewer::setupAudioOutObjectContent(pdsp::Engine &engine){
 void moSignalViewer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
 
-    if(this->inletsConnected[0]){
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[3]) = ofClamp(ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getRMSAmplitude(),0.0,1.0);
-    }else{
+    // audio outlets send the inlet buffer straight through
+    this->setOutletForward(0,this->inletsConnected[0] ? 0 : -1);
+    this->setOutletForward(1,this->inletsConnected[0] ? 0 : -1);
+
+    // latest signal buffer data from the audio thread
+    if(scopeChannel.update()){
+        const moSignalViewerData &data = scopeChannel.getReadBuffer();
+        for(size_t i=0;i<data.samples.size();i++){
+            plot_data[i] = hardClip(data.samples[i]);
+            ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[2])->at(i) = data.samples[i];
+        }
+        if(this->inletsConnected[0]){
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[3]) = ofClamp(data.rms,0.0,1.0);
+        }
+    }
+    if(!this->inletsConnected[0]){
         *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[3]) = 0;
     }
 }
@@ -175,6 +189,11 @@ void moSignalViewer::loadAudioSettings(){
                 plot_data[i] = 0.0f;
             }
 
+            moSignalViewerData data;
+            data.samples.assign(bufferSize,0.0f);
+            data.rms = 0.0f;
+            scopeChannel.reset(data);
+
             XML.popTag();
         }
     }
@@ -190,15 +209,15 @@ void moSignalViewer::audioOutObject(ofSoundBuffer &outBuffer){
     unusedArgs(outBuffer);
 
     if(this->inletsConnected[0]){
-        *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0]) = *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0]);
-        *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[1]) = *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0]);
-
-        for(size_t i = 0; i < ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getNumFrames(); i++) {
-            float sample = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getSample(i,0);
-            plot_data[i] = hardClip(sample);
-
-            // SIGNAL BUFFER DATA
-            ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[2])->at(i) = sample;
+        // SIGNAL BUFFER DATA, to the main thread ( waveform, data outlet and RMS )
+        ofSoundBuffer *signal = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0]);
+        moSignalViewerData &data = scopeChannel.getWriteBuffer();
+        if(data.samples.size() == signal->getNumFrames()){
+            for(size_t i = 0; i < signal->getNumFrames(); i++) {
+                data.samples[i] = signal->getSample(i,0);
+            }
+            data.rms = signal->getRMSAmplitude();
+            scopeChannel.publish();
         }
     }else{
         ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->set(0.0f);
@@ -35,8 +35,14 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPTripleBuffer.h"
 #include "imgui_plot.h"
 
+struct moSignalViewerData{
+    vector<float>   samples;
+    float           rms;
+};
+
 class moSignalViewer : public PatchObject {
 
 public:
@@ -62,6 +68,7 @@ public:
     float           *plot_data;
 
     int             bufferSize;
+    ofxVPTripleBuffer<moSignalViewerData> scopeChannel;  // audio -> control, signal buffer data and RMS
     int             sampleRate;
 
 private:
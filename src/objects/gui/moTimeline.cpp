@@ -683,6 +683,7 @@ void moTimeline::updateOutletsConfig(){
 
 //--------------------------------------------------------------
 void moTimeline::saveOutletConfig(){
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
     ofxXmlSettings XML;
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
     if (XML.loadFile(patchFile)){
@@ -754,11 +755,7 @@ void moTimeline::saveOutletConfig(){
             }
         }
 
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,patchFile);
     }
 
     ofNotifyEvent(this->reconnectOutletsEvent, this->nId);
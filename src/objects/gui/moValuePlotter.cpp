@@ -233,6 +233,7 @@ void moValuePlotter::loadVariableName(){
 
 //--------------------------------------------------------------
 void moValuePlotter::saveVariableName(){
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
     ofxXmlSettings XML;
 
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
@@ -249,11 +250,7 @@ void moValuePlotter::saveVariableName(){
                 XML.popTag();
             }
         }
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,patchFile);
     }
 }
 
@@ -55,6 +55,8 @@ BooleanOperator::BooleanOperator() : PatchObject("boolean operator"){
 
     loaded              = false;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -55,6 +55,8 @@ Conditional::Conditional() : PatchObject("conditional operator"){
     number              = 0.0f;
     loaded              = false;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
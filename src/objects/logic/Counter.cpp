@@ -54,8 +54,6 @@ Counter::Counter() : PatchObject("counter"){
 
     this->initInletsState();
 
-    isAudioOUTObject        = true;
-
     bang                = false;
     _st                 = 0;
     _en                 = 1;
@@ -85,12 +83,6 @@ void Counter::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
 }
 
-//--------------------------------------------------------------
-void Counter::setupAudioOutObjectContent(pdsp::Engine &engine){
-    unusedArgs(engine);
-
-}
-
 //--------------------------------------------------------------
 void Counter::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
@@ -121,6 +113,32 @@ void Counter::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects
         _en = static_cast<int>(floor(this->getCustomVar("END")));
     }
 
+    // count every bang of the frame ( each count sent as an event, with the bang time )
+    const ofxVPEventList<> &bangs = this->getInletEvents(0);
+    for(size_t i=0;i<bangs.size();i++){
+        if(bangs[i].value < 1.0){
+            bang = false;
+        }else if(!bang){
+            bang = true;
+            int tempEnd = 1;
+            if(this->inletsConnected[2]){
+                tempEnd = static_cast<int>(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[2]));
+            }else{
+                tempEnd = _en;
+            }
+            if(*ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) < tempEnd){
+                *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) += 1;
+            }else{
+                if(this->inletsConnected[1]){
+                    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1]);
+                }else{
+                    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = _st;
+                }
+            }
+            this->addOutletEvent(0,bangs[i].timeNs,*ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]));
+        }
+    }
+
 }
 
 //--------------------------------------------------------------
@@ -187,36 +205,6 @@ void Counter::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
 }
 
-//--------------------------------------------------------------
-void Counter::audioOutObject(ofSoundBuffer &outputBuffer){
-    unusedArgs(outputBuffer);
-
-    if(this->inletsConnected[0]){
-        if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) < 1.0){
-            bang = false;
-        }else if(!bang){
-            bang = true;
-            int tempEnd = 1;
-            if(this->inletsConnected[2]){
-                tempEnd = static_cast<int>(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[2]));
-            }else{
-                tempEnd = _en;
-            }
-            if(*ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) < tempEnd){
-                *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) += 1;
-            }else{
-                if(this->inletsConnected[1]){
-                    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1]);
-                }else{
-                    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = _st;
-                }
-            }
-        }
-    }
-
-}
-
-
 OBJECT_REGISTER( Counter, "counter", OFXVP_OBJECT_CAT_LOGIC)
 
 #endif
@@ -57,10 +57,14 @@ DelayBang::DelayBang() : PatchObject("delay bang"){
     bang                = false;
     delayBang           = false;
 
-    loadStart           = false;
-
     wait                = 1000;
-    startTime           = ofGetElapsedTimeMillis();
+
+    clockID             = -1;
+    startNs             = getControlClock().now();
+    waitNs              = static_cast<uint64_t>(wait)*1000000;
+    pendingBangs        = 0;
+    lastBangNs          = 0;
+    armed               = true;
 
     loaded              = false;
 
@@ -88,6 +92,8 @@ void DelayBang::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
     currentColor = releaseColor;
 
+    clockID = getControlClock().addCallback([this](uint64_t nowNs){ controlTick(nowNs); });
+
 }
 
 //--------------------------------------------------------------
@@ -96,20 +102,21 @@ void DelayBang::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjec
         wait                = static_cast<int>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1])));
     }
 
-    if(this->inletsConnected[0]){
-        if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) == 1.0 && !bang){
+    // the delay starts at the input bang time ( not at this frame time )
+    const ofxVPEventList<> &bangs = this->getInletEvents(0);
+    for(size_t i=0;i<bangs.size();i++){
+        if(bangs[i].value == 1.0f && !bang){
             bang        = true;
-            loadStart   = false;
-            startTime   = ofGetElapsedTimeMillis();
+            startNs     = bangs[i].timeNs;
+            armed       = true;
         }
     }
 
-    if(!loadStart && (ofGetElapsedTimeMillis()-startTime > wait)){
+    // the control clock bang goes to the graph with its exact time
+    delayBang = pendingBangs.exchange(0) > 0;
+    if(delayBang){
         bang        = false;
-        loadStart   = true;
-        delayBang   = true;
-    }else{
-        delayBang   = false;
+        this->addOutletBang(0,lastBangNs.load());
     }
     *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = static_cast<float>(delayBang);
 
@@ -124,6 +131,8 @@ void DelayBang::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjec
         wait = static_cast<int>(floor(this->getCustomVar("MS")));
     }
 
+    waitNs = static_cast<uint64_t>(std::max(0,wait))*1000000;
+
 }
 
 //--------------------------------------------------------------
@@ -187,7 +196,21 @@ void DelayBang::drawObjectNodeConfig(){
 
 //--------------------------------------------------------------
 void DelayBang::removeObjectContent(bool removeFileFromData){
+    unusedArgs(removeFileFromData);
 
+    getControlClock().removeCallback(clockID);
+    clockID = -1;
+}
+
+//--------------------------------------------------------------
+void DelayBang::controlTick(uint64_t nowNs){
+
+    // ---- this code runs in the control clock thread ----
+    if(armed.load() && nowNs > startNs.load() && nowNs - startNs.load() > waitNs.load()){
+        armed = false;
+        lastBangNs = startNs.load() + waitNs.load();
+        pendingBangs++;
+    }
 }
 
 
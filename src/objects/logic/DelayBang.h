@@ -54,6 +54,8 @@ public:
 
     void            removeObjectContent(bool removeFileFromData=false) override;
 
+    void            controlTick(uint64_t nowNs);
+
     ImVec4                  currentColor;
     ImVec4                  pressColor;
     ImVec4                  releaseColor;
@@ -61,9 +63,15 @@ public:
     bool                    bang;
     bool                    delayBang;
 
-    bool                    loadStart;
     int                     wait;
-    size_t                  startTime;
+
+    // control clock timing
+    int                     clockID;
+    std::atomic<bool>       armed;
+    std::atomic<uint64_t>   startNs;
+    std::atomic<uint64_t>   waitNs;
+    std::atomic<int>        pendingBangs;
+    std::atomic<uint64_t>   lastBangNs;
 
     bool                    loaded;
 
@@ -43,7 +43,6 @@ Gate::Gate() : PatchObject("gate"){
     _inletParams[0] = new float();  // open
     *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) = 0.0f;
 
-
     for(size_t i=1;i<32;i++){
         _inletParams[i] = new float();
         *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[i]) = 0.0f;
@@ -59,8 +58,6 @@ Gate::Gate() : PatchObject("gate"){
 
     openInlet   = 0;
 
-    isAudioOUTObject        = true;
-
     this->initInletsState();
 
     this->setIsResizable(true);
@@ -95,12 +92,6 @@ void Gate::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     initInlets();
 }
 
-//--------------------------------------------------------------
-void Gate::setupAudioOutObjectContent(pdsp::Engine &engine){
-    unusedArgs(engine);
-
-}
-
 //--------------------------------------------------------------
 void Gate::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
@@ -120,7 +111,17 @@ void Gate::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
         openInlet = this->getCustomVar("OPEN");
 
     }
-    
+
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0.0f;
+
+    if(this->inletsConnected[0]){
+        openInlet = static_cast<int>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0])));
+    }
+
+    if(openInlet >= 1 && openInlet < this->numInlets && this->inletsConnected[openInlet]){
+        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[openInlet]);
+    }
+
 }
 
 //--------------------------------------------------------------
@@ -218,21 +219,6 @@ void Gate::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
 }
 
-//--------------------------------------------------------------
-void Gate::audioOutObject(ofSoundBuffer &outputBuffer){
-    unusedArgs(outputBuffer);
-
-    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0.0f;
-
-    if(this->inletsConnected[0]){
-        openInlet = static_cast<int>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0])));
-    }
-
-    if(openInlet >= 1 && openInlet < this->numInlets && this->inletsConnected[openInlet]){
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[openInlet]);
-    }
-}
-
 //--------------------------------------------------------------
 void Gate::initInlets(){
     floatInlets = this->getCustomVar("NUM_INLETS");
@@ -50,6 +50,8 @@ Inverter::Inverter() : PatchObject("inverter"){
 
     trigger = true;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -77,6 +77,9 @@ Spigot::Spigot() : PatchObject("spigot"){
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
+
+    signalOpen              = false;
 
     empty   = new vector<float>();
     kuro    = new ofImage();
@@ -178,7 +181,9 @@ void Spigot::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects)
             }
         }
     }
-    
+
+    signalOpen = isOpen[4];
+
 }
 
 //--------------------------------------------------------------
@@ -266,7 +271,7 @@ void Spigot::removeObjectContent(bool removeFileFromData){
 void Spigot::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    if(isOpen[4]){
+    if(signalOpen.load()){
         if(this->inletsConnected[5] && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[5])->getBuffer().empty()){
             *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(this->_outletParams[4]) = *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(this->_inletParams[5]);
         }else{
@@ -55,6 +55,7 @@ public:
     void            audioOutObject(ofSoundBuffer &outputBuffer) override;
 
     bool*               isOpen;
+    std::atomic<bool>   signalOpen;     // read by the audio thread
     vector<string>      labels;
 
     vector<float>       *empty;
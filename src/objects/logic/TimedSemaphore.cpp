@@ -51,14 +51,17 @@ TimedSemaphore::TimedSemaphore() : PatchObject("timed semaphore"){
 
     this->initInletsState();
 
-    isAudioOUTObject    = true;
-
     bang                = false;
 
     loadStart           = true;
 
     wait                = 1000;
-    startTime           = ofGetElapsedTimeMillis();
+
+    clockID             = -1;
+    startNs             = getControlClock().now();
+    waitNs              = static_cast<uint64_t>(wait)*1000000;
+
+    loaded              = false;
 
 }
 
@@ -82,27 +85,8 @@ void TimedSemaphore::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow)
     releaseColor = { 0.f, 0.f, 0.f, 0.f };
 
     currentColor = releaseColor;
-}
-
-//--------------------------------------------------------------
-void TimedSemaphore::setupAudioOutObjectContent(pdsp::Engine &engine){
-    unusedArgs(engine);
-
-    // ---- this code runs in the audio thread ----
-    sync.code = [&]() noexcept {
-        if(this->inletsConnected[0] && loadStart){
-            if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) == 1.0 && !bang){
-                bang        = true;
-                loadStart   = false;
-                startTime   = ofGetElapsedTimeMillis();
-            }
-        }else{
-          bang        = false;
-        }
-
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = static_cast<float>(bang);
-    };
 
+    clockID = getControlClock().addCallback([this](uint64_t nowNs){ controlTick(nowNs); });
 }
 
 //--------------------------------------------------------------
@@ -113,15 +97,29 @@ void TimedSemaphore::updateObjectContent(map<int,shared_ptr<PatchObject>> &patch
       wait = static_cast<int>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1])));
     }
 
-    if(!loadStart && (ofGetElapsedTimeMillis()-startTime > wait)){
-        loadStart   = true;
-    }
-
     if(!loaded){
         loaded = true;
         wait   = static_cast<int>(floor(this->getCustomVar("MS")));
     }
 
+    waitNs = static_cast<uint64_t>(std::max(0,wait))*1000000;
+
+    // pass the bangs coming after the semaphore reopened, judged on their own time
+    // ( several bangs of a long frame can pass, each one with its time )
+    bang = false;
+    const ofxVPEventList<> &bangs = this->getInletEvents(0);
+    for(size_t i=0;i<bangs.size();i++){
+        if(bangs[i].value != 1.0f) continue;
+        if(loadStart.load() || bangs[i].timeNs > startNs.load() + waitNs.load()){
+            startNs     = bangs[i].timeNs;
+            loadStart   = false;
+            this->addOutletBang(0,bangs[i].timeNs);
+            bang        = true;
+        }
+    }
+
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = static_cast<float>(bang);
+
 }
 
 //--------------------------------------------------------------
@@ -198,15 +196,20 @@ void TimedSemaphore::drawObjectNodeConfig(){
 //--------------------------------------------------------------
 void TimedSemaphore::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
+
+    getControlClock().removeCallback(clockID);
+    clockID = -1;
 }
 
 //--------------------------------------------------------------
-void TimedSemaphore::audioOutObject(ofSoundBuffer &outputBuffer){
-    unusedArgs(outputBuffer);
+void TimedSemaphore::controlTick(uint64_t nowNs){
 
+    // ---- this code runs in the control clock thread ----
+    if(!loadStart.load() && nowNs > startNs.load() && nowNs - startNs.load() > waitNs.load()){
+        loadStart = true;
+    }
 }
 
-
 OBJECT_REGISTER( TimedSemaphore, "timed semaphore", OFXVP_OBJECT_CAT_LOGIC)
 
 #endif
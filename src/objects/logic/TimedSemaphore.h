@@ -46,7 +46,6 @@ public:
 
     void            newObject() override;
     void            setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow) override;
-    void            setupAudioOutObjectContent(pdsp::Engine &engine) override;
     void            updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects) override;
 
     void            drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer) override;
@@ -55,7 +54,7 @@ public:
 
     void            removeObjectContent(bool removeFileFromData=false) override;
 
-    void            audioOutObject(ofSoundBuffer &outputBuffer) override;
+    void            controlTick(uint64_t nowNs);
 
 
     ImVec4                  currentColor;
@@ -63,11 +62,14 @@ public:
     ImVec4                  releaseColor;
 
     bool                    bang;
-    pdsp::Function          sync;
 
-    bool                    loadStart;
     int                     wait;
-    size_t                  startTime;
+
+    // control clock timing
+    int                     clockID;
+    std::atomic<bool>       loadStart;
+    std::atomic<uint64_t>   startNs;
+    std::atomic<uint64_t>   waitNs;
 
     bool                    loaded;
 
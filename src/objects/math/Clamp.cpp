@@ -57,6 +57,9 @@ Clamp::Clamp() : PatchObject("clamp"){
 
     loaded  = false;
 
+    this->setIsPureObj(true);
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -81,10 +84,10 @@ void Clamp::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
 //--------------------------------------------------------------
 void Clamp::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
-    if(this->inletsConnected[0]){
-      *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]),min,max);
-    }else{
-      *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0.0f;
+    if(!loaded){
+        loaded = true;
+        min = this->getCustomVar("MIN");
+        max = this->getCustomVar("MAX");
     }
 
     if(this->inletsConnected[1]){
@@ -94,10 +97,10 @@ void Clamp::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
       max = *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[2]);
     }
 
-    if(!loaded){
-        loaded = true;
-        min = this->getCustomVar("MIN");
-        max = this->getCustomVar("MAX");
+    if(this->inletsConnected[0]){
+      *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]),min,max);
+    }else{
+      *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0.0f;
     }
 }
 
@@ -46,7 +46,6 @@ public:
 
     void            newObject() override;
     void            setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow) override;
-    void            setupAudioOutObjectContent(pdsp::Engine &engine) override;
     void            updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects) override;
 
     void            drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer) override;
@@ -55,8 +54,6 @@ public:
 
     void            removeObjectContent(bool removeFileFromData=false) override;
 
-    void            audioOutObject(ofSoundBuffer &outputBuffer) override;
-
     float                   angle;
     float                   increment;
     bool                    bang;
@@ -63,6 +63,9 @@ Map::Map() : PatchObject("map"){
 
     loaded              = false;
 
+    this->setIsPureObj(true);
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -92,6 +95,14 @@ void Map::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 //--------------------------------------------------------------
 void Map::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
 
+    if(!loaded){
+        loaded = true;
+        inMin = this->getCustomVar("IN_MIN");
+        inMax = this->getCustomVar("IN_MAX");
+        outMin = this->getCustomVar("OUT_MIN");
+        outMax = this->getCustomVar("OUT_MAX");
+    }
+
     if(this->inletsConnected[0]){
       if(this->inletsConnected[1]){
           inMin = *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1]);
@@ -110,14 +121,6 @@ void Map::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
       *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0.0f;
     }
 
-    if(!loaded){
-        loaded = true;
-        inMin = this->getCustomVar("IN_MIN");
-        inMax = this->getCustomVar("IN_MAX");
-        outMin = this->getCustomVar("OUT_MIN");
-        outMax = this->getCustomVar("OUT_MAX");
-    }
-
 }
 
 //--------------------------------------------------------------
@@ -57,15 +57,19 @@ Metronome::Metronome() :
     *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = 0.0f;
 
     isAudioOUTObject        = true;
+    isLockFreeAudioObject   = true;
 
     this->initInletsState();
 
-    resetTime = ofGetElapsedTimeMicros();
-    metroTime = ofGetElapsedTimeMicros();
-
-    sync                = false;
+    clockID             = -1;
+    nextBangNs          = 0;
+    intervalNs          = static_cast<uint64_t>(timeSetting.get())*1000000;
+    syncRequest         = false;
+    droppedBangs        = 0;
 
     bpmMetro            = false;
+    bpmBeat             = false;
+    mbpm                = 0.0;
 
     loaded              = false;
 
@@ -88,6 +92,7 @@ void Metronome::newObject(){
 void Metronome::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     unusedArgs(mainWindow);
 
+    clockID = getControlClock().addCallback([this](uint64_t nowNs){ controlTick(nowNs); });
 }
 
 //--------------------------------------------------------------
@@ -95,33 +100,11 @@ void Metronome::setupAudioOutObjectContent(pdsp::Engine &engine){
 
     // ---- this code runs in the audio thread ----
     systemBPM.code = [&]() noexcept {
-        // metronome
-        metroTime = ofGetElapsedTimeMicros();
-
-        if(this->inletsConnected[1]){
-            sync = static_cast<bool>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1])));
-        }
-
-        if(sync){
-            resetTime = ofGetElapsedTimeMicros();
-        }
-
-        if(metroTime-resetTime > static_cast<size_t>(timeSetting.get()*1000.0f)){
-            resetTime = ofGetElapsedTimeMicros();
-            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 1.0f;
-        }else{
-            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = 0.0f;
-        }
-
         // Mosaic main BPM
         mbpm = engine.sequencer.getTempo();
 
-        // BPM metronome
-        if(systemBPM.frame()%4==0){
-            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = 1.0f;
-        }else{
-            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = 0.0f;
-        }
+        // BPM metronome ( latched into the outlet by updateObjectContent )
+        bpmBeat = systemBPM.frame()%4==0;
     };
 
 }
@@ -140,6 +123,31 @@ void Metronome::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjec
         timeSetting.set(static_cast<int>(floor(this->getCustomVar("TIME"))));
     }
 
+    intervalNs = static_cast<uint64_t>(std::max(1,timeSetting.get()))*1000000;
+
+    if(this->inletsConnected[1]){
+        syncRequest = static_cast<bool>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1])));
+    }else{
+        syncRequest = false;
+    }
+
+    // system bpm bang from the audio thread
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = bpmBeat.load() ? 1.0f : 0.0f;
+
+    // every control clock bang goes to the graph as an on/off event pair, with its exact time
+    // ( gate never longer than half the interval, bangs over the outlet capacity wait for the next frame )
+    bool banged = false;
+    ofxVPTimedEvent e;
+    while(this->getOutletEvents(0).available() >= 2 && bangEvents.popBefore(std::numeric_limits<uint64_t>::max(),e)){
+        this->addOutletBang(0,e.timeNs,intervalNs.load()/2);
+        banged = true;
+    }
+    if(droppedBangs.load() > 0){
+        ofLog(OF_LOG_WARNING,"metronome: %i bangs dropped, the patch is not updating",static_cast<int>(droppedBangs.exchange(0)));
+    }
+    // latched value, for the GUI and the objects reading the outlet value
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = banged ? 1.0f : 0.0f;
+
 }
 
 //--------------------------------------------------------------
@@ -184,7 +192,7 @@ void Metronome::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
         char temp[32];
         sprintf_s(temp,"%.1f",static_cast<float>(60.0f/(timeSetting.get()/1000.0f)));
         _nodeCanvas.getNodeDrawList()->AddText(ImGui::GetFont(), ImGui::GetFontSize(), posFirst, IM_COL32_WHITE,temp, NULL, 0.0f);
-        sprintf_s(temp,"%i",static_cast<int>(mbpm));
+        sprintf_s(temp,"%i",static_cast<int>(mbpm.load()));
         _nodeCanvas.getNodeDrawList()->AddText(ImGui::GetFont(), ImGui::GetFontSize(), pos, IM_COL32_WHITE,temp, NULL, 0.0f);
 
         if(*ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) > 0){
@@ -212,6 +220,9 @@ void Metronome::drawObjectNodeConfig(){
 //--------------------------------------------------------------
 void Metronome::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
+
+    getControlClock().removeCallback(clockID);
+    clockID = -1;
 }
 
 //--------------------------------------------------------------
@@ -220,6 +231,29 @@ void Metronome::audioOutObject(ofSoundBuffer &outputBuffer){
 
 }
 
+//--------------------------------------------------------------
+void Metronome::controlTick(uint64_t nowNs){
+
+    // ---- this code runs in the control clock thread ----
+    uint64_t interval = intervalNs.load();
+
+    if(syncRequest.load() || nextBangNs == 0){
+        nextBangNs = nowNs + interval;
+        return;
+    }
+
+    if(nowNs >= nextBangNs){
+        if(!bangEvents.push(nextBangNs,1.0f)){
+            droppedBangs++;
+        }
+        // next deadline from the previous one, no drift
+        nextBangNs += interval;
+        if(nextBangNs <= nowNs){
+            nextBangNs = nowNs + interval;
+        }
+    }
+}
+
 OBJECT_REGISTER( Metronome, "metronome", OFXVP_OBJECT_CAT_MATH)
 
 #endif
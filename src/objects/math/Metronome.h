@@ -57,14 +57,20 @@ public:
 
     void            audioOutObject(ofSoundBuffer &outputBuffer) override;
 
+    void            controlTick(uint64_t nowNs);
+
     pdsp::Function          systemBPM;
     bool                    bpmMetro;
-    double                  mbpm;
-
-    size_t                  resetTime;
-    size_t                  metroTime;
-
-    bool                    sync;
+    std::atomic<bool>       bpmBeat;        // written by the audio thread
+    std::atomic<double>     mbpm;           // written by the audio thread
+
+    // control clock timing
+    int                     clockID;
+    uint64_t                nextBangNs;     // control clock thread only
+    std::atomic<uint64_t>   intervalNs;
+    std::atomic<bool>       syncRequest;
+    ofxVPEventQueue<256>    bangEvents;     // control clock thread -> graph update, one event per bang
+    std::atomic<uint64_t>   droppedBangs;
 
     bool                    loaded;
 
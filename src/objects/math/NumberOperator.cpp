@@ -53,6 +53,9 @@ NumberOperator::NumberOperator() : PatchObject("operator"){
     _operator           = Num_Operator_ADD;
     number              = 0.0f;
     loaded              = false;
+
+    this->setIsPureObj(true);
+    this->setIsThreadSafeObj(true);
 }
 
 //--------------------------------------------------------------
@@ -51,6 +51,8 @@ SimpleNoise::SimpleNoise() : PatchObject("1D noise"){
     step         = 0.001f;
 
     loaded      = false;
+
+    this->setIsThreadSafeObj(true);
 }
 
 //--------------------------------------------------------------
@@ -57,8 +57,6 @@ SimpleRandom::SimpleRandom() :
 
     this->initInletsState();
 
-    isAudioOUTObject        = true;
-
     bang            = false;
 
     forceInt        = false;
@@ -89,12 +87,6 @@ void SimpleRandom::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     ofSetRandomSeed(ofGetElapsedTimeMillis());
 }
 
-//--------------------------------------------------------------
-void SimpleRandom::setupAudioOutObjectContent(pdsp::Engine &engine){
-    unusedArgs(engine);
-
-}
-
 //--------------------------------------------------------------
 void SimpleRandom::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
@@ -113,6 +105,20 @@ void SimpleRandom::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchOb
         lastMaxRange.get()  = this->getCustomVar("MAX");
         forceInt            = static_cast<bool>(floor(this->getCustomVar("FORCE_INT")));
     }
+
+    if(this->inletsConnected[0]){
+        if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) < 1.0){
+            bang = false;
+        }else if(!bang){
+            bang = true;
+            if(forceInt){
+                *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = floor(ofRandom(lastMinRange.get(),lastMaxRange.get()));
+            }else{
+                *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = ofRandom(lastMinRange.get(),lastMaxRange.get());
+            }
+        }
+    }
+
 }
 
 //--------------------------------------------------------------
@@ -179,25 +185,6 @@ void SimpleRandom::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
 }
 
-//--------------------------------------------------------------
-void SimpleRandom::audioOutObject(ofSoundBuffer &outputBuffer){
-    unusedArgs(outputBuffer);
-
-    if(this->inletsConnected[0]){
-        if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) < 1.0){
-            bang = false;
-        }else if(!bang){
-            bang = true;
-            if(forceInt){
-                *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = floor(ofRandom(lastMinRange.get(),lastMaxRange.get()));
-            }else{
-                *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = ofRandom(lastMinRange.get(),lastMaxRange.get());
-            }
-        }
-    }
-
-}
-
 OBJECT_REGISTER( SimpleRandom, "simple random", OFXVP_OBJECT_CAT_MATH)
 
 #endif
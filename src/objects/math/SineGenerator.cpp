@@ -54,8 +54,6 @@ SineGenerator::SineGenerator() : PatchObject("sine generator")
     angle = 0.0f;
     increment = TWO_PI/360.0f;
 
-    isAudioOUTObject        = true;
-
     loaded  = false;
 
 }
@@ -77,12 +75,6 @@ void SineGenerator::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     unusedArgs(mainWindow);
 }
 
-//--------------------------------------------------------------
-void SineGenerator::setupAudioOutObjectContent(pdsp::Engine &engine){
-    unusedArgs(engine);
-
-}
-
 //--------------------------------------------------------------
 void SineGenerator::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
@@ -95,6 +87,20 @@ void SineGenerator::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchO
         loaded = true;
         increment = this->getCustomVar("SPEED");
     }
+
+    if(this->inletsConnected[0]){
+        if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) < 1.0){
+            bang = false;
+        }else if(!bang){
+            bang = true;
+            angle += increment;
+            if(angle >= TWO_PI || angle < 0.0f){
+                angle = 0.0f;
+            }
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = static_cast<float>(sin(angle));
+        }
+    }
+
 }
 
 //--------------------------------------------------------------
@@ -148,25 +154,6 @@ void SineGenerator::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
 }
 
-//--------------------------------------------------------------
-void SineGenerator::audioOutObject(ofSoundBuffer &outputBuffer){
-    unusedArgs(outputBuffer);
-
-    if(this->inletsConnected[0]){
-        if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]) < 1.0){
-            bang = false;
-        }else if(!bang){
-            bang = true;
-            angle += increment;
-            if(angle >= TWO_PI || angle < 0.0f){
-                angle = 0.0f;
-            }
-            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = static_cast<float>(sin(angle));
-        }
-    }
-
-}
-
 OBJECT_REGISTER( SineGenerator, "sine generator", OFXVP_OBJECT_CAT_MATH)
 
 #endif
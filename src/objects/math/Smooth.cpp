@@ -56,6 +56,8 @@ Smooth::Smooth() : PatchObject("smooth"){
 
     loaded = false;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
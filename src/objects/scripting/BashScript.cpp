@@ -343,6 +343,9 @@ void BashScript::loadScript(string scriptFile){
 void BashScript::reloadScript(){
     scriptLoaded = false;
     needToLoadScript = true;
+
+    // the script is loaded in the object thread, notify the new path from here ( main thread )
+    ofNotifyEvent(this->filepathChangedEvent,this->nId);
 }
 
 //--------------------------------------------------------------
@@ -619,6 +619,7 @@ void LuaScript::loadScript(string scriptFile){
     if(scriptLoaded  && !isError){
         watcher.removeAllPaths();
         watcher.addPath(filepath);
+        ofNotifyEvent(this->filepathChangedEvent,this->nId);
         ofLog(OF_LOG_NOTICE,"-- lua script: %s loaded & running!",filepath.c_str());
         this->saveConfig(false);
     }
@@ -795,6 +795,7 @@ void ShaderObject::loadScript(string scriptFile){
                 if(vertexShader != ""){
                     watcher.addPath(vertexShaderFile.getAbsolutePath());
                 }
+                ofNotifyEvent(this->filepathChangedEvent,this->nId);
                 doFragmentShader();
             }
         }else{
@@ -809,6 +810,7 @@ void ShaderObject::loadScript(string scriptFile){
                 if(vertexShader != ""){
                     watcher.addPath(vertexShaderFile.getAbsolutePath());
                 }
+                ofNotifyEvent(this->filepathChangedEvent,this->nId);
                 doFragmentShader();
             }
         }
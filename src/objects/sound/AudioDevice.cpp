@@ -74,10 +74,6 @@ void AudioDevice::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
     loadDeviceInfo();
 
-    ofDisableArbTex();
-    bg->load("images/audioDevice_bg.jpg");
-    ofEnableArbTex();
-
 }
 
 //--------------------------------------------------------------
@@ -121,6 +117,13 @@ void AudioDevice::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRen
 //--------------------------------------------------------------
 void AudioDevice::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
 
+    // background loaded on first draw ( no GL needed by the offline/headless audio backend )
+    if(!bg->isAllocated()){
+        ofDisableArbTex();
+        bg->load("images/audioDevice_bg.jpg");
+        ofEnableArbTex();
+    }
+
     // CONFIG GUI inside Menu
     if(_nodeCanvas.BeginNodeMenu()){
 
@@ -211,6 +214,17 @@ void AudioDevice::audioOutObject(ofSoundBuffer &outputBuffer){
     }
 }
 
+//--------------------------------------------------------------
+void AudioDevice::audioSilenceObject(ofSoundBuffer &silenceBuffer){
+    // channels layout stable here ( resetSystemObject holds audioStateMutex )
+    for(size_t c=0;c<PN_IN_CH.size();c++){
+        PN_IN_CH.at(c).copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+    }
+    for(size_t c=0;c<OUT_CH.size();c++){
+        OUT_CH.at(c).copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+    }
+}
+
 //--------------------------------------------------------------
 void AudioDevice::resetSystemObject(){
 
@@ -223,6 +237,9 @@ void AudioDevice::resetSystemObject(){
         }
     }
 
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+    // channels layout, read by the audio silence path
+    std::lock_guard<std::mutex> stateLck(audioStateMutex);
     ofxXmlSettings XML;
 
     deviceLoaded      = false;
@@ -369,11 +386,7 @@ void AudioDevice::resetSystemObject(){
             }
         }
 
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,patchFile);
 
         deviceLoaded      = true;
     }
@@ -384,6 +397,9 @@ void AudioDevice::resetSystemObject(){
 //--------------------------------------------------------------
 void AudioDevice::loadDeviceInfo(){
 
+    // channels layout, read by the audio silence path
+    std::lock_guard<std::mutex> stateLck(audioStateMutex);
+
     vector<bool> tempInletsConn;
     for(int i=0;i<this->numInlets;i++){
         if(this->inletsConnected[i]){
@@ -55,6 +55,7 @@ public:
 
     void            audioInObject(ofSoundBuffer &inputBuffer) override;
     void            audioOutObject(ofSoundBuffer &outputBuffer) override;
+    void            audioSilenceObject(ofSoundBuffer &silenceBuffer) override;
 
     void            resetSystemObject() override;
 
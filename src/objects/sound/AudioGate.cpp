@@ -51,11 +51,13 @@ AudioGate::AudioGate() : PatchObject("signal gate"){
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     this->initInletsState();
 
     openInlet           = 0;
-    changedOpenInlet    = false;
+    wiredInlet          = 0;
+    audioOpenInlet      = 0;
 
     dataInlets      = 6;
 
@@ -102,9 +104,6 @@ void AudioGate::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjec
     unusedArgs(patchObjects);
 
     if(this->inletsConnected[0]){
-        if(static_cast<int>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]))) != openInlet){
-            changedOpenInlet = true;
-        }
         openInlet = static_cast<int>(floor(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0])));
     }
 
@@ -122,7 +121,18 @@ void AudioGate::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjec
         this->height            = prevH;
         openInlet = this->getCustomVar("OPEN");
     }
-    
+
+    // pdsp rewiring, structural change ( audio thread plays silence meanwhile )
+    if(openInlet != wiredInlet){
+        std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
+        wiredInlet = openInlet;
+        this->pdspOut[0].disconnectIn();
+        if(wiredInlet >= 1 && wiredInlet < this->numInlets){
+            this->pdspIn[wiredInlet] >> this->pdspOut[0];
+        }
+    }
+    audioOpenInlet = openInlet;
+
 }
 
 //--------------------------------------------------------------
@@ -221,21 +231,15 @@ void AudioGate::removeObjectContent(bool removeFileFromData){
 void AudioGate::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    if(changedOpenInlet){
-        changedOpenInlet = false;
-        this->pdspOut[0].disconnectIn();
-        if(openInlet >= 1 && openInlet < this->numInlets){
-            this->pdspIn[openInlet] >> this->pdspOut[0];
-        }
-    }
+    int gateInlet = audioOpenInlet.load();
 
-    if(openInlet >= 1 && openInlet < this->numInlets){
-        if(this->inletsConnected[openInlet] && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[openInlet])->getBuffer().empty()){
-            *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0]) = *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[openInlet]);
+    if(gateInlet >= 1 && gateInlet < this->numInlets){
+        if(this->inletsConnected[gateInlet] && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[gateInlet])->getBuffer().empty()){
+            *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0]) = *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[gateInlet]);
         }else{
             ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->set(0.0f);
         }
-    }else if(openInlet == 0){
+    }else if(gateInlet == 0){
         ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->set(0.0f);
     }
 }
@@ -252,6 +256,9 @@ void AudioGate::initInlets(){
 //--------------------------------------------------------------
 void AudioGate::resetInletsSettings(){
 
+    // inlets layout, structural change ( audio thread plays silence meanwhile )
+    std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
+
     vector<bool> tempInletsConn;
     for(int i=0;i<this->numInlets;i++){
         if(this->inletsConnected[i]){
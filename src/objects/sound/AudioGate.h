@@ -58,7 +58,8 @@ public:
     void            resetInletsSettings();
 
     int             openInlet;
-    bool            changedOpenInlet;
+    int             wiredInlet;         // inlet patched to the pdsp output
+    std::atomic<int> audioOpenInlet;    // read by the audio thread
 
     int             dataInlets;
     bool            needReset;
@@ -52,6 +52,7 @@ Crossfader::Crossfader() : PatchObject("crossfader"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     fade_value              = 0.0f;
 
@@ -67,6 +67,8 @@ FrequencyToNote::FrequencyToNote() : PatchObject("frequency to note"){
     loaded              = false;
 
     this->width         *= 1.4f;
+
+    this->setIsThreadSafeObj(true);
 }
 
 //--------------------------------------------------------------
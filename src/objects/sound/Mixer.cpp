@@ -65,6 +65,7 @@ Mixer::Mixer() : PatchObject("mixer"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     needReset       = false;
     loaded          = false;
@@ -325,6 +326,9 @@ void Mixer::initInlets(){
 //--------------------------------------------------------------
 void Mixer::resetInletsSettings(){
 
+    // inlets and pdsp rewiring, structural change ( audio thread plays silence meanwhile )
+    std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
+
     mixL.disconnectIn();
     mixR.disconnectIn();
 
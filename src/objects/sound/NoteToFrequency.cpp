@@ -100,6 +100,8 @@ NoteToFrequency::NoteToFrequency() : PatchObject("note to frequency"){
     loaded              = false;
 
     this->width         *= 1.4f;
+
+    this->setIsThreadSafeObj(true);
 }
 
 //--------------------------------------------------------------
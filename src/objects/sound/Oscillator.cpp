@@ -73,6 +73,7 @@ Oscillator::Oscillator() : PatchObject("oscillator"){
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     loaded                  = false;
 
@@ -201,6 +202,15 @@ void Oscillator::setupAudioOutObjectContent(pdsp::Engine &engine){
 void Oscillator::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
 
+    // latest signal buffer data from the audio thread
+    if(scopeChannel.update()){
+        const vector<float> &scopeData = scopeChannel.getReadBuffer();
+        for(size_t i=0;i<scopeData.size();i++){
+            plot_data[i] = hardClip(scopeData[i]);
+            ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[6])->at(i) = scopeData[i];
+        }
+    }
+
     // silence pitch 0
     if(pitch_float <= 0.0f){
         level_float = 0.0f;
@@ -418,6 +428,7 @@ void Oscillator::loadAudioSettings(){
                 ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[6])->push_back(0.0f);
                 plot_data[i] = 0.0f;
             }
+            scopeChannel.reset(vector<float>(bufferSize,0.0f));
 
             XML.popTag();
         }
@@ -428,12 +439,11 @@ void Oscillator::loadAudioSettings(){
 void Oscillator::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    for(size_t i = 0; i < scope.getBuffer().size(); i++) {
-        float sample = scope.getBuffer().at(i);
-        plot_data[i] = hardClip(sample);
-
-        // SIGNAL BUFFER DATA
-        ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[6])->at(i) = sample;
+    // SIGNAL BUFFER DATA, to the main thread ( waveform and data outlet )
+    vector<float> &scopeData = scopeChannel.getWriteBuffer();
+    if(scopeData.size() == scope.getBuffer().size()){
+        std::copy(scope.getBuffer().begin(),scope.getBuffer().end(),scopeData.begin());
+        scopeChannel.publish();
     }
     // SIGNALS BUFFERS
     ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
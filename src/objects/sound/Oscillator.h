@@ -35,6 +35,7 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPTripleBuffer.h"
 
 #include "imgui-knobs.h"
 
@@ -102,6 +103,7 @@ public:
 
     float                   *plot_data;
     int                     bufferSize;
+    ofxVPTripleBuffer<vector<float>> scopeChannel;   // audio -> control, signal buffer data
     int                     sampleRate;
 
     bool                    loaded;
@@ -377,6 +377,19 @@ void PDPatch::audioOutObject(ofSoundBuffer &outputBuffer){
     *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[3]) = lastOutputBuffer4;
 }
 
+//--------------------------------------------------------------
+void PDPatch::audioSilenceObject(ofSoundBuffer &silenceBuffer){
+    ch1IN.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+    ch2IN.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+    ch3IN.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+    ch4IN.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+
+    ch1OUT.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+    ch2OUT.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+    ch3OUT.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+    ch4OUT.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+}
+
 //--------------------------------------------------------------
 void PDPatch::loadAudioSettings(){
     ofxXmlSettings XML;
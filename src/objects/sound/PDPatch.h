@@ -64,6 +64,7 @@ public:
 
     void            audioInObject(ofSoundBuffer &inputBuffer) override;
     void            audioOutObject(ofSoundBuffer &outputBuffer) override;
+    void            audioSilenceObject(ofSoundBuffer &silenceBuffer) override;
 
     void            loadAudioSettings();
     void            loadPatch(string scriptFile);
@@ -52,6 +52,7 @@ Panner::Panner() : PatchObject("panner"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     pan                     = 0.0f;
 
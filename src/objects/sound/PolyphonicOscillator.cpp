@@ -68,6 +68,7 @@ PolyphonicOscillator::PolyphonicOscillator() : PatchObject("polyphonic oscillato
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     loaded                  = false;
 
@@ -244,6 +245,15 @@ void PolyphonicOscillator::setupAudioOutObjectContent(pdsp::Engine &engine){
 void PolyphonicOscillator::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
 
+    // latest signal buffer data from the audio thread
+    if(scopeChannel.update()){
+        const vector<float> &scopeData = scopeChannel.getReadBuffer();
+        for(size_t i=0;i<scopeData.size();i++){
+            plot_data[i] = hardClip(scopeData[i]);
+            ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[5])->at(i) = scopeData[i];
+        }
+    }
+
     if(this->inletsConnected[0] && ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->size()>0){
         size_t counter = 0;
         size_t activeVoices = 0;
@@ -481,6 +491,7 @@ void PolyphonicOscillator::loadAudioSettings(){
                 ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[5])->push_back(0.0f);
                 plot_data[i] = 0.0f;
             }
+            scopeChannel.reset(vector<float>(bufferSize,0.0f));
 
             XML.popTag();
         }
@@ -491,12 +502,11 @@ void PolyphonicOscillator::loadAudioSettings(){
 void PolyphonicOscillator::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    for(size_t i = 0; i < scope.getBuffer().size(); i++) {
-        float sample = scope.getBuffer().at(i);
-        plot_data[i] = hardClip(sample);
-
-        // SIGNAL BUFFER DATA
-        ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[5])->at(i) = sample;
+    // SIGNAL BUFFER DATA, to the main thread ( waveform and data outlet )
+    vector<float> &scopeData = scopeChannel.getWriteBuffer();
+    if(scopeData.size() == scope.getBuffer().size()){
+        std::copy(scope.getBuffer().begin(),scope.getBuffer().end(),scopeData.begin());
+        scopeChannel.publish();
     }
     // SIGNALS BUFFERS
     ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
@@ -59,6 +59,7 @@ QuadPanner::QuadPanner() : PatchObject("quad panner"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     loaded                  = false;
 
@@ -55,6 +55,7 @@ SamplePlayer::SamplePlayer() : PatchObject("sample player"){
     this->initInletsState();
 
     isAudioOUTObject    = true;
+    isLockFreeAudioObject   = true;
 
     isNewObject         = true;
     isFileLoaded        = false;
@@ -70,7 +71,10 @@ SamplePlayer::SamplePlayer() : PatchObject("sample player"){
     loadSoundfileFlag   = false;
     soundfileLoaded     = false;
     loadingFile         = false;
-    hasTriggered        = false;
+    gateValue           = 0.0f;
+
+    sampleBuffer        = make_shared<pdsp::SampleBuffer>();
+    playingSample       = nullptr;
 
     isPDSPPatchableObject   = true;
 
@@ -122,14 +126,11 @@ void SamplePlayer::setupAudioOutObjectContent(pdsp::Engine &engine){
 
     // ---- this code runs in the audio thread ----
     sseq.code = [&]() noexcept {
-        if(this->inletsConnected[0]){
-            if(ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]),0.0f,1.0f) == 1.0f && !hasTriggered){
-                hasTriggered = true;
-                trigger.trigger(1.0f);
-            }else{
-                hasTriggered = false;
-                trigger.off();
-            }
+        // swap in the last loaded sample ( the replaced one is freed on the main thread )
+        pdsp::SampleBuffer *sample = sampleAsset.acquire();
+        if(sample != nullptr && sample != playingSample){
+            sampler.setSample(sample,0);
+            playingSample = sample;
         }
     };
 
@@ -147,7 +148,7 @@ void SamplePlayer::setupAudioOutObjectContent(pdsp::Engine &engine){
     start_ctrl >> sampler.in_start();
     start_ctrl.set(0.0f);
 
-    trigger >> sampler;
+    trigger.out_trig() >> sampler;
 
     sampler >> gainAmp >> this->pdspOut[0];
     sampler >> gainAmp >> scope >> engine.blackhole();
@@ -159,6 +160,26 @@ void SamplePlayer::setupAudioOutObjectContent(pdsp::Engine &engine){
 void SamplePlayer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
 
+    // free the samples the audio thread is done with
+    sampleAsset.collect();
+
+    // latest signal buffer data from the audio thread
+    if(scopeChannel.update()){
+        *ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1]) = scopeChannel.getReadBuffer();
+    }
+
+    // bangs ( every bang of the frame, applied at its exact sample in the audio thread )
+    const ofxVPEventList<> &bangs = this->getInletEvents(0);
+    for(size_t i=0;i<bangs.size();i++){
+        float gate = ofClamp(bangs[i].value,0.0f,1.0f) == 1.0f ? 1.0f : 0.0f;
+        if(gate > 0.0f){
+            trigger.trigger(bangs[i].timeNs,gate);
+        }else if(gateValue > 0.0f){
+            trigger.off(bangs[i].timeNs);
+        }
+        gateValue = gate;
+    }
+
     if(soundfileLoaded && ofGetElapsedTimeMillis()-startTime > 100){
         soundfileLoaded = false;
         ofFile file (lastSoundfile);
@@ -178,12 +199,12 @@ void SamplePlayer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchOb
         loading = false;
     }
 
-    if(!isFileLoaded && sampleBuffer.loaded() && sampleBuffer.fileSampleRate > 100){
+    if(!isFileLoaded && sampleBuffer->loaded() && sampleBuffer->fileSampleRate > 100){
         isFileLoaded = true;
-        ofLog(OF_LOG_NOTICE,"-- sound file loaded: %s, Sample Rate: %s, Audiofile length: %s",filepath.c_str(), ofToString(sampleBuffer.fileSampleRate).c_str(), ofToString(sampleBuffer.length).c_str());
+        ofLog(OF_LOG_NOTICE,"-- sound file loaded: %s, Sample Rate: %s, Audiofile length: %s",filepath.c_str(), ofToString(sampleBuffer->fileSampleRate).c_str(), ofToString(sampleBuffer->length).c_str());
     }
 
-    if(isFileLoaded && sampleBuffer.loaded()){
+    if(isFileLoaded && sampleBuffer->loaded()){
         // pitch
         if(this->inletsConnected[1]){
             pitch = ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1]),1.0f,10.0f);
@@ -258,7 +279,7 @@ void SamplePlayer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
 
     // Visualize (Object main view)
     if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
-        if(isFileLoaded && sampleBuffer.loaded()){
+        if(isFileLoaded && sampleBuffer->loaded()){
             ImVec2 window_pos = ImGui::GetWindowPos();
             ImVec2 window_size = ImVec2(this->width*_nodeCanvas.GetCanvasScale(),this->height*_nodeCanvas.GetCanvasScale());
             ImVec2 ph_pos = ImVec2(window_pos.x + (20*scaleFactor), window_pos.y + (20*scaleFactor));
@@ -271,8 +292,8 @@ void SamplePlayer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
             // draw Audiofile Waveform plot
             _nodeCanvas.getNodeDrawList()->AddRectFilled(ImVec2(objOriginX,objOriginY),ImVec2(objOriginX+scaledObjW,objOriginY+scaledObjH),IM_COL32_BLACK);
             for( int x=objOriginX; x<objOriginX+scaledObjW; ++x ){
-                int n = ofMap( x, objOriginX, objOriginX+scaledObjW, 0, sampleBuffer.length, true );
-                float val = sampleBuffer.buffer[0][n];
+                int n = ofMap( x, objOriginX, objOriginX+scaledObjW, 0, sampleBuffer->length, true );
+                float val = sampleBuffer->buffer[0][n];
                 _nodeCanvas.getNodeDrawList()->AddLine(ImVec2(x, objOriginY + scaledObjH/2 - (val*(scaledObjH*0.5)) ),ImVec2(x, objOriginY + scaledObjH/2 + (val*(scaledObjH*0.5))),IM_COL32(255,255,120,180), 1.0f);
             }
 
@@ -282,7 +303,7 @@ void SamplePlayer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
 
         }else if(loadingFile){
             ImGui::Text("LOADING SAMPLE...");
-        }else if(!isNewObject && !sampleBuffer.loaded()){
+        }else if(!isNewObject && !sampleBuffer->loaded()){
             ImGui::Text("SAMPLE NOT FOUND!");
         }
 
@@ -313,7 +334,7 @@ void SamplePlayer::drawObjectNodeConfig(){
     }else{
         ImGui::Text("%s",tempFilename.getFileName().c_str());
         if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s",tempFilename.getAbsolutePath().c_str());
-        ImGui::Text("Duration (ms): %.0f",sampleBuffer.length/sampleBuffer.fileSampleRate*1000);
+        ImGui::Text("Duration (ms): %.0f",sampleBuffer->length/sampleBuffer->fileSampleRate*1000);
     }
     if(ImGui::Button(ICON_FA_FILE,ImVec2(224*scaleFactor,26*scaleFactor))){
         loadSoundfileFlag = true;
@@ -327,7 +348,7 @@ void SamplePlayer::drawObjectNodeConfig(){
     ImGui::PushStyleColor(ImGuiCol_ButtonHovered, VHS_BLUE_OVER);
     ImGui::PushStyleColor(ImGuiCol_ButtonActive, VHS_BLUE_OVER);
     if(ImGui::Button(ICON_FA_PLAY,ImVec2(69*scaleFactor,26*scaleFactor))){
-        trigger.trigger(1.0f);
+        trigger.trigger(getControlClock().now(),1.0f);
     }
     ImGui::PopStyleColor(3);
 
@@ -393,7 +414,12 @@ void SamplePlayer::audioOutObject(ofSoundBuffer &outputBuffer){
 
     ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
 
-    *ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1]) = scope.getBuffer();
+    // to the main thread ( data outlet )
+    vector<float> &scopeData = scopeChannel.getWriteBuffer();
+    if(scopeData.size() == scope.getBuffer().size()){
+        std::copy(scope.getBuffer().begin(),scope.getBuffer().end(),scopeData.begin());
+        scopeChannel.publish();
+    }
 
 }
 
@@ -416,6 +442,7 @@ void SamplePlayer::loadSettings(){
     for(int i=0;i<bufferSize;i++){
         ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1])->push_back(0.0f);
     }
+    scopeChannel.reset(vector<float>(bufferSize,0.0f));
 
 }
 
@@ -430,8 +457,11 @@ void SamplePlayer::loadAudioFile(string audiofilepath){
 
     loadingFile = true;
 
-    sampleBuffer.load(filepath);
-    sampler.setSample(&sampleBuffer,0);
+    // decode into a new buffer, the audio thread keeps playing the old one until it swaps
+    shared_ptr<pdsp::SampleBuffer> newSample = make_shared<pdsp::SampleBuffer>();
+    newSample->load(filepath);
+    sampleBuffer = newSample;
+    sampleAsset.publish(sampleBuffer);
 
     this->saveConfig(false);
 
@@ -35,6 +35,8 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPAudioAsset.h"
+#include "ofxVPTripleBuffer.h"
 
 #include "ImGuiFileBrowser.h"
 #include "IconsFontAwesome5.h"
@@ -77,22 +79,25 @@ public:
     bool                isFileLoaded;
     bool                loadingFile;
 
-    pdsp::TriggerControl    trigger;
+    ofxVPTriggerControl     trigger;
     pdsp::Function          sseq;
     pdsp::Sampler           sampler;
-    pdsp::SampleBuffer      sampleBuffer;
+    shared_ptr<pdsp::SampleBuffer>          sampleBuffer;
+    ofxVPAudioAsset<pdsp::SampleBuffer>     sampleAsset;    // control -> audio, loaded sample
+    pdsp::SampleBuffer      *playingSample;                 // audio thread
     pdsp::Amp               gainAmp;
     pdsp::ValueControl      pitch_ctrl;
     pdsp::ValueControl      gain_ctrl;
     pdsp::ValueControl      direction_ctrl;
     pdsp::ValueControl      start_ctrl;
-    bool                    hasTriggered;
+    float                   gateValue;
 
     pdsp::Scope         scope;
     float               *plot_data;
     double              step;
     double              sampleRate;
     int                 bufferSize;
+    ofxVPTripleBuffer<vector<float>> scopeChannel;   // audio -> control, signal buffer data
 
     size_t              startTime;
     bool                loading;
@@ -51,6 +51,7 @@ SigMult::SigMult() : PatchObject("amplifier"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     gainValue               = 1.0f;
 
@@ -48,6 +48,7 @@ SignalOperator::SignalOperator() : PatchObject("signal operator"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     this->initInletsState();
 
@@ -67,7 +68,7 @@ void SignalOperator::newObject(){
 
     this->addOutlet(VP_LINK_AUDIO,"result");
 
-    this->setCustomVar(_operator,"OPERATOR");
+    this->setCustomVar(static_cast<float>(_operator.load()),"OPERATOR");
 
 }
 
@@ -97,7 +98,7 @@ void SignalOperator::updateObjectContent(map<int,shared_ptr<PatchObject>> &patch
 
     if(!loaded){
         loaded = true;
-        _operator = this->getCustomVar("OPERATOR");
+        _operator = static_cast<int>(this->getCustomVar("OPERATOR"));
     }
 
 }
@@ -135,12 +136,12 @@ void SignalOperator::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
         ImGui::SetCursorPos(ImVec2(IMGUI_EX_NODE_PINS_WIDTH_NORMAL+(4*scaleFactor), (this->height/2 *_nodeCanvas.GetCanvasScale()) - (6*scaleFactor)));
 
         ImGui::PushItemWidth(-50*scaleFactor);
-        if(ImGui::BeginCombo("operator", operators_string.at(_operator).c_str() )){
+        if(ImGui::BeginCombo("operator", operators_string.at(_operator.load()).c_str() )){
             for(int i=0; i < static_cast<int>(operators_string.size()); ++i){
                 bool is_selected = (_operator == i );
                 if (ImGui::Selectable(operators_string.at(i).c_str(), is_selected)){
                     _operator = i;
-                    this->setCustomVar(_operator,"OPERATOR");
+                    this->setCustomVar(static_cast<float>(i),"OPERATOR");
                 }
                 if (is_selected) ImGui::SetItemDefaultFocus();
             }
@@ -168,27 +169,37 @@ void SignalOperator::removeObjectContent(bool removeFileFromData){
 void SignalOperator::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getBuffer().empty() && this->inletsConnected[1] && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[1])->getBuffer().empty() && monoBuffer.getNumFrames() == ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getNumFrames() && monoBuffer.getNumFrames() == ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[1])->getNumFrames()){
-        for(size_t i = 0; i < monoBuffer.getNumFrames(); i++) {
-            if(_operator == Sig_Operator_ADD){
-                monoBuffer.getSample(i,0) = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getSample(i, 0) + ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[1])->getSample(i, 0);
-            }else if(_operator == Sig_Operator_SUBTRACT){
-                monoBuffer.getSample(i,0) = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getSample(i, 0) - ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[1])->getSample(i, 0);
-            }else if(_operator == Sig_Operator_MULTIPLY){
-                monoBuffer.getSample(i,0) = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getSample(i, 0) * ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[1])->getSample(i, 0);
-            }else if(_operator == Sig_Operator_DIVIDE){
+    ofSoundBuffer *signalA = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0]);
+    ofSoundBuffer *signalB = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[1]);
+
+    if(this->inletsConnected[0] && !signalA->getBuffer().empty() && this->inletsConnected[1] && !signalB->getBuffer().empty()){
+        // block size agnostic: operate on the frames common to both signals
+        size_t numFrames = std::min(signalA->getNumFrames(),signalB->getNumFrames());
+        int op = _operator.load();
+        if(monoBuffer.getNumFrames() != numFrames){
+            monoBuffer.allocate(numFrames,1);
+        }
+
+        for(size_t i = 0; i < numFrames; i++) {
+            if(op == Sig_Operator_ADD){
+                monoBuffer.getSample(i,0) = signalA->getSample(i, 0) + signalB->getSample(i, 0);
+            }else if(op == Sig_Operator_SUBTRACT){
+                monoBuffer.getSample(i,0) = signalA->getSample(i, 0) - signalB->getSample(i, 0);
+            }else if(op == Sig_Operator_MULTIPLY){
+                monoBuffer.getSample(i,0) = signalA->getSample(i, 0) * signalB->getSample(i, 0);
+            }else if(op == Sig_Operator_DIVIDE){
                 // avoid division by zero
-                if(ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[1])->getSample(i, 0) == 0.0f){
-                    monoBuffer.getSample(i,0) = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getSample(i, 0) / ( 0.000001f + ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[1])->getSample(i, 0));
+                if(signalB->getSample(i, 0) == 0.0f){
+                    monoBuffer.getSample(i,0) = signalA->getSample(i, 0) / ( 0.000001f + signalB->getSample(i, 0));
                 }else{
-                    monoBuffer.getSample(i,0) = ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getSample(i, 0) / ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[1])->getSample(i, 0);
+                    monoBuffer.getSample(i,0) = signalA->getSample(i, 0) / signalB->getSample(i, 0);
                 }
             }else{
                 monoBuffer.getSample(i,0) = 0.0f;
             }
-
-            lastBuffer = monoBuffer;
         }
+
+        lastBuffer = monoBuffer;
     }else if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0])->getBuffer().empty() && !this->inletsConnected[1]){
         lastBuffer= *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_inletParams[0]);
     }else{
@@ -201,6 +212,11 @@ void SignalOperator::audioOutObject(ofSoundBuffer &outputBuffer){
 
 }
 
+//--------------------------------------------------------------
+void SignalOperator::audioSilenceObject(ofSoundBuffer &silenceBuffer){
+    buffer.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
+}
+
 //--------------------------------------------------------------
 void SignalOperator::loadSettings(){
     ofxXmlSettings XML;
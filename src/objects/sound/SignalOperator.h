@@ -56,6 +56,7 @@ public:
     void            removeObjectContent(bool removeFileFromData=false) override;
 
     void            audioOutObject(ofSoundBuffer &outputBuffer) override;
+    void            audioSilenceObject(ofSoundBuffer &silenceBuffer) override;
 
     void            loadSettings();
 
@@ -67,7 +68,7 @@ public:
     pdsp::ExternalInput     buffer;
 
     vector<string>          operators_string;
-    int                     _operator;
+    std::atomic<int>        _operator;          // read by the audio thread
 
     double                  sampleRate;
     int                     bufferSize;
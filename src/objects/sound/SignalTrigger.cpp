@@ -52,6 +52,7 @@ SignalTrigger::SignalTrigger() : PatchObject("signal trigger"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     thresh                  = 0.5f;
 
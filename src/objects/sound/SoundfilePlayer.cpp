@@ -66,9 +66,15 @@ SoundfilePlayer::SoundfilePlayer() : PatchObject("soundfile player"){
 
     isNewObject         = true;
     isFileLoaded        = false;
+    lastMessage         = "";
+
+    audiofile           = make_shared<ofxAudioFile>();
+    playingFile         = nullptr;
+    playhead            = 0.0;
     isPlaying           = false;
     audioWasPlaying     = false;
-    lastMessage         = "";
+    finishCount         = 0;
+    lastFinishCount     = 0;
 
     loop                = false;
     volume              = 1.0f;
@@ -83,9 +89,16 @@ SoundfilePlayer::SoundfilePlayer() : PatchObject("soundfile player"){
 
     finishSemaphore     = false;
     finishBang          = false;
-    isNextCycle         = false;
+
+    cueIN               = 0.0;
+    cueOUT              = 0.0;
+    step                = 1.0;
+
+    audioParams         = { volume, speed, loop, cueIN, cueOUT, step, -1.0 };
+    paramsChannel.reset(audioParams);
 
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     this->width         *= 2;
 
@@ -149,6 +162,14 @@ void SoundfilePlayer::setupAudioOutObjectContent(pdsp::Engine &engine){
 void SoundfilePlayer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
 
+    // triggers ( every bang of the frame, applied at its exact sample in the audio thread )
+    const ofxVPEventList<> &triggers = this->getInletEvents(6);
+    for(size_t i=0;i<triggers.size();i++){
+        if(ofClamp(triggers[i].value,0.0f,1.0f) == 1.0f){
+            triggerEvents.push(triggers[i].timeNs,1.0f);
+        }
+    }
+
     if(soundfileLoaded && ofGetElapsedTimeMillis()-startTime > 100){
         soundfileLoaded = false;
         ofFile file (lastSoundfile);
@@ -168,32 +189,32 @@ void SoundfilePlayer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patc
         loading = false;
     }
 
-    if(!isFileLoaded && audiofile.loaded() && audiofile.samplerate() > 100){
+    if(!isFileLoaded && audiofile->loaded() && audiofile->samplerate() > 100){
         isFileLoaded = true;
-        ofLog(OF_LOG_NOTICE,"-- sound file loaded: %s, Sample Rate: %s, Audiofile length: %s",filepath.c_str(), ofToString(audiofile.samplerate()).c_str(), ofToString(audiofile.length()).c_str());
+        ofLog(OF_LOG_NOTICE,"-- sound file loaded: %s, Sample Rate: %s, Audiofile length: %s",filepath.c_str(), ofToString(audiofile->samplerate()).c_str(), ofToString(audiofile->length()).c_str());
     }
 
-    if(isFileLoaded && audiofile.loaded()){
+    // playing state from the audio thread, and the files it does not play anymore released
+    stateChannel.update();
+    fileAsset.collect();
+    const SoundfilePlayerState &state = stateChannel.getReadBuffer();
+
+    double seek = -1.0;
+
+    if(isFileLoaded && audiofile->loaded()){
         // listen to message control (_inletParams[0])
         if(this->inletsConnected[0]){
             if(lastMessage != *ofxVP_CAST_PIN_PTR<string>(this->_inletParams[0])){
                 lastMessage = *ofxVP_CAST_PIN_PTR<string>(this->_inletParams[0]);
 
                 if(lastMessage == "play"){
-                    isPlaying = true;
-                    playhead = 0.0;
-                    audioWasPlaying = true;
-                    finishSemaphore = true;
+                    sendCommand(Soundfile_Command_Play);
                 }else if(lastMessage == "pause"){
-                    isPlaying = false;
+                    sendCommand(Soundfile_Command_Pause);
                 }else if(lastMessage == "unpause"){
-                    if(audioWasPlaying){
-                        isPlaying = true;
-                    }
+                    sendCommand(Soundfile_Command_Unpause);
                 }else if(lastMessage == "stop"){
-                    isPlaying = false;
-                    playhead = 0.0;
-                    audioWasPlaying = false;
+                    sendCommand(Soundfile_Command_Stop);
                 }else if(lastMessage == "loop_normal"){
                     loop = true;
                 }else if(lastMessage == "loop_none"){
@@ -203,7 +224,7 @@ void SoundfilePlayer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patc
         }
         // playhead
         if(this->inletsConnected[1] && *ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1]) != -1.0f){
-            playhead = static_cast<double>(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1])) * audiofile.length();
+            seek = static_cast<double>(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1])) * audiofile->length();
         }
         // speed
         if(this->inletsConnected[2]){
@@ -221,10 +242,14 @@ void SoundfilePlayer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patc
 
         // cue OUT
         if(this->inletsConnected[5]){
-            cueOUT = static_cast<double>(ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[5]),cueIN+2, audiofile.length()-2));
+            cueOUT = static_cast<double>(ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[5]),cueIN+2, audiofile->length()-2));
         }
 
         // outlet finish bang
+        if(state.finishCount != lastFinishCount){
+            lastFinishCount = state.finishCount;
+            finishBang = true;
+        }
         if(finishBang){
             *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[2]) = 1.0f;
         }else{
@@ -245,16 +270,24 @@ void SoundfilePlayer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patc
         volume = static_cast<float>(this->getCustomVar("VOLUME"));
         cueIN = static_cast<double>(this->getCustomVar("CUE_IN"));
         cueOUT = static_cast<double>(this->getCustomVar("CUE_OUT"));
+    }
 
-        if(playhead < cueIN){
-            playhead = cueIN;
-        }
-
-        if(playhead > cueOUT){
-            playhead = cueOUT;
-        }
+    // outlet audio buffer
+    if(ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1])->size() == state.scope.size()){
+        *ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1]) = state.scope;
     }
 
+    // player settings to the audio thread
+    SoundfilePlayerParams &params = paramsChannel.getWriteBuffer();
+    params.volume   = volume;
+    params.speed    = speed;
+    params.loop     = loop;
+    params.cueIN    = cueIN;
+    params.cueOUT   = cueOUT;
+    params.step     = step;
+    params.seek     = seek;
+    paramsChannel.publish();
+
 }
 
 //--------------------------------------------------------------
@@ -284,7 +317,9 @@ void SoundfilePlayer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
 
     // Visualize (Object main view)
     if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
-        if(isFileLoaded && audiofile.loaded()){
+        if(isFileLoaded && audiofile->loaded()){
+            const SoundfilePlayerState &state = stateChannel.getReadBuffer();
+
             ImVec2 window_pos = ImGui::GetWindowPos();
             ImVec2 window_size = ImVec2(this->width*_nodeCanvas.GetCanvasScale(),this->height*_nodeCanvas.GetCanvasScale());
             ImVec2 ph_pos = ImVec2(window_pos.x + (20*scaleFactor), window_pos.y + (20*scaleFactor));
@@ -297,37 +332,37 @@ void SoundfilePlayer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
             // draw Audiofile Waveform plot
             _nodeCanvas.getNodeDrawList()->AddRectFilled(ImVec2(objOriginX,objOriginY),ImVec2(objOriginX+scaledObjW,objOriginY+scaledObjH),IM_COL32_BLACK);
             for( int x=objOriginX; x<objOriginX+scaledObjW; ++x ){
-                int n = ofMap( x, objOriginX, objOriginX+scaledObjW, 0, audiofile.length(), true );
-                float val = audiofile.sample( n, 0 );
+                int n = ofMap( x, objOriginX, objOriginX+scaledObjW, 0, audiofile->length(), true );
+                float val = audiofile->sample( n, 0 );
                 _nodeCanvas.getNodeDrawList()->AddLine(ImVec2(x, objOriginY + scaledObjH/2 - (val*(scaledObjH*0.5)) ),ImVec2(x, objOriginY + scaledObjH/2 + (val*(scaledObjH*0.5))),IM_COL32(255,255,120,180), 1.0f);
             }
 
             // draw position (timecode)
-            ImGuiEx::drawTimecode(_nodeCanvas.getNodeDrawList(),static_cast<int>(ceil(static_cast<int>(floor(playhead))/audiofile.samplerate())),"",true,ImVec2(window_pos.x +(40*_nodeCanvas.GetCanvasScale()), window_pos.y+window_size.y-(36*_nodeCanvas.GetCanvasScale())),_nodeCanvas.GetCanvasScale()/this->scaleFactor);
+            ImGuiEx::drawTimecode(_nodeCanvas.getNodeDrawList(),static_cast<int>(ceil(static_cast<int>(floor(state.playhead))/audiofile->samplerate())),"",true,ImVec2(window_pos.x +(40*_nodeCanvas.GetCanvasScale()), window_pos.y+window_size.y-(36*_nodeCanvas.GetCanvasScale())),_nodeCanvas.GetCanvasScale()/this->scaleFactor);
 
             // draw player state
-            if(isPlaying){ // play
+            if(state.isPlaying){ // play
                 _nodeCanvas.getNodeDrawList()->AddTriangleFilled(ImVec2(window_pos.x+window_size.x-(50*_nodeCanvas.GetCanvasScale()),window_pos.y+window_size.y-(40*_nodeCanvas.GetCanvasScale())), ImVec2(window_pos.x+window_size.x-(50*_nodeCanvas.GetCanvasScale()), window_pos.y+window_size.y-(20*_nodeCanvas.GetCanvasScale())), ImVec2(window_pos.x+window_size.x-(30*_nodeCanvas.GetCanvasScale()), window_pos.y+window_size.y-(30*_nodeCanvas.GetCanvasScale())), IM_COL32(255, 255, 255, 120));
-            }else if(!isPlaying && playhead > cueIN){ // pause
+            }else if(!state.isPlaying && state.playhead > cueIN){ // pause
                 _nodeCanvas.getNodeDrawList()->AddRectFilled(ImVec2(window_pos.x+window_size.x-(50*_nodeCanvas.GetCanvasScale()),window_pos.y+window_size.y-(40*_nodeCanvas.GetCanvasScale())),ImVec2(window_pos.x+window_size.x-(42*_nodeCanvas.GetCanvasScale()),window_pos.y+window_size.y-(20*_nodeCanvas.GetCanvasScale())),IM_COL32(255, 255, 255, 120));
                 _nodeCanvas.getNodeDrawList()->AddRectFilled(ImVec2(window_pos.x+window_size.x-(38*_nodeCanvas.GetCanvasScale()),window_pos.y+window_size.y-(40*_nodeCanvas.GetCanvasScale())),ImVec2(window_pos.x+window_size.x-(30*_nodeCanvas.GetCanvasScale()),window_pos.y+window_size.y-(20*_nodeCanvas.GetCanvasScale())),IM_COL32(255, 255, 255, 120));
-            }else if(!isPlaying && playhead == cueIN){ // stop
+            }else if(!state.isPlaying && state.playhead == cueIN){ // stop
                 _nodeCanvas.getNodeDrawList()->AddRectFilled(ImVec2(window_pos.x+window_size.x-(50*_nodeCanvas.GetCanvasScale()),window_pos.y+window_size.y-(40*_nodeCanvas.GetCanvasScale())),ImVec2(window_pos.x+window_size.x-(30*_nodeCanvas.GetCanvasScale()),window_pos.y+window_size.y-(20*_nodeCanvas.GetCanvasScale())),IM_COL32(255, 255, 255, 120));
             }
 
             // draw playhead
-            float phx = ofMap( playhead, 0, audiofile.length()*0.98f, 1, (this->width*0.98f*_nodeCanvas.GetCanvasScale())-(31*this->scaleFactor) );
+            float phx = ofMap( state.playhead, 0, audiofile->length()*0.98f, 1, (this->width*0.98f*_nodeCanvas.GetCanvasScale())-(31*this->scaleFactor) );
             _nodeCanvas.getNodeDrawList()->AddLine(ImVec2(ph_pos.x + phx, ph_pos.y),ImVec2(ph_pos.x + phx, window_size.y+ph_pos.y-(26*this->scaleFactor)),IM_COL32(255, 255, 255, 160), 2.0f);
 
             // draw cues IN OUT
-            float cinx = ofMap( cueIN, 0, audiofile.length()*0.98f, 1, (this->width*0.98f*_nodeCanvas.GetCanvasScale())-(31*this->scaleFactor) );
+            float cinx = ofMap( cueIN, 0, audiofile->length()*0.98f, 1, (this->width*0.98f*_nodeCanvas.GetCanvasScale())-(31*this->scaleFactor) );
             _nodeCanvas.getNodeDrawList()->AddLine(ImVec2(ph_pos.x + cinx, ph_pos.y),ImVec2(ph_pos.x + cinx, window_size.y+ph_pos.y-(26*this->scaleFactor)),IM_COL32(255, 0, 0, 160), 2.0f);
-            float coutx = ofMap( cueOUT, 0, audiofile.length()*0.98f, 1, (this->width*0.98f*_nodeCanvas.GetCanvasScale())-(31*this->scaleFactor) );
+            float coutx = ofMap( cueOUT, 0, audiofile->length()*0.98f, 1, (this->width*0.98f*_nodeCanvas.GetCanvasScale())-(31*this->scaleFactor) );
             _nodeCanvas.getNodeDrawList()->AddLine(ImVec2(ph_pos.x + coutx, ph_pos.y),ImVec2(ph_pos.x + coutx, window_size.y+ph_pos.y-(26*this->scaleFactor)),IM_COL32(255, 0, 0, 160), 2.0f);
 
         }else if(loadingFile){
             ImGui::Text("LOADING FILE...");
-        }else if(!isNewObject && !audiofile.loaded()){
+        }else if(!isNewObject && !audiofile->loaded()){
             ImGui::Text("FILE NOT FOUND!");
         }
 
@@ -358,7 +393,7 @@ void SoundfilePlayer::drawObjectNodeConfig(){
     }else{
         ImGui::Text("%s",tempFilename.getFileName().c_str());
         if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s",tempFilename.getAbsolutePath().c_str());
-        ImGuiEx::drawTimecode(ImGui::GetForegroundDrawList(),static_cast<int>(ceil(audiofile.length()/audiofile.samplerate())),"Duration: ");
+        ImGuiEx::drawTimecode(ImGui::GetForegroundDrawList(),static_cast<int>(ceil(audiofile->length()/audiofile->samplerate())),"Duration: ");
     }
     if(ImGui::Button(ICON_FA_FILE,ImVec2(224*scaleFactor,26*scaleFactor))){
         loadSoundfileFlag = true;
@@ -372,16 +407,11 @@ void SoundfilePlayer::drawObjectNodeConfig(){
     ImGui::PushStyleColor(ImGuiCol_ButtonHovered, VHS_BLUE_OVER);
     ImGui::PushStyleColor(ImGuiCol_ButtonActive, VHS_BLUE_OVER);
     if(ImGui::Button(ICON_FA_PLAY,ImVec2(69*scaleFactor,26*scaleFactor))){
-        isPlaying = true;
-        playhead = cueIN;
-        audioWasPlaying = true;
-        finishSemaphore = true;
+        sendCommand(Soundfile_Command_PlayCue);
     }
     ImGui::SameLine();
     if(ImGui::Button(ICON_FA_STOP,ImVec2(69*scaleFactor,26*scaleFactor))){
-        isPlaying = false;
-        playhead = cueIN;
-        audioWasPlaying = false;
+        sendCommand(Soundfile_Command_StopCue);
     }
     ImGui::PopStyleColor(3);
     ImGui::SameLine();
@@ -389,7 +419,7 @@ void SoundfilePlayer::drawObjectNodeConfig(){
     ImGui::PushStyleColor(ImGuiCol_ButtonHovered, VHS_YELLOW_OVER);
     ImGui::PushStyleColor(ImGuiCol_ButtonActive, VHS_YELLOW_OVER);
     if(ImGui::Button(ICON_FA_PAUSE,ImVec2(69*scaleFactor,26*scaleFactor))){
-        isPlaying = !isPlaying;
+        sendCommand(Soundfile_Command_TogglePause);
     }
     ImGui::PopStyleColor(3);
 
@@ -412,18 +442,12 @@ void SoundfilePlayer::drawObjectNodeConfig(){
     float tempcueIN = cueIN;
     if(ImGui::SliderFloat("CUE IN",&tempcueIN,0.0, cueOUT-2)){
         cueIN = static_cast<double>(tempcueIN);
-        if(playhead < cueIN){
-            playhead = cueIN;
-        }
         this->setCustomVar(static_cast<float>(cueIN),"CUE_IN");
     }
     ImGui::Spacing();
     float tempcueOUT = cueOUT;
-    if(ImGui::SliderFloat("CUE OUT",&tempcueOUT,cueIN+2, audiofile.length()-2)){
+    if(ImGui::SliderFloat("CUE OUT",&tempcueOUT,cueIN+2, audiofile->length()-2)){
         cueOUT = static_cast<double>(tempcueOUT);
-        if(playhead > cueOUT){
-            playhead = cueOUT;
-        }
         this->setCustomVar(static_cast<float>(cueOUT),"CUE_OUT");
     }
 
@@ -455,56 +479,125 @@ void SoundfilePlayer::removeObjectContent(bool removeFileFromData){
 void SoundfilePlayer::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    // trigger, this needs to run in audio thread
-    if(this->inletsConnected[6]){
-        if(ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[6]),0.0f,1.0f) == 1.0f && !isNextCycle){
-            isNextCycle = true;
-            playhead = cueIN;
+    // player settings from the main thread ( playhead kept inside the new cues )
+    if(paramsChannel.update()){
+        const SoundfilePlayerParams &params = paramsChannel.getReadBuffer();
+        bool cuesChanged = params.cueIN != audioParams.cueIN || params.cueOUT != audioParams.cueOUT;
+        audioParams = params;
+        if(audioParams.seek >= 0.0){
+            playhead = audioParams.seek;
+        }else if(cuesChanged){
+            playhead = std::max(audioParams.cueIN,std::min(playhead,audioParams.cueOUT));
+        }
+    }
+
+    // loaded file, swapped in by the main thread ( released there too )
+    ofxAudioFile *file = fileAsset.acquire();
+    if(file != playingFile){
+        playingFile = file;
+        playhead = audioParams.cueIN;
+    }
+    bool fileReady = file != nullptr && file->loaded();
+
+    // transport commands
+    ofxVPTimedEvent e;
+    while(commandEvents.popBefore(std::numeric_limits<uint64_t>::max(),e)){
+        int command = static_cast<int>(e.value);
+        if(command == Soundfile_Command_Play || command == Soundfile_Command_PlayCue){
             isPlaying = true;
+            playhead = command == Soundfile_Command_Play ? 0.0 : audioParams.cueIN;
+            audioWasPlaying = true;
             finishSemaphore = true;
-        }else if(playhead > 6000){
-            isNextCycle = false;
+        }else if(command == Soundfile_Command_Pause){
+            isPlaying = false;
+        }else if(command == Soundfile_Command_Unpause){
+            if(audioWasPlaying){
+                isPlaying = true;
+            }
+        }else if(command == Soundfile_Command_TogglePause){
+            isPlaying = !isPlaying;
+        }else if(command == Soundfile_Command_Stop || command == Soundfile_Command_StopCue){
+            isPlaying = false;
+            playhead = command == Soundfile_Command_Stop ? 0.0 : audioParams.cueIN;
+            audioWasPlaying = false;
         }
     }
 
-    if(isFileLoaded && audiofile.loaded() && isPlaying){
+    // trigger, restart playing at the exact sample of the bang
+    int triggerOffset = -1;
+    while(triggerEvents.popBefore(getAudioClock().getBlockStartNs(),e)){
+        triggerOffset = std::min(getAudioClock().getSampleOffset(e.timeNs),static_cast<int>(monoBuffer.getNumFrames())-1);
+    }
+    if(triggerOffset >= 0 && !fileReady){
+        playhead = audioParams.cueIN;
+        isPlaying = true;
+        finishSemaphore = true;
+    }
+
+    if(fileReady && (isPlaying || triggerOffset >= 0)){
         for(size_t i = 0; i < monoBuffer.getNumFrames(); i++) {
+            if(static_cast<int>(i) == triggerOffset){
+                playhead = audioParams.cueIN;
+                isPlaying = true;
+                finishSemaphore = true;
+            }
+
+            if(!isPlaying){
+                monoBuffer.getSample(i,0) = 0.0f;
+                continue;
+            }
+
             int n = static_cast<int>(floor(playhead));
 
-            if(static_cast<unsigned long long>(n) < cueOUT-1){
+            // the cues can still belong to the previous file for one block
+            if(static_cast<unsigned long long>(n) < audioParams.cueOUT-1 && static_cast<unsigned long long>(n+1) < file->length()){
                 float fract = static_cast<float>(playhead - n);
-                float isample = audiofile.sample(n, 0)*(1.0f-fract) + audiofile.sample(n+1, 0)*fract; // linear interpolation
-                monoBuffer.getSample(i,0) = isample * volume;
+                float isample = file->sample(n, 0)*(1.0f-fract) + file->sample(n+1, 0)*fract; // linear interpolation
+                monoBuffer.getSample(i,0) = isample * audioParams.volume;
 
-                playhead += (step*speed);
+                playhead += (audioParams.step*audioParams.speed);
 
             }else{
                 monoBuffer.getSample(i,0) = 0.0f;
 
                 if(finishSemaphore){
                     finishSemaphore = false;
-                    finishBang = true;
+                    finishCount++;
                 }
 
-                if(loop){
+                if(audioParams.loop){
                     // backword
-                    if(speed < 0.0){
-                        playhead = cueOUT;
-                    }else if(speed > 0.0){
-                        playhead = cueIN;
+                    if(audioParams.speed < 0.0){
+                        playhead = audioParams.cueOUT;
+                    }else if(audioParams.speed > 0.0){
+                        playhead = audioParams.cueIN;
                     }
                 }
             }
         }
         lastBuffer = monoBuffer;
     }else{
-        lastBuffer = monoBuffer * 0.0f;
+        lastBuffer.set(0.0f);
     }
 
     fileOUT.copyInput(lastBuffer.getBuffer().data(),lastBuffer.getNumFrames());
     *ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0]) = lastBuffer;
-    *ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1]) = scope.getBuffer();
 
+    // playing state to the main thread
+    SoundfilePlayerState &state = stateChannel.getWriteBuffer();
+    state.playhead      = playhead;
+    state.isPlaying     = isPlaying;
+    state.finishCount   = finishCount;
+    if(state.scope.size() == scope.getBuffer().size()){
+        std::copy(scope.getBuffer().begin(),scope.getBuffer().end(),state.scope.begin());
+    }
+    stateChannel.publish();
+
+}
+
+//--------------------------------------------------------------
+void SoundfilePlayer::audioSilenceObject(ofSoundBuffer &silenceBuffer){
+    fileOUT.copyInput(silenceBuffer.getBuffer().data(),silenceBuffer.getNumFrames());
 }
 
 //--------------------------------------------------------------
@@ -534,6 +627,17 @@ void SoundfilePlayer::loadSettings(){
 
     ofSoundBuffer tmpBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
     monoBuffer = tmpBuffer;
+    lastBuffer = tmpBuffer;
+
+    SoundfilePlayerState state = { 0.0, false, 0, vector<float>(bufferSize,0.0f) };
+    stateChannel.reset(state);
+}
+
+//--------------------------------------------------------------
+void SoundfilePlayer::sendCommand(Soundfile_Command command){
+    if(!commandEvents.push(getControlClock().now(),static_cast<float>(command))){
+        ofLog(OF_LOG_WARNING,"soundfile player: command queue full, command dropped");
+    }
 }
 
 //--------------------------------------------------------------
@@ -547,24 +651,22 @@ void SoundfilePlayer::loadAudioFile(string audiofilepath){
 
     loadingFile = true;
 
-    audiofile.free();
-    audiofile.load(filepath);
-    playhead = std::numeric_limits<int>::max();
-    step = audiofile.samplerate() / sampleRate;
+    // decode into a new file, the audio thread keeps playing the previous one until the swap
+    shared_ptr<ofxAudioFile> newFile = make_shared<ofxAudioFile>();
+    newFile->load(filepath);
+    step = newFile->samplerate() / sampleRate;
 
     plot_data = new float[bufferSize];
     for( int x=0; x<bufferSize; ++x){
-        int n = ofMap( x, 0, bufferSize, 0, audiofile.length(), true );
-        plot_data[x] = hardClip(audiofile.sample( n, 0 ));
+        int n = ofMap( x, 0, bufferSize, 0, newFile->length(), true );
+        plot_data[x] = hardClip(newFile->sample( n, 0 ));
     }
 
-    ofSoundBuffer tmpBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
-    monoBuffer.clear();
-    monoBuffer = tmpBuffer;
-
     cueIN = 0.0;
-    cueOUT = audiofile.length()-2;
-    playhead = cueIN;
+    cueOUT = newFile->length()-2;
+
+    audiofile = newFile;
+    fileAsset.publish(audiofile);
 
     this->saveConfig(false);
 
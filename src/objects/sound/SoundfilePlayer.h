@@ -35,10 +35,31 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPAudioAsset.h"
+#include "ofxVPTripleBuffer.h"
 
 #include "ImGuiFileBrowser.h"
 #include "IconsFontAwesome5.h"
 
+enum Soundfile_Command { Soundfile_Command_Play, Soundfile_Command_PlayCue, Soundfile_Command_Pause, Soundfile_Command_Unpause, Soundfile_Command_TogglePause, Soundfile_Command_Stop, Soundfile_Command_StopCue, Soundfile_Command_COUNT };
+
+struct SoundfilePlayerParams{
+    float           volume;
+    float           speed;
+    bool            loop;
+    double          cueIN;
+    double          cueOUT;
+    double          step;
+    double          seek;       // playhead inlet ( -1 if not connected )
+};
+
+struct SoundfilePlayerState{
+    double          playhead;
+    bool            isPlaying;
+    uint64_t        finishCount;
+    vector<float>   scope;
+};
+
 class SoundfilePlayer : public PatchObject {
 
 public:
@@ -58,10 +79,12 @@ public:
     void            removeObjectContent(bool removeFileFromData=false) override;
 
     void            audioOutObject(ofSoundBuffer &outputBuffer) override;
+    void            audioSilenceObject(ofSoundBuffer &silenceBuffer) override;
 
 
     void            loadSettings();
     void            loadAudioFile(string audiofilepath);
+    void            sendCommand(Soundfile_Command command);
 
 
     ofSoundBuffer       lastBuffer;
@@ -73,26 +96,37 @@ public:
     bool                isNewObject;
     bool                isFileLoaded;
     bool                loadingFile;
-    bool                isPlaying;
-    bool                audioWasPlaying;
     string              lastMessage;
 
-    ofxAudioFile        audiofile;
+    shared_ptr<ofxAudioFile>        audiofile;      // main thread view of the loaded file
+    ofxVPAudioAsset<ofxAudioFile>   fileAsset;      // loaded file, handed over to the audio thread
     pdsp::ExternalInput fileOUT;
     pdsp::Scope         scope;
     float               *plot_data;
-    double              playhead;
     double              cueIN;
     double              cueOUT;
     double              step;
     double              sampleRate;
     int                 bufferSize;
 
-    bool                isNextCycle;
+    ofxVPEventQueue<>   triggerEvents;
+    ofxVPEventQueue<>   commandEvents;              // transport commands ( Soundfile_Command )
+
+    ofxVPTripleBuffer<SoundfilePlayerParams>    paramsChannel;  // control -> audio
+    ofxVPTripleBuffer<SoundfilePlayerState>     stateChannel;   // audio -> control
+    uint64_t            lastFinishCount;
+
+    // audio thread
+    SoundfilePlayerParams   audioParams;
+    ofxAudioFile        *playingFile;
+    double              playhead;
+    bool                isPlaying;
+    bool                audioWasPlaying;
+    bool                finishSemaphore;
+    uint64_t            finishCount;
 
     size_t              startTime;
     bool                loading;
-    bool                finishSemaphore;
     bool                finishBang;
 
 
@@ -56,6 +56,7 @@ SummingMixer::SummingMixer() : PatchObject("summing mixer"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     needReset       = false;
     loaded          = false;
@@ -257,6 +258,9 @@ void SummingMixer::initInlets(){
 //--------------------------------------------------------------
 void SummingMixer::resetInletsSettings(){
 
+    // inlets and pdsp rewiring, structural change ( audio thread plays silence meanwhile )
+    std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
+
     mix.disconnectIn();
 
     for(int i=0;i<signalInlets;i++){
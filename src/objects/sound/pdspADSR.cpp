@@ -65,9 +65,12 @@ pdspADSR::pdspADSR() : PatchObject("ADSR envelope"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     loaded                  = false;
 
+    gateValue               = 0.0f;
+
     attackDuration          = 0.0f;
     decayDuration           = 50.0f;
     sustainLevel            = 0.5f;
@@ -76,6 +79,9 @@ pdspADSR::pdspADSR() : PatchObject("ADSR envelope"){
     attackHardness          = 0.0f;
     releaseHardness         = 1.0f;
 
+    pdspADSRParams params = { attackDuration, decayDuration, sustainLevel, releaseDuration, attackHardness, releaseHardness };
+    paramsChannel.reset(params);
+
 
 }
 
@@ -124,6 +130,22 @@ void pdspADSR::setupAudioOutObjectContent(pdsp::Engine &engine){
 void pdspADSR::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
 
+    // bangs --> trigger envelope ( every bang of the frame, applied at its exact sample in the audio thread )
+    const ofxVPEventList<> &bangs = this->getInletEvents(1);
+    for(size_t i=0;i<bangs.size();i++){
+        float gate = bangs[i].value == 1.0f ? 1.0f : 0.0f;
+        if(gate > 0.0f){
+            gate_ctrl.trigger(bangs[i].timeNs,gate);
+        }else if(gateValue > 0.0f){
+            gate_ctrl.off(bangs[i].timeNs);
+        }
+        gateValue = gate;
+    }
+    if(!this->inletsConnected[1] && gateValue > 0.0f){
+        gateValue = 0.0f;
+        gate_ctrl.off(getControlClock().now());
+    }
+
     // A
     if(this->inletsConnected[2]){
         attackDuration = ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[2]),0.0f,std::numeric_limits<float>::max());
@@ -157,6 +179,19 @@ void pdspADSR::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObject
         attackHardness = this->getCustomVar("ATTACK_CURVE");
         releaseHardness = this->getCustomVar("RELEASE_CURVE");
     }
+
+    // send the envelope shape to the audio thread
+    pdspADSRParams &params = paramsChannel.getWriteBuffer();
+    params.attack           = attackDuration;
+    params.decay            = decayDuration;
+    params.sustain          = sustainLevel;
+    params.release          = releaseDuration;
+    params.attackHardness   = attackHardness;
+    params.releaseHardness  = releaseHardness;
+    paramsChannel.publish();
+
+    // output envelope func ( pdsp meter, readable from any thread )
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = env.meter_output();
 }
 
 //--------------------------------------------------------------
@@ -255,24 +290,14 @@ void pdspADSR::loadAudioSettings(){
 void pdspADSR::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    env.set(attackDuration,decayDuration,sustainLevel,releaseDuration);
-    env.setAttackCurve(attackHardness);
-    env.setReleaseCurve(releaseHardness);
-
-    // bang --> trigger envelope
-    if(this->inletsConnected[1]){
-        if(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1]) == 1.0f){
-            gate_ctrl.trigger(ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1]),0.0f,1.0f));
-        }else{
-            gate_ctrl.off();
-        }
-    }else{
-        gate_ctrl.off();
+    // get the latest envelope shape from the main thread
+    if(paramsChannel.update()){
+        const pdspADSRParams &params = paramsChannel.getReadBuffer();
+        env.set(params.attack,params.decay,params.sustain,params.release);
+        env.setAttackCurve(params.attackHardness);
+        env.setReleaseCurve(params.releaseHardness);
     }
 
-    // output envelope func
-    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = env.meter_output();
-
     // SIGNAL BUFFER
     ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
 }
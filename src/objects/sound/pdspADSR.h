@@ -35,10 +35,20 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPTripleBuffer.h"
 
 #include "imgui_controls.h"
 #include "imgui-knobs.h"
 
+struct pdspADSRParams{
+    float   attack;
+    float   decay;
+    float   sustain;
+    float   release;
+    float   attackHardness;
+    float   releaseHardness;
+};
+
 class pdspADSR : public PatchObject{
 
 public:
@@ -64,7 +74,8 @@ public:
     pdsp::ADSR              env;
     pdsp::Amp               amp;
     pdsp::Scope             scope;
-    pdsp::TriggerControl    gate_ctrl;
+    ofxVPTriggerControl     gate_ctrl;
+    float                   gateValue;
 
     float                   attackDuration;
     float                   decayDuration;
@@ -74,6 +85,8 @@ public:
     float                   attackHardness;
     float                   releaseHardness;
 
+    ofxVPTripleBuffer<pdspADSRParams>   paramsChannel;  // control -> audio, envelope shape
+
     int                     bufferSize;
     int                     sampleRate;
 
@@ -63,6 +63,9 @@ pdspAHR::pdspAHR() : PatchObject("AHR envelope"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
+
+    gateValue               = 0.0f;
 
     loaded                  = false;
 
@@ -73,6 +76,9 @@ pdspAHR::pdspAHR() : PatchObject("AHR envelope"){
     attackHardness          = 0.0f;
     releaseHardness         = 1.0f;
 
+    pdspAHRParams params = { attackDuration, holdDuration, releaseDuration, attackHardness, releaseHardness };
+    paramsChannel.reset(params);
+
 }
 
 //--------------------------------------------------------------
@@ -145,6 +151,34 @@ void pdspAHR::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects
         attackHardness = this->getCustomVar("ATTACK_CURVE");
         releaseHardness = this->getCustomVar("RELEASE_CURVE");
     }
+
+    // bangs --> trigger envelope ( every bang of the frame, applied at its exact sample in the audio thread )
+    const ofxVPEventList<> &bangs = this->getInletEvents(1);
+    for(size_t i=0;i<bangs.size();i++){
+        float gate = ofClamp(bangs[i].value,0.0f,1.0f);
+        if(gate > 0.0f){
+            gate_ctrl.trigger(bangs[i].timeNs,gate);
+        }else if(gateValue > 0.0f){
+            gate_ctrl.off(bangs[i].timeNs);
+        }
+        gateValue = gate;
+    }
+    if(!this->inletsConnected[1] && gateValue > 0.0f){
+        gateValue = 0.0f;
+        gate_ctrl.off(getControlClock().now());
+    }
+
+    // send the envelope shape to the audio thread
+    pdspAHRParams &params = paramsChannel.getWriteBuffer();
+    params.attack           = attackDuration;
+    params.hold             = holdDuration;
+    params.release          = releaseDuration;
+    params.attackHardness   = attackHardness;
+    params.releaseHardness  = releaseHardness;
+    paramsChannel.publish();
+
+    // output envelope func ( pdsp meter, readable from any thread )
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = env.meter_output();
 }
 
 //--------------------------------------------------------------
@@ -239,20 +273,14 @@ void pdspAHR::loadAudioSettings(){
 void pdspAHR::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    env.set(attackDuration,holdDuration,releaseDuration);
-    env.setAttackCurve(attackHardness);
-    env.setReleaseCurve(releaseHardness);
-
-    // bang --> trigger envelope
-    if(this->inletsConnected[1]){
-        gate_ctrl.trigger(ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1]),0.0f,1.0f));
-    }else{
-        gate_ctrl.off();
+    // get the latest envelope shape from the main thread
+    if(paramsChannel.update()){
+        const pdspAHRParams &params = paramsChannel.getReadBuffer();
+        env.set(params.attack,params.hold,params.release);
+        env.setAttackCurve(params.attackHardness);
+        env.setReleaseCurve(params.releaseHardness);
     }
 
-    // output envelope func
-    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = env.meter_output();
-
     // SIGNAL BUFFER
     ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
 }
@@ -35,10 +35,19 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPTripleBuffer.h"
 
 #include "imgui_controls.h"
 #include "imgui-knobs.h"
 
+struct pdspAHRParams{
+    float   attack;
+    float   hold;
+    float   release;
+    float   attackHardness;
+    float   releaseHardness;
+};
+
 class pdspAHR : public PatchObject{
 
 public:
@@ -66,7 +75,8 @@ public:
     pdsp::AHR               env;
     pdsp::Amp               amp;
     pdsp::Scope             scope;
-    pdsp::TriggerControl    gate_ctrl;
+    ofxVPTriggerControl     gate_ctrl;
+    float                   gateValue;
 
     float                   attackDuration;
     float                   holdDuration;
@@ -75,6 +85,8 @@ public:
     float                   attackHardness;
     float                   releaseHardness;
 
+    ofxVPTripleBuffer<pdspAHRParams>    paramsChannel;  // control -> audio, envelope shape
+
     int                     bufferSize;
     int                     sampleRate;
 
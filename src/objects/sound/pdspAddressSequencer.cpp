@@ -56,6 +56,7 @@ pdspAddressSequencer::pdspAddressSequencer() : PatchObject("address sequencer"){
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     loaded                  = false;
 
@@ -68,6 +69,9 @@ pdspAddressSequencer::pdspAddressSequencer() : PatchObject("address sequencer"){
 
     rev                     = false;
 
+    clockMultiplier         = scaleMultiplier;
+    clockReverse            = rev;
+
     this->width  *= 3.5f;
     this->height *= 1.62f;
 
@@ -127,8 +131,8 @@ void pdspAddressSequencer::setupAudioOutObjectContent(pdsp::Engine &engine){
     //
     seq.code = [&]() noexcept {
         // actual sequencer step
-        if(rev){
-            if(seq.frame()%static_cast<int>(floor(6.0f/scaleMultiplier))==0){
+        if(clockReverse.load()){
+            if(seq.frame()%static_cast<int>(floor(6.0f/clockMultiplier.load()))==0){
                 if(meter_step > 0){
                     meter_step--;
                 }else{
@@ -137,7 +141,7 @@ void pdspAddressSequencer::setupAudioOutObjectContent(pdsp::Engine &engine){
             }
             //meter_step = 7 - (seq.frame()%actualSteps.load());
         }else{
-            if(seq.frame()%static_cast<int>(floor(6.0f/scaleMultiplier))==0){
+            if(seq.frame()%static_cast<int>(floor(6.0f/clockMultiplier.load()))==0){
                 if(meter_step < actualSteps.load()-1){
                     meter_step++;
                 }else{
@@ -146,10 +150,6 @@ void pdspAddressSequencer::setupAudioOutObjectContent(pdsp::Engine &engine){
             }
             //meter_step = static_cast<int>(floor(seq.frame()*scaleMultiplier))%actualSteps.load();
         }
-
-        // SEQ address values
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = seqSteps[meter_step];      // value
-
     };
 
 }
@@ -214,6 +214,22 @@ void pdspAddressSequencer::updateObjectContent(map<int,shared_ptr<PatchObject>>
             seqSteps[i] = this->getCustomVar("S_"+ofToString(i+1));
         }
     }
+
+    // S
+    if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
+        for(size_t i=0;i<8;i++){
+            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->size()){
+                seqSteps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->at(i);
+            }
+        }
+    }
+
+    // sequencer clock settings to the audio thread
+    clockMultiplier = scaleMultiplier;
+    clockReverse    = rev;
+
+    // SEQ address values ( the audio thread only moves the step )
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[0]) = seqSteps[meter_step.load()];      // value
 }
 
 //--------------------------------------------------------------
@@ -355,22 +371,6 @@ void pdspAddressSequencer::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
 }
 
-//--------------------------------------------------------------
-void pdspAddressSequencer::audioOutObject(ofSoundBuffer &outputBuffer){
-    unusedArgs(outputBuffer);
-
-    // S
-    if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
-        for(size_t i=0;i<8;i++){
-            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->size()){
-                seqSteps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->at(i);
-            }
-        }
-    }
-
-    
-}
-
 OBJECT_REGISTER( pdspAddressSequencer, "address sequencer", OFXVP_OBJECT_CAT_SOUND)
 
 #endif
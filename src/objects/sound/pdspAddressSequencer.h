@@ -59,11 +59,11 @@ public:
 
     void            removeObjectContent(bool removeFileFromData=false) override;
 
-    void            audioOutObject(ofSoundBuffer &outputBuffer) override;
-
     pdsp::Function                  seq;
     std::atomic<int>                actualSteps;
     std::atomic<int>                meter_step;
+    std::atomic<float>              clockMultiplier;    // scaleMultiplier, read by the audio thread
+    std::atomic<bool>               clockReverse;       // rev, read by the audio thread
 
 
     vector<string>          scaleModesString;
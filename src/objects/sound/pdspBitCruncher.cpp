@@ -51,6 +51,7 @@ pdspBitCruncher::pdspBitCruncher() : PatchObject("bit cruncher"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     bits                    = 4.0f;
 
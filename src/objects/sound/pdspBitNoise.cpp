@@ -55,6 +55,7 @@ pdspBitNoise::pdspBitNoise() : PatchObject("bit noise"){
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     pitch                   = -100.0f;
     decimation              = 151.0f;
@@ -115,6 +116,11 @@ void pdspBitNoise::setupAudioOutObjectContent(pdsp::Engine &engine){
 //--------------------------------------------------------------
 void pdspBitNoise::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
 
+    // latest signal buffer data from the audio thread
+    if(scopeChannel.update()){
+        *ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[2]) = scopeChannel.getReadBuffer();
+    }
+
     if(this->inletsConnected[0]){
         pitch = ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]),-100,150);
         pitch_ctrl.set(pitch);
@@ -221,6 +227,7 @@ void pdspBitNoise::loadAudioSettings(){
             for(int i=0;i<bufferSize;i++){
                 ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[2])->push_back(0.0f);
             }
+            scopeChannel.reset(vector<float>(bufferSize,0.0f));
 
             XML.popTag();
         }
@@ -229,11 +236,13 @@ void pdspBitNoise::loadAudioSettings(){
 
 //--------------------------------------------------------------
 void pdspBitNoise::audioOutObject(ofSoundBuffer &outputBuffer){
-    for(size_t i = 0; i < scopeL.getBuffer().size(); i++) {
-        float sample = (scopeL.getBuffer().at(i) + scopeR.getBuffer().at(i))/2;
-
-        // SIGNAL BUFFER DATA
-        ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[2])->at(i) = sample;
+    // SIGNAL BUFFER DATA, to the main thread ( data outlet )
+    vector<float> &scopeData = scopeChannel.getWriteBuffer();
+    if(scopeData.size() == scopeL.getBuffer().size()){
+        for(size_t i = 0; i < scopeL.getBuffer().size(); i++) {
+            scopeData[i] = (scopeL.getBuffer().at(i) + scopeR.getBuffer().at(i))/2;
+        }
+        scopeChannel.publish();
     }
     // SIGNAL BUFFER
     ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->copyFrom(scopeL.getBuffer().data(), bufferSize, 1, sampleRate);
@@ -35,6 +35,7 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPTripleBuffer.h"
 
 #include "imgui-knobs.h"
 
@@ -74,6 +75,7 @@ public:
     float                   bits;
 
     int                     bufferSize;
+    ofxVPTripleBuffer<vector<float>> scopeChannel;   // audio -> control, signal buffer data
     int                     sampleRate;
 
     bool                    loaded;
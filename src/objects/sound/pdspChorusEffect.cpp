@@ -56,6 +56,7 @@ pdspChorusEffect::pdspChorusEffect() : PatchObject("dimension chorus"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     speed                   = 0.25f;
     depth                   = 10.0f;
@@ -56,6 +56,7 @@ pdspCombFilter::pdspCombFilter() : PatchObject("comb filter"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     pitch                   = 12.0f;
     damping                 = 0.0f;
@@ -60,6 +60,7 @@ pdspCompressor::pdspCompressor() : PatchObject("compressor"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     loaded                  = false;
 
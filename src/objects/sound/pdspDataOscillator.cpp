@@ -52,6 +52,7 @@ pdspDataOscillator::pdspDataOscillator() : PatchObject("data oscillator"){
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     pitch                   = 72.0f;
 
@@ -104,6 +105,15 @@ void pdspDataOscillator::setupAudioOutObjectContent(pdsp::Engine &engine){
 void pdspDataOscillator::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
 
+    // latest signal buffer data from the audio thread
+    if(scopeChannel.update()){
+        const vector<float> &scopeData = scopeChannel.getReadBuffer();
+        for(size_t i=0;i<scopeData.size();i++){
+            plot_data[i] = hardClip(scopeData[i]);
+            ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1])->at(i) = scopeData[i];
+        }
+    }
+
     // PITCH
     if(this->inletsConnected[0]){
         pitch = ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]),0,127);
@@ -239,6 +249,7 @@ void pdspDataOscillator::loadAudioSettings(){
                 ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1])->push_back(0.0f);
                 plot_data[i] = 0.0f;
             }
+            scopeChannel.reset(vector<float>(bufferSize,0.0f));
 
             XML.popTag();
         }
@@ -249,12 +260,11 @@ void pdspDataOscillator::loadAudioSettings(){
 void pdspDataOscillator::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    for(size_t i = 0; i < scope.getBuffer().size(); i++) {
-        float sample = scope.getBuffer().at(i);
-        plot_data[i] = hardClip(sample);
-
-        // SIGNAL BUFFER DATA
-        ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1])->at(i) = sample;
+    // SIGNAL BUFFER DATA, to the main thread ( waveform and data outlet )
+    vector<float> &scopeData = scopeChannel.getWriteBuffer();
+    if(scopeData.size() == scope.getBuffer().size()){
+        std::copy(scope.getBuffer().begin(),scope.getBuffer().end(),scopeData.begin());
+        scopeChannel.publish();
     }
     // SIGNAL BUFFER
     ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
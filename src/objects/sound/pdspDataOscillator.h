@@ -35,6 +35,7 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPTripleBuffer.h"
 
 #include "imgui_controls.h"
 #include "imgui-knobs.h"
@@ -71,6 +72,7 @@ public:
 
     float                   *plot_data;
     int                     bufferSize;
+    ofxVPTripleBuffer<vector<float>> scopeChannel;   // audio -> control, signal buffer data
     int                     sampleRate;
 
     bool                    loaded;
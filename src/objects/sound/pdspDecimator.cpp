@@ -51,6 +51,7 @@ pdspDecimator::pdspDecimator() : PatchObject("decimator"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     freq                    = 800.0f;
 
@@ -58,6 +58,7 @@ pdspDelay::pdspDelay() : PatchObject("delay"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     time                    = 1000.0f;
     damping                 = 0.0f;
@@ -63,6 +63,7 @@ pdspDucker::pdspDucker() : PatchObject("sidechain compressor"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     loaded                  = false;
 
@@ -56,6 +56,7 @@ pdspHiCut::pdspHiCut() : PatchObject("low pass"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     freq                    = 19000.0f;
 
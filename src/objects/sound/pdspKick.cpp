@@ -60,9 +60,12 @@ pdspKick::pdspKick() : PatchObject("kick"){
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     loaded                  = false;
 
+    gateValue               = 0.0f;
+
     attackDuration          = 0.0f;
     decayDuration           = 240.0f;
     sustainLevel            = 0.0f;
@@ -73,6 +76,9 @@ pdspKick::pdspKick() : PatchObject("kick"){
     f_sustainLevel          = 0.0f;
     f_releaseDuration       = 0.0f;
 
+    pdspKickParams params = { { attackDuration, decayDuration, sustainLevel, releaseDuration }, { f_attackDuration, f_decayDuration, f_sustainLevel, f_releaseDuration } };
+    paramsChannel.reset(params);
+
     drivePower              = 4.57f;
 
     oscFreq                 = 44.0f;
@@ -175,8 +181,21 @@ void pdspKick::setupAudioOutObjectContent(pdsp::Engine &engine){
 void pdspKick::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
 
-    ampEnv.set(attackDuration,decayDuration,sustainLevel,releaseDuration);
-    modEnv.set(f_attackDuration,f_decayDuration,f_sustainLevel,f_releaseDuration);
+    // bangs --> trigger envelope ( every bang of the frame, applied at its exact sample in the audio thread )
+    const ofxVPEventList<> &bangs = this->getInletEvents(0);
+    for(size_t i=0;i<bangs.size();i++){
+        float gate = ofClamp(bangs[i].value,0.0f,1.0f);
+        if(gate > 0.0f){
+            gate_ctrl.trigger(bangs[i].timeNs,gate);
+        }else if(gateValue > 0.0f){
+            gate_ctrl.off(bangs[i].timeNs);
+        }
+        gateValue = gate;
+    }
+    if(!this->inletsConnected[0] && gateValue > 0.0f){
+        gateValue = 0.0f;
+        gate_ctrl.off(getControlClock().now());
+    }
 
     if(this->inletsConnected[1]){
         oscFreq = ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[1]),0.0f,100.0f);
@@ -212,6 +231,22 @@ void pdspKick::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObject
         compAttack  = this->getCustomVar("COMP_A");
         compRelease = this->getCustomVar("COMP_R");
     }
+
+    // send the envelopes shape to the audio thread
+    pdspKickParams &params = paramsChannel.getWriteBuffer();
+    params.ampEnv[0] = attackDuration;
+    params.ampEnv[1] = decayDuration;
+    params.ampEnv[2] = sustainLevel;
+    params.ampEnv[3] = releaseDuration;
+    params.modEnv[0] = f_attackDuration;
+    params.modEnv[1] = f_decayDuration;
+    params.modEnv[2] = f_sustainLevel;
+    params.modEnv[3] = f_releaseDuration;
+    paramsChannel.publish();
+
+    // output envelopes func ( pdsp meters, readable from any thread )
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = ampEnv.meter_output();
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[2]) = modEnv.meter_output();
 }
 
 //--------------------------------------------------------------
@@ -356,18 +391,13 @@ void pdspKick::loadAudioSettings(){
 void pdspKick::audioOutObject(ofSoundBuffer &outputBuffer){
     unusedArgs(outputBuffer);
 
-    // bang --> trigger envelope
-    if(this->inletsConnected[0]){
-        gate_ctrl.trigger(ofClamp(*ofxVP_CAST_PIN_PTR<float>(this->_inletParams[0]),0.0f,1.0f));
-    }else{
-        gate_ctrl.off();
+    // get the latest envelopes shape from the main thread
+    if(paramsChannel.update()){
+        const pdspKickParams &params = paramsChannel.getReadBuffer();
+        ampEnv.set(params.ampEnv[0],params.ampEnv[1],params.ampEnv[2],params.ampEnv[3]);
+        modEnv.set(params.modEnv[0],params.modEnv[1],params.modEnv[2],params.modEnv[3]);
     }
 
-    // output envelope func
-    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[1]) = ampEnv.meter_output();
-    // output freq. envelope func
-    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[2]) = modEnv.meter_output();
-
     // SIGNAL BUFFER
     ofxVP_CAST_PIN_PTR<ofSoundBuffer>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
 
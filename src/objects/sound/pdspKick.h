@@ -35,9 +35,15 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPTripleBuffer.h"
 
 #include "imgui-knobs.h"
 
+struct pdspKickParams{
+    float   ampEnv[4];      // attack, decay, sustain, release
+    float   modEnv[4];
+};
+
 class pdspKick : public PatchObject{
 
 public:
@@ -79,7 +85,8 @@ public:
     pdsp::ValueControl      comp_R_ctrl;
 
     pdsp::Scope             scope;
-    pdsp::TriggerControl    gate_ctrl;
+    ofxVPTriggerControl     gate_ctrl;
+    float                   gateValue;
 
     float                   attackDuration;
     float                   decayDuration;
@@ -91,6 +98,8 @@ public:
     float                   f_sustainLevel;
     float                   f_releaseDuration;
 
+    ofxVPTripleBuffer<pdspKickParams>   paramsChannel;  // control -> audio, envelopes shape
+
     float                   drivePower;
 
     float                   oscFreq;
@@ -57,6 +57,7 @@ pdspLFO::pdspLFO() : PatchObject("lfo"){
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     pitch                   = 0.5f;
     phase                   = 0.0f;
@@ -56,6 +56,7 @@ pdspLowCut::pdspLowCut() : PatchObject("high pass"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     freq                    = 20.0f;
 
@@ -50,6 +50,7 @@ pdspParametricEQ::pdspParametricEQ() : PatchObject("parametric EQ"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     float_l1freq    = 100.0f;
     float_l1Q       = 1.0f;
@@ -162,6 +163,20 @@ void pdspParametricEQ::setupAudioOutObjectContent(pdsp::Engine &engine){
 void pdspParametricEQ::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     unusedArgs(patchObjects);
 
+    // latest spectrum from the audio thread
+    if(spectrumChannel.update()){
+        *ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1]) = spectrumChannel.getReadBuffer();
+    }
+
+    // EQ curves
+    for(size_t i = 0; i < parametricFilter->size(); i++){
+        l1Filter->at(i) = lowShelfFn(i, float_l1gain/20.0f, (std::log(float_l1freq / 20.f) / std::log(1000.f))*this->width, float_l1Q);
+        m1Filter->at(i) = gaussianFn(i, float_m1gain/20.0f, (std::log(float_m1freq / 20.f) / std::log(1000.f))*this->width, float_m1Q);
+        m2Filter->at(i) = gaussianFn(i, float_m2gain/20.0f, (std::log(float_m2freq / 20.f) / std::log(1000.f))*this->width, float_m2Q);
+        h1Filter->at(i) = hiShelfFn(i, float_h1gain/20.0f, (std::log(float_h1freq / 20.f) / std::log(1000.f))*this->width, float_h1Q);
+        parametricFilter->at(i)	= (l1Filter->at(i)+m1Filter->at(i)+m2Filter->at(i)+h1Filter->at(i))/4.0f;
+    }
+
     if(!loaded){
         loaded = true;
 
@@ -367,6 +382,7 @@ void pdspParametricEQ::loadAudioSettings(){
 
             spectrum[i] = 0.0f;
         }
+        spectrumChannel.reset(vector<float>(fft->getBinSize(),0.0f));
     }
 }
 
@@ -387,17 +403,16 @@ void pdspParametricEQ::audioOutObject(ofSoundBuffer &outputBuffer){
     fft->setPolar(spectrum, fft->getPhase());
     fft->clampSignal();
 
-    // SPECTRUM
-    for(size_t i = 0; i < fft->getBinSize(); i++){
-        size_t pos = static_cast<int>(floor((std::log(i+20 / 20.f) / std::log(1024.f))*fft->getBinSize()));
-        if(pos < fft->getBinSize()){
-            ofxVP_CAST_PIN_PTR<vector<float>>(_outletParams[1])->at(pos) = spectrum[i];
+    // SPECTRUM, to the main thread
+    vector<float> &spectrumData = spectrumChannel.getWriteBuffer();
+    if(spectrumData.size() == fft->getBinSize()){
+        for(size_t i = 0; i < fft->getBinSize(); i++){
+            size_t pos = static_cast<int>(floor((std::log(i+20 / 20.f) / std::log(1024.f))*fft->getBinSize()));
+            if(pos < fft->getBinSize()){
+                spectrumData[pos] = spectrum[i];
+            }
         }
-        l1Filter->at(i) = lowShelfFn(i, float_l1gain/20.0f, (std::log(float_l1freq / 20.f) / std::log(1000.f))*this->width, float_l1Q);
-        m1Filter->at(i) = gaussianFn(i, float_m1gain/20.0f, (std::log(float_m1freq / 20.f) / std::log(1000.f))*this->width, float_m1Q);
-        m2Filter->at(i) = gaussianFn(i, float_m2gain/20.0f, (std::log(float_m2freq / 20.f) / std::log(1000.f))*this->width, float_m2Q);
-        h1Filter->at(i) = hiShelfFn(i, float_h1gain/20.0f, (std::log(float_h1freq / 20.f) / std::log(1000.f))*this->width, float_h1Q);
-        parametricFilter->at(i)	= (l1Filter->at(i)+m1Filter->at(i)+m2Filter->at(i)+h1Filter->at(i))/4.0f;
+        spectrumChannel.publish();
     }
 
 }
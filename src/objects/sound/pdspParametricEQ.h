@@ -35,6 +35,7 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "ofxVPTripleBuffer.h"
 
 #include "ofxFft.h"
 
@@ -67,6 +68,7 @@ public:
 
     ofxFft                  *fft;
     float                   *spectrum;
+    ofxVPTripleBuffer<vector<float>> spectrumChannel;    // audio -> control, spectrum data
 
     pdsp::Scope             scope;
 
@@ -56,6 +56,7 @@ pdspResonant2PoleFilter::pdspResonant2PoleFilter() : PatchObject("resonant filte
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     pitch                   = 12.0f;
     cutoff                  = 12.0f;
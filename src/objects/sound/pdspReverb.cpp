@@ -61,6 +61,7 @@ pdspReverb::pdspReverb() : PatchObject("reverb"){
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     time                    = 0.0f;
     density                 = 0.5f;
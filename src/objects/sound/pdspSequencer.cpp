@@ -120,6 +120,7 @@ pdspSequencer::pdspSequencer() : PatchObject("sequencer"){
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
+    isLockFreeAudioObject   = true;
 
     loaded                  = false;
 
@@ -203,29 +204,6 @@ void pdspSequencer::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
                 meter_step = 0;
             }
         }
-
-        // CTRLS
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[16]) = seqSteps[meter_step];      // S
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[17]) = ctrl1Steps[meter_step];    // A
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[18]) = ctrl2Steps[meter_step];    // B
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[19]) = ctrl3Steps[meter_step];    // C
-        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[20]) = ctrl4Steps[meter_step];    // D
-
-        // SEQ
-        if(seqSteps[meter_step]>0.0f){
-            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[meter_step - (static_cast<int>(floor(meter_step/16))*CHAPTER_STEPS)]) = 1.0f;
-        }else{
-            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[meter_step - (static_cast<int>(floor(meter_step/16))*CHAPTER_STEPS)]) = 0.0f;
-        }
-
-        for(int i=0;i<CHAPTER_STEPS;i++){
-            if(i == meter_step){
-                *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[i]) = seqSteps[meter_step];
-            }else{
-                *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[i]) = 0.0f;
-            }
-        }
-
     };
 
     for(size_t i=0;i<SEQUENCER_STEPS;i++){
@@ -289,6 +267,75 @@ void pdspSequencer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchO
             ctrl4Steps[i] = this->getCustomVar("D_"+ofToString(i+1));
         }
     }
+
+    // S
+    if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
+        for(size_t i=0;i<SEQUENCER_STEPS;i++){
+            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->size()){
+                seqSteps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->at(i);
+            }
+        }
+    }
+
+    // A
+    if(this->inletsConnected[1] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[1])->empty()){
+        for(size_t i=0;i<SEQUENCER_STEPS;i++){
+            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[1])->size()){
+                ctrl1Steps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[1])->at(i);
+            }
+        }
+    }
+
+    // B
+    if(this->inletsConnected[2] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[2])->empty()){
+        for(size_t i=0;i<SEQUENCER_STEPS;i++){
+            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[2])->size()){
+                ctrl2Steps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[2])->at(i);
+            }
+        }
+    }
+
+    // C
+    if(this->inletsConnected[3] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[3])->empty()){
+        for(size_t i=0;i<SEQUENCER_STEPS;i++){
+            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[3])->size()){
+                ctrl3Steps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[3])->at(i);
+            }
+        }
+    }
+
+    // D
+    if(this->inletsConnected[4] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[4])->empty()){
+        for(size_t i=0;i<SEQUENCER_STEPS;i++){
+            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[4])->size()){
+                ctrl4Steps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[4])->at(i);
+            }
+        }
+    }
+
+    // CTRLS ( the audio thread only moves the step )
+    int step = meter_step.load();
+
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[16]) = seqSteps[step];      // S
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[17]) = ctrl1Steps[step];    // A
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[18]) = ctrl2Steps[step];    // B
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[19]) = ctrl3Steps[step];    // C
+    *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[20]) = ctrl4Steps[step];    // D
+
+    // SEQ
+    if(seqSteps[step]>0.0f){
+        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[step - (static_cast<int>(floor(step/16))*CHAPTER_STEPS)]) = 1.0f;
+    }else{
+        *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[step - (static_cast<int>(floor(step/16))*CHAPTER_STEPS)]) = 0.0f;
+    }
+
+    for(int i=0;i<CHAPTER_STEPS;i++){
+        if(i == step){
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[i]) = seqSteps[step];
+        }else{
+            *ofxVP_CAST_PIN_PTR<float>(this->_outletParams[i]) = 0.0f;
+        }
+    }
 }
 
 //--------------------------------------------------------------
@@ -452,58 +499,6 @@ void pdspSequencer::removeObjectContent(bool removeFileFromData){
     unusedArgs(removeFileFromData);
 }
 
-//--------------------------------------------------------------
-void pdspSequencer::audioOutObject(ofSoundBuffer &outputBuffer){
-    unusedArgs(outputBuffer);
-
-    //seq.timing = actualSteps.load();
-
-    // S
-    if(this->inletsConnected[0] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->empty()){
-        for(size_t i=0;i<SEQUENCER_STEPS;i++){
-            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->size()){
-                seqSteps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[0])->at(i);
-            }
-        }
-    }
-
-    // A
-    if(this->inletsConnected[1] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[1])->empty()){
-        for(size_t i=0;i<SEQUENCER_STEPS;i++){
-            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[1])->size()){
-                ctrl1Steps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[1])->at(i);
-            }
-        }
-    }
-
-    // B
-    if(this->inletsConnected[2] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[2])->empty()){
-        for(size_t i=0;i<SEQUENCER_STEPS;i++){
-            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[2])->size()){
-                ctrl2Steps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[2])->at(i);
-            }
-        }
-    }
-
-    // C
-    if(this->inletsConnected[3] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[3])->empty()){
-        for(size_t i=0;i<SEQUENCER_STEPS;i++){
-            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[3])->size()){
-                ctrl3Steps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[3])->at(i);
-            }
-        }
-    }
-
-    // D
-    if(this->inletsConnected[4] && !ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[4])->empty()){
-        for(size_t i=0;i<SEQUENCER_STEPS;i++){
-            if(i < ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[4])->size()){
-                ctrl4Steps[i] = ofxVP_CAST_PIN_PTR<vector<float>>(this->_inletParams[4])->at(i);
-            }
-        }
-    }
-}
-
 OBJECT_REGISTER( pdspSequencer, "sequencer", OFXVP_OBJECT_CAT_SOUND)
 
 #endif
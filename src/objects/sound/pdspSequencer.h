@@ -62,8 +62,6 @@ public:
 
     void            removeObjectContent(bool removeFileFromData=false) override;
 
-    void            audioOutObject(ofSoundBuffer &outputBuffer) override;
-
     pdsp::Function                  seq;
     std::atomic<int>                actualSteps;
     std::atomic<int>                meter_step;
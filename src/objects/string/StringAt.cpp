@@ -53,6 +53,8 @@ StringAt::StringAt() : PatchObject("string at"){
     stringAt            = 0;
     loaded              = false;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -57,6 +57,8 @@ StringConcat::StringConcat() : PatchObject("string concat"){
     loaded          = false;
 
     this->setIsResizable(true);
+    this->setIsPureObj(true);
+    this->setIsThreadSafeObj(true);
 
     prevW                   = this->width;
     prevH                   = this->height;
@@ -89,13 +91,6 @@ void StringConcat::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
 //--------------------------------------------------------------
 void StringConcat::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
-    *ofxVP_CAST_PIN_PTR<string>(_outletParams[0]) = "";
-    for(int i=0;i<this->numInlets;i++){
-        if(this->inletsConnected[i]){
-            *ofxVP_CAST_PIN_PTR<string>(_outletParams[0]) += *ofxVP_CAST_PIN_PTR<string>(_inletParams[i]);
-        }
-    }
-
     if(needReset){
         needReset = false;
         resetInletsSettings();
@@ -109,6 +104,13 @@ void StringConcat::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchOb
         this->width             = prevW;
         this->height            = prevH;
     }
+
+    *ofxVP_CAST_PIN_PTR<string>(_outletParams[0]) = "";
+    for(int i=0;i<this->numInlets;i++){
+        if(this->inletsConnected[i]){
+            *ofxVP_CAST_PIN_PTR<string>(_outletParams[0]) += *ofxVP_CAST_PIN_PTR<string>(_inletParams[i]);
+        }
+    }
 }
 
 //--------------------------------------------------------------
@@ -55,6 +55,8 @@ StringExtract::StringExtract() : PatchObject("string extract"){
 
     loaded          = false;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -63,6 +63,8 @@ StringGate::StringGate() : PatchObject("string gate"){
     prevW                   = this->width;
     prevH                   = this->height;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -61,6 +61,8 @@ StringMultiplexer::StringMultiplexer() : PatchObject("string multiplexer"){
     prevW                   = this->width;
     prevH                   = this->height;
 
+    this->setIsThreadSafeObj(true);
+
 }
 
 //--------------------------------------------------------------
@@ -102,6 +102,15 @@
 #define	NOTES                           128
 #define MOSAIC_DEFAULT_BUFFER_SIZE      1024
 #define MEL_SCALE_CRITICAL_BANDS        24
+#define MFCC_COEFFICIENTS               13
+#define CHROMA_BANDS                    12
+#define SPECTRAL_FEATURES               5       // centroid, flatness, flux, rolloff, onset
+#define AUDIO_FEATURES_BUDGET_NS        50000   // spectral features + mfcc + chroma, per analysis frame
+#define AUDIO_EXTENDED_FEATURES         (SPECTRAL_FEATURES+MFCC_COEFFICIENTS+CHROMA_BANDS+1)    // + pitch confidence
+
+#define OFXVP_CONTROL_RATE              1000    // control clock ticks per second
+#define OFXVP_CONTROL_RATE_MIN          10
+#define OFXVP_CONTROL_RATE_MAX          10000
 
 #define OFXVP_OBJECT_CAT_AUDIOANALYSIS  "audio analysis"
 #define OFXVP_OBJECT_CAT_COMMUNICATIONS "communications"
@@ -33,6 +33,9 @@
 #include "ofxVisualProgramming.h"
 #include "imgui_internal.h"
 
+#include <future>
+#include <queue>
+
 #ifdef MOSAIC_ENABLE_PROFILING
 #include "Tracy.hpp"
 #endif
@@ -68,6 +71,7 @@ ofxVisualProgramming::ofxVisualProgramming(){
     bLoadingNewPatch        = false;
     bPopulatingObjectsMap   = false;
     clearingObjectsMap      = false;
+    executionPlanDirty      = true;
 
     livePatchingObiID       = -1;
 
@@ -89,6 +93,7 @@ ofxVisualProgramming::ofxVisualProgramming(){
 
     alphabet                = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXZY";
     newFileCounter          = 0;
+    patchLoadingProgress    = 0.0f;
 
     audioSampleRate         = 44100;
     audioGUISRIndex         = 0;
@@ -97,6 +102,7 @@ ofxVisualProgramming::ofxVisualProgramming(){
     audioGUIOUTIndex        = -1;
     audioGUIINChannels      = 0;
     audioGUIOUTChannels     = 0;
+    profilerScratch.assign(OFXVP_PROFILER_RING_SIZE,0);
     audioDevicesBS          = {"64","128","256","512","1024","2048"};
     audioGUIBSIndex         = 4;
     audioBufferSize         = ofToInt(audioDevicesBS[audioGUIBSIndex]);
@@ -105,6 +111,8 @@ ofxVisualProgramming::ofxVisualProgramming(){
     isInputDeviceAvailable  = false;
     isOutputDeviceAvailable = false;
     dspON                   = false;
+    lazyEvaluation          = false;
+    parallelUpdate          = false;
     audioINDev              = 0;
     audioOUTDev             = 0;
 
@@ -118,6 +126,13 @@ ofxVisualProgramming::ofxVisualProgramming(){
     isOverSubpatchNavigator = false;
 
     inited                  = false;
+    headless                = false;
+    offlineSampleRate       = 0;
+    offlineBufferSize       = 0;
+    offlineSamples          = 0;
+    offlineStartNs          = 0;
+    offlineAnchored         = false;
+    audioBlocksSkipped      = 0;
 
 }
 
@@ -157,6 +172,7 @@ void ofxVisualProgramming::setup(ofxImGui::Gui* _guiRef, string release){
     nodeCanvas.setRetina(isRetina,scaleFactor);
 
     profiler.setIsRetina(isRetina);
+    profiler.extraContent = [this](){ drawProfilerObjectsTimings(); };
 
     // create failsafe window for always maintaining reference to shared context
     setupFailsafeWindow();
@@ -201,6 +217,23 @@ void ofxVisualProgramming::setup(ofxImGui::Gui* _guiRef, string release){
 
 }
 
+//--------------------------------------------------------------
+void ofxVisualProgramming::setupHeadless(string release){
+
+    // no window, no GL, no ImGui and no audio devices: only the update/audio graph ( CI benchmarks, server side rendering )
+    headless = true;
+    ofxVPGui = nullptr;
+
+    // time based objects ticked from the fixed step time in update(), not from the wall clock ( deterministic renders )
+    getControlClock().setExternalTime(true);
+
+    // RESET TEMP FOLDER
+    resetTempFolder();
+
+    ofLog(OF_LOG_NOTICE,"ofxVisualProgramming %s running headless",release.c_str());
+
+}
+
 //--------------------------------------------------------------
 void ofxVisualProgramming::setupFailsafeWindow(){
     ofGLFWWindowSettings settings;
@@ -235,6 +268,11 @@ void ofxVisualProgramming::update(){
         inited = true;
     }
 
+    // headless: advance the control clock to the runner time ( fixed step with ofSetTimeModeFixedRate )
+    if(headless){
+        getControlClock().advanceExternalTime(ofGetElapsedTimeMicros()*1000ULL);
+    }
+
     // Clear map from deleted objects
     if(!bPopulatingObjectsMap){
         clearObjectsMap();
@@ -249,60 +287,49 @@ void ofxVisualProgramming::update(){
     // update patch objects
     if(!bLoadingNewPatch && !patchObjects.empty()){
 
-        std::lock_guard<std::mutex> lck(vp_mutex);
-
-        // left to right computing order
-        leftToRightIndexOrder.clear();
-        for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-            if(it->second != nullptr){
-                leftToRightIndexOrder.push_back(make_pair(static_cast<int>(floor(it->second->getPos().x)),it->second->getId()));
-            }
+        // wireless routing table ( rebuilt only when wireless names, types or objects change )
+        if(getWirelessBus().isDirty()){
+            getWirelessBus().rebuild(patchObjects);
+            executionPlanDirty = true;
         }
-        // sort the vector by it's pair first value (object X position)
-        sort(leftToRightIndexOrder.begin(),leftToRightIndexOrder.end());
-
-        ImGuiEx::ProfilerTask *pt = new ImGuiEx::ProfilerTask[leftToRightIndexOrder.size()];
 
-        for(unsigned int i=0;i<leftToRightIndexOrder.size();i++){
-            string tmpon = patchObjects[leftToRightIndexOrder[i].second]->getName()+ofToString(patchObjects[leftToRightIndexOrder[i].second]->getId())+"_update";
+        // topological computing order ( recompiled only when objects or links change )
+        if(executionPlanDirty){
+            compileExecutionPlan();
+        }
 
-            pt[i].color = profiler.cpuGraph.colors[static_cast<unsigned int>(i%16)];
-            pt[i].startTime = ofGetElapsedTimef();
-            pt[i].name = tmpon;
+        auto updatePlanObject = [this](size_t i){
+            uint64_t startNs = ofxVPTimingRing::now();
 
-            patchObjects[leftToRightIndexOrder[i].second]->update(patchObjects,*engine);
-            patchObjects[leftToRightIndexOrder[i].second]->updateWirelessLinks(patchObjects);
+            // audio objects update under the audio graph lock ( state read by the audio thread, file loading, pdsp ),
+            // except the lock-free ones, sharing their state with the audio thread through channels only
+            PatchObject *obj = executionPlan[i];
+            std::unique_lock<std::recursive_mutex> lck(getAudioGraphMutex(),std::defer_lock);
+            if((obj->getIsAudioINObject() || obj->getIsAudioOUTObject() || obj->getIsPDSPPatchableObject()) && !obj->getIsLockFreeAudioObject()){
+                lck.lock();
+            }
+            obj->update(patchObjects,*engine,lazyEvaluation);
+            obj->updateWirelessLinks(patchObjects);
+            if(lck.owns_lock()){
+                lck.unlock();
+            }
 
-            pt[i].endTime = ofGetElapsedTimef();
+            uint64_t endNs = ofxVPTimingRing::now();
+            executionPlan[i]->getTimings().sections[OFXVP_PROFILE_UPDATE].push(endNs-startNs);
+            updateProfilerTasks[i].startTime = startNs*1e-9;
+            updateProfilerTasks[i].endTime = endNs*1e-9;
+        };
 
-            // update scripts objects files map
-            std::ifstream testPath(patchObjects[leftToRightIndexOrder[i].second]->getFilepath());
-            if(testPath){ // file exists
-                ofFile tempsofp(patchObjects[leftToRightIndexOrder[i].second]->getFilepath());
-                string fileExt = ofToUpper(tempsofp.getExtension());
-                if(fileExt == "LUA" || fileExt == "SH"){
-                    map<string,string>::iterator sofpIT = scriptsObjectsFilesPaths.find(tempsofp.getFileName());
-                    if (sofpIT == scriptsObjectsFilesPaths.end()){
-                        // not found, insert it
-                        scriptsObjectsFilesPaths.insert( pair<string,string>(tempsofp.getFileName(),tempsofp.getAbsolutePath()) );
-                    }
-                }else if(fileExt == "FRAG"){
-                    map<string,string>::iterator sofpIT = scriptsObjectsFilesPaths.find(tempsofp.getFileName());
-                    if (sofpIT == scriptsObjectsFilesPaths.end()){
-                        // not found, insert FRAG
-                        scriptsObjectsFilesPaths.insert( pair<string,string>(tempsofp.getFileName(),tempsofp.getAbsolutePath()) );
-                        // insert VERT
-                        string fsName = tempsofp.getFileName();
-                        string vsName = tempsofp.getEnclosingDirectory()+tempsofp.getFileName().substr(0,fsName.find_last_of('.'))+".vert";
-                        ofFile newVertGLSLFile (vsName);
-                        scriptsObjectsFilesPaths.insert( pair<string,string>(newVertGLSLFile.getFileName(),newVertGLSLFile.getAbsolutePath()) );
-                    }
-                }
+        if(parallelUpdate){
+            // independent branches in parallel, thread safe objects on the workers, all the others on the main thread
+            getGraphScheduler().run(executionPlanSuccessors,executionPlanInDegree,executionPlanMainThread,updatePlanObject);
+        }else{
+            for(size_t i=0;i<executionPlan.size();i++){
+                updatePlanObject(i);
             }
-
         }
 
-        profiler.cpuGraph.LoadFrameData(pt,leftToRightIndexOrder.size());
+        profiler.cpuGraph.LoadFrameData(updateProfilerTasks.data(),updateProfilerTasks.size());
         isOverProfiler = profiler.isMouseOver;
 
         if(patchObjects[lastAddedObjectID] != nullptr){
@@ -337,6 +364,193 @@ void ofxVisualProgramming::updateSubpatchNavigation(){
     }
 }
 
+//--------------------------------------------------------------
+void ofxVisualProgramming::compileExecutionPlan(){
+
+    executionPlanDirty = false;
+    executionPlan.clear();
+
+    // collect nodes, left to right ordered ( used only to break ties between independent objects )
+    vector<pair<float,int>> nodes;
+    nodes.reserve(patchObjects.size());
+    for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
+        if(it->second != nullptr){
+            nodes.push_back(make_pair(it->second->getPos().x,it->first));
+        }
+    }
+    sort(nodes.begin(),nodes.end());
+
+    size_t numNodes = nodes.size();
+    map<int,size_t> nodeIndex;
+    for(size_t i=0;i<numNodes;i++){
+        nodeIndex[nodes[i].second] = i;
+    }
+
+    vector<vector<size_t>> successors(numNodes);
+    vector<int> inDegree(numNodes,0);
+
+    // wireless receivers, by wireless ID
+    map<string,vector<size_t>> wirelessReceivers;
+    for(size_t i=0;i<numNodes;i++){
+        PatchObject *obj = patchObjects[nodes[i].second].get();
+        for(int in=0;in<obj->getNumInlets();in++){
+            if(obj->getInletWirelessReceive(in)){
+                wirelessReceivers[obj->getInletID(in)].push_back(i);
+            }
+        }
+    }
+
+    // graph edges: patch links and wireless links
+    for(size_t i=0;i<numNodes;i++){
+        PatchObject *obj = patchObjects[nodes[i].second].get();
+        for(size_t l=0;l<obj->outPut.size();l++){
+            if(obj->outPut[l]->isDisabled) continue;
+            map<int,size_t>::iterator to = nodeIndex.find(obj->outPut[l]->toObjectID);
+            if(to != nodeIndex.end() && to->second != i){
+                successors[i].push_back(to->second);
+                inDegree[to->second]++;
+            }
+        }
+        for(int out=0;out<obj->getNumOutlets();out++){
+            if(!obj->getOutletWirelessSend(out)) continue;
+            map<string,vector<size_t>>::iterator wr = wirelessReceivers.find(obj->getOutletID(out));
+            if(wr != wirelessReceivers.end()){
+                for(size_t r=0;r<wr->second.size();r++){
+                    if(wr->second[r] != i){
+                        successors[i].push_back(wr->second[r]);
+                        inDegree[wr->second[r]]++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Kahn topological sort, always picking the leftmost ready object
+    std::priority_queue<size_t,vector<size_t>,std::greater<size_t>> ready;
+    for(size_t i=0;i<numNodes;i++){
+        if(inDegree[i] == 0){
+            ready.push(i);
+        }
+    }
+
+    vector<bool> scheduled(numNodes,false);
+    vector<size_t> planIndex(numNodes,0);
+    size_t nextPending = 0;
+    int feedbackLinks = 0;
+
+    executionPlan.reserve(numNodes);
+    while(executionPlan.size() < numNodes){
+        if(ready.empty()){
+            // cycle: schedule the leftmost pending object, the links coming into it
+            // from the rest of the cycle became feedback links ( one frame delay )
+            while(scheduled[nextPending]) nextPending++;
+            feedbackLinks += inDegree[nextPending];
+            inDegree[nextPending] = 0;
+            ready.push(nextPending);
+        }
+
+        size_t current = ready.top();
+        ready.pop();
+
+        scheduled[current] = true;
+        planIndex[current] = executionPlan.size();
+        executionPlan.push_back(patchObjects[nodes[current].second].get());
+
+        for(size_t s=0;s<successors[current].size();s++){
+            size_t next = successors[current][s];
+            if(!scheduled[next] && --inDegree[next] == 0){
+                ready.push(next);
+            }
+        }
+    }
+
+    // parallel update dependencies, by execution plan index ( feedback links excluded )
+    executionPlanSuccessors.assign(numNodes,vector<size_t>());
+    executionPlanInDegree.assign(numNodes,0);
+    executionPlanMainThread.assign(numNodes,true);
+    for(size_t i=0;i<numNodes;i++){
+        size_t from = planIndex[i];
+        for(size_t s=0;s<successors[i].size();s++){
+            size_t to = planIndex[successors[i][s]];
+            if(from < to){
+                executionPlanSuccessors[from].push_back(to);
+                executionPlanInDegree[to]++;
+            }
+        }
+        executionPlanMainThread[from] = !executionPlan[from]->getIsThreadSafeObject();
+    }
+
+    // audio execution plan: audio objects only, same topological order ( shared pointers, an object
+    // removed from the patch stays alive until the audio thread gets the next plan )
+    vector<shared_ptr<PatchObject>> &tempAudioPlan = audioExecutionPlan.getWriteBuffer();
+    tempAudioPlan.clear();
+    for(size_t i=0;i<executionPlan.size();i++){
+        if(executionPlan[i]->getIsAudioINObject() || executionPlan[i]->getIsAudioOUTObject()){
+            tempAudioPlan.push_back(patchObjects[executionPlan[i]->getId()]);
+        }
+    }
+    size_t audioObjects = tempAudioPlan.size();
+    audioExecutionPlan.publish();
+    // release the objects referenced by the recycled plan
+    audioExecutionPlan.getWriteBuffer().clear();
+
+    // profiler tasks, named once here ( per frame only the timings are written )
+    updateProfilerTasks.resize(executionPlan.size());
+    drawProfilerTasks.resize(executionPlan.size());
+    for(size_t i=0;i<executionPlan.size();i++){
+        string tmpon = executionPlan[i]->getName()+ofToString(executionPlan[i]->getId());
+        updateProfilerTasks[i].name = tmpon+"_update";
+        updateProfilerTasks[i].color = profiler.cpuGraph.colors[static_cast<unsigned int>(i%16)];
+        updateProfilerTasks[i].startTime = updateProfilerTasks[i].endTime = 0.0;
+        drawProfilerTasks[i].name = tmpon+"_draw";
+        drawProfilerTasks[i].color = profiler.gpuGraph.colors[static_cast<unsigned int>(i%16)];
+        drawProfilerTasks[i].startTime = drawProfilerTasks[i].endTime = 0.0;
+    }
+
+    ofLog(OF_LOG_VERBOSE,"Execution plan compiled: %i objects, %i audio objects, %i feedback links",static_cast<int>(executionPlan.size()),static_cast<int>(audioObjects),feedbackLinks);
+
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::invalidateExecutionPlan(int &id){
+    unusedArgs(id);
+    executionPlanDirty = true;
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::registerScriptObjectFile(int &id){
+
+    // called on object load and on script load/path change ( scripting objects path watchers ), never per frame
+    map<int,shared_ptr<PatchObject>>::iterator obj = patchObjects.find(id);
+    if(obj == patchObjects.end() || obj->second == nullptr) return;
+
+    // update scripts objects files map
+    std::ifstream testPath(obj->second->getFilepath());
+    if(testPath){ // file exists
+        ofFile tempsofp(obj->second->getFilepath());
+        string fileExt = ofToUpper(tempsofp.getExtension());
+        if(fileExt == "LUA" || fileExt == "SH"){
+            map<string,string>::iterator sofpIT = scriptsObjectsFilesPaths.find(tempsofp.getFileName());
+            if (sofpIT == scriptsObjectsFilesPaths.end()){
+                // not found, insert it
+                scriptsObjectsFilesPaths.insert( pair<string,string>(tempsofp.getFileName(),tempsofp.getAbsolutePath()) );
+            }
+        }else if(fileExt == "FRAG"){
+            map<string,string>::iterator sofpIT = scriptsObjectsFilesPaths.find(tempsofp.getFileName());
+            if (sofpIT == scriptsObjectsFilesPaths.end()){
+                // not found, insert FRAG
+                scriptsObjectsFilesPaths.insert( pair<string,string>(tempsofp.getFileName(),tempsofp.getAbsolutePath()) );
+                // insert VERT
+                string fsName = tempsofp.getFileName();
+                string vsName = tempsofp.getEnclosingDirectory()+tempsofp.getFileName().substr(0,fsName.find_last_of('.'))+".vert";
+                ofFile newVertGLSLFile (vsName);
+                scriptsObjectsFilesPaths.insert( pair<string,string>(newVertGLSLFile.getFileName(),newVertGLSLFile.getAbsolutePath()) );
+            }
+        }
+    }
+
+}
+
 //--------------------------------------------------------------
 void ofxVisualProgramming::draw(){
 
@@ -385,34 +599,37 @@ void ofxVisualProgramming::draw(){
 
     // Render objects.
     if(!bLoadingNewPatch && !patchObjects.empty()){
-        pt = new ImGuiEx::ProfilerTask[leftToRightIndexOrder.size()];
-        for(unsigned int i=0;i<leftToRightIndexOrder.size();i++){
-
-            if(patchObjects[leftToRightIndexOrder[i].second]->subpatchName == currentSubpatch){
+        if(executionPlanDirty){
+            compileExecutionPlan();
+        }
+        for(unsigned int i=0;i<executionPlan.size();i++){
 
-                string tmpon = patchObjects[leftToRightIndexOrder[i].second]->getName()+ofToString(patchObjects[leftToRightIndexOrder[i].second]->getId())+"_draw";
+            if(executionPlan[i]->subpatchName == currentSubpatch){
 
-                pt[i].color = profiler.gpuGraph.colors[static_cast<unsigned int>(i%16)];
-                pt[i].startTime = ofGetElapsedTimef();
-                pt[i].name = tmpon;
+                uint64_t startNs = ofxVPTimingRing::now();
 
                 // LivePatchingObject hack, should not be handled by mosaic.
-                if(patchObjects[leftToRightIndexOrder[i].second]->getName() == "live patching"){
-                    livePatchingObiID = patchObjects[leftToRightIndexOrder[i].second]->getId();
+                if(executionPlan[i]->getName() == "live patching"){
+                    livePatchingObiID = executionPlan[i]->getId();
                 }
 
                 // Draw
-                patchObjects[leftToRightIndexOrder[i].second]->draw(font);
+                executionPlan[i]->draw(font);
                 if(isCanvasVisible){
-                    patchObjects[leftToRightIndexOrder[i].second]->drawImGuiNode(nodeCanvas,patchObjects);
+                    executionPlan[i]->drawImGuiNode(nodeCanvas,patchObjects);
                 }
 
-                pt[i].endTime = ofGetElapsedTimef();
+                uint64_t endNs = ofxVPTimingRing::now();
+                executionPlan[i]->getTimings().sections[OFXVP_PROFILE_DRAW].push(endNs-startNs);
+                drawProfilerTasks[i].startTime = startNs*1e-9;
+                drawProfilerTasks[i].endTime = endNs*1e-9;
+            }else{
+                drawProfilerTasks[i].startTime = drawProfilerTasks[i].endTime = 0.0;
             }
 
         }
 
-        profiler.gpuGraph.LoadFrameData(pt,leftToRightIndexOrder.size());
+        profiler.gpuGraph.LoadFrameData(drawProfilerTasks.data(),drawProfilerTasks.size());
 
     }
 
@@ -660,6 +877,97 @@ void ofxVisualProgramming::drawSubpatchNavigation(){
     ImGui::End();
 }
 
+//--------------------------------------------------------------
+void ofxVisualProgramming::drawProfilerObjectsTimings(){
+
+    ImGui::Separator();
+    if(ImGui::Button("Export CSV")){
+        exportProfilerTimings(currentPatchFolderPath+"profiler_"+ofGetTimestampString("%y%m%d_%H%M%S")+".csv",false);
+    }
+    ImGui::SameLine();
+    if(ImGui::Button("Export JSON")){
+        exportProfilerTimings(currentPatchFolderPath+"profiler_"+ofGetTimestampString("%y%m%d_%H%M%S")+".json",true);
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("p95 / max in ms, last %d samples",OFXVP_PROFILER_RING_SIZE);
+
+    if(bLoadingNewPatch || executionPlan.empty()) return;
+
+    ImGui::BeginChild("objectsTimings", ImVec2(0,0));
+    ImGui::Columns(4);
+    ImGui::Text("object");
+    ImGui::NextColumn();
+    ImGui::Text("update");
+    ImGui::NextColumn();
+    ImGui::Text("draw");
+    ImGui::NextColumn();
+    ImGui::Text("audio");
+    ImGui::NextColumn();
+    ImGui::Separator();
+
+    for(size_t i=0;i<executionPlan.size();i++){
+        ImGui::Text("%s %d",executionPlan[i]->getName().c_str(),executionPlan[i]->getId());
+        ImGui::NextColumn();
+        for(int s=0;s<OFXVP_PROFILE_SECTIONS;s++){
+            ofxVPTimingStats stats = executionPlan[i]->getTimings().sections[s].getStats(profilerScratch.data());
+            if(stats.count > 0){
+                ImGui::Text("%.3f / %.3f",stats.p95*1e-6,stats.max*1e-6);
+            }else{
+                ImGui::TextDisabled("-");
+            }
+            ImGui::NextColumn();
+        }
+    }
+
+    ImGui::Columns(1);
+    ImGui::EndChild();
+
+}
+
+//--------------------------------------------------------------
+bool ofxVisualProgramming::exportProfilerTimings(string path, bool json){
+
+    static const char *sectionNames[OFXVP_PROFILE_SECTIONS] = {"update","draw","audio"};
+
+    ofstream file(path);
+    if(!file.is_open()){
+        ofLog(OF_LOG_ERROR,"Unable to export profiler timings to %s",path.c_str());
+        return false;
+    }
+
+    // timings in nanoseconds, over the last OFXVP_PROFILER_RING_SIZE samples of every object
+    if(json){
+        file << "{\"ring_size\":" << OFXVP_PROFILER_RING_SIZE << ",\"objects\":[";
+    }else{
+        file << "id,name,section,count,min_ns,mean_ns,p95_ns,max_ns\n";
+    }
+
+    for(size_t i=0;i<executionPlan.size();i++){
+        if(json){
+            file << (i > 0 ? "," : "") << "{\"id\":" << executionPlan[i]->getId() << ",\"name\":\"" << executionPlan[i]->getName() << "\"";
+        }
+        for(int s=0;s<OFXVP_PROFILE_SECTIONS;s++){
+            ofxVPTimingStats stats = executionPlan[i]->getTimings().sections[s].getStats(profilerScratch.data());
+            if(json){
+                file << ",\"" << sectionNames[s] << "\":{\"count\":" << stats.count << ",\"min\":" << stats.min << ",\"mean\":" << static_cast<uint64_t>(stats.mean) << ",\"p95\":" << stats.p95 << ",\"max\":" << stats.max << "}";
+            }else if(stats.count > 0){
+                file << executionPlan[i]->getId() << "," << executionPlan[i]->getName() << "," << sectionNames[s] << "," << stats.count << "," << stats.min << "," << static_cast<uint64_t>(stats.mean) << "," << stats.p95 << "," << stats.max << "\n";
+            }
+        }
+        if(json){
+            file << "}";
+        }
+    }
+
+    if(json){
+        file << "]}\n";
+    }
+
+    ofLog(OF_LOG_NOTICE,"Profiler timings exported to %s",path.c_str());
+
+    return true;
+}
+
 //--------------------------------------------------------------
 void ofxVisualProgramming::resetTempFolder(){
     ofDirectory dir;
@@ -729,6 +1037,10 @@ void ofxVisualProgramming::exit(){
         deactivateDSP();
     }
 
+    // write pending custom vars before closing
+    getPatchPersistence().stop();
+    getPatchPersistence().flush();
+
 #ifndef TARGET_WIN32
     cleanPatchDataFolder();
 
@@ -783,8 +1095,12 @@ void ofxVisualProgramming::keyPressed(ofKeyEventArgs &e){
     if(ImGui::IsAnyItemActive())
         return;
 
-    for(unsigned int i=0;i<leftToRightIndexOrder.size();i++){
-        patchObjects[leftToRightIndexOrder[i].second]->keyPressed(e,patchObjects);
+    if(executionPlanDirty){
+        compileExecutionPlan();
+    }
+
+    for(unsigned int i=0;i<executionPlan.size();i++){
+        executionPlan[i]->keyPressed(e,patchObjects);
     }
 }
 
@@ -794,32 +1110,55 @@ void ofxVisualProgramming::keyReleased(ofKeyEventArgs &e){
     if(ImGui::IsAnyItemActive())
         return;
 
-    for(unsigned int i=0;i<leftToRightIndexOrder.size();i++){
-        patchObjects[leftToRightIndexOrder[i].second]->keyReleased(e,patchObjects);
+    if(executionPlanDirty){
+        compileExecutionPlan();
+    }
+
+    for(unsigned int i=0;i<executionPlan.size();i++){
+        executionPlan[i]->keyReleased(e,patchObjects);
     }
 }
 
 //--------------------------------------------------------------
 void ofxVisualProgramming::audioProcess(float *input, int bufferSize, int nChannels){
 
+    // audio objects state, locked by the main thread only around audio objects updates, pdsp patching and teardown
+    // never waited on: while the main thread holds it the block is played as silence
+    std::unique_lock<std::recursive_mutex> lck(getAudioGraphMutex(),std::try_to_lock);
+
     if(bLoadingNewPatch) return;
     if(bLoadingNewObject) return;
 
+    if(!lck.owns_lock()){
+        if(audioSampleRate != 0 && dspON){
+            audioBlocksSkipped++;
+
+            vector<shared_ptr<PatchObject>> &audioPlan = audioExecutionPlan.getReadBuffer();
+            for(size_t i=0;i<audioPlan.size();i++){
+                audioPlan[i]->audioSilence(silenceBuffer);
+            }
+        }
+        return;
+    }
+
     if(audioSampleRate != 0 && dspON){
 
-        std::lock_guard<std::mutex> lck(vp_mutex);
+        // block time reference for the timestamped control events ( set by processOfflineAudio when headless )
+        if(!headless){
+            getAudioClock().beginBlock(bufferSize,audioSampleRate);
+        }
+
+        // get the latest audio plan
+        audioExecutionPlan.update();
+        vector<shared_ptr<PatchObject>> &audioPlan = audioExecutionPlan.getReadBuffer();
 
         if(audioGUIINChannels > 0){
             inputBuffer.copyFrom(input, bufferSize, nChannels, audioSampleRate);
 
             // compute audio input
             if(!inputBuffer.getBuffer().empty()){
-                for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-                    if(it->second != nullptr){
-                        if(!it->second->getWillErase()){
-                            it->second->audioIn(inputBuffer);
-                        }
-                    }
+                for(size_t i=0;i<audioPlan.size();i++){
+                    audioPlan[i]->audioIn(inputBuffer);
                 }
 
                 lastInputBuffer = inputBuffer;
@@ -827,13 +1166,9 @@ void ofxVisualProgramming::audioProcess(float *input, int bufferSize, int nChann
 
         }
         if(audioGUIOUTChannels > 0){
-            // compute audio output
-            for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-                if(it->second != nullptr){
-                    if(!it->second->getWillErase()){
-                        it->second->audioOut(emptyBuffer);
-                    }
-                }
+            // compute audio output, producers always before consumers ( no extra buffer latency per link )
+            for(size_t i=0;i<audioPlan.size();i++){
+                audioPlan[i]->audioOut(emptyBuffer);
             }
         }
 
@@ -887,6 +1222,8 @@ void ofxVisualProgramming::addObject(string name,ofVec2f pos,std::string fp){
     ofAddListener(tempObj->resetEvent ,this,&ofxVisualProgramming::resetObject);
     ofAddListener(tempObj->reconnectOutletsEvent ,this,&ofxVisualProgramming::reconnectObjectOutlets);
     ofAddListener(tempObj->duplicateEvent ,this,&ofxVisualProgramming::duplicateObject);
+    ofAddListener(tempObj->linksChangedEvent ,this,&ofxVisualProgramming::invalidateExecutionPlan);
+    ofAddListener(tempObj->filepathChangedEvent ,this,&ofxVisualProgramming::registerScriptObjectFile);
 
     actualObjectID++;
 
@@ -895,6 +1232,8 @@ void ofxVisualProgramming::addObject(string name,ofVec2f pos,std::string fp){
     if(saved){
         patchObjects[tempObj->getId()] = tempObj;
         lastAddedObjectID = tempObj->getId();
+        executionPlanDirty = true;
+        registerScriptObjectFile(lastAddedObjectID);
 
         // store in a map all the wireless links objects reference, for the subpatch navigation window
         if(name == "sender"){
@@ -938,6 +1277,11 @@ shared_ptr<PatchObject> ofxVisualProgramming::getLastAddedObject(){
 void ofxVisualProgramming::resetObject(int &id){
     if ((id != -1) && (patchObjects[id] != nullptr)){
 
+        patchObjects[id]->setNeedsUpdate(true);
+
+        getPatchPersistence().flush();
+        std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
         ofxXmlSettings XML;
 
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
@@ -955,6 +1299,7 @@ void ofxVisualProgramming::resetObject(int &id){
                                 tempBuffer.push_back(it->second->outPut[j]);
                                 if(it->second->outPut[j]->type == VP_LINK_AUDIO){
                                     // reconnect dsp link
+                                    std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
                                     patchObjects[it->first]->pdspOut[it->second->outPut[j]->fromOutletID] >> patchObjects[id]->pdspIn[it->second->outPut[j]->toInletID];
                                 }
                             }
@@ -965,6 +1310,7 @@ void ofxVisualProgramming::resetObject(int &id){
                     it->second->outPut = tempBuffer;
                 }
             }
+            executionPlanDirty = true;
 
             int totalObjects = XML.getNumTags("object");
 
@@ -999,11 +1345,7 @@ void ofxVisualProgramming::resetObject(int &id){
                 }
             }
 
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,currentPatchFile);
 
         }
     }
@@ -1021,11 +1363,13 @@ void ofxVisualProgramming::resetObject(int id){
                     }else{
                         it->second->outPut[j]->isDisabled = true;
                         patchObjects[it->second->outPut[j]->toObjectID]->inletsConnected[it->second->outPut[j]->toInletID] = false;
+                        patchObjects[it->second->outPut[j]->toObjectID]->setNeedsUpdate(true);
                     }
                 }
                 it->second->outPut = tempBuffer;
             }
         }
+        executionPlanDirty = true;
     }
 }
 
@@ -1059,10 +1403,7 @@ void ofxVisualProgramming::reconnectObjectOutlets(int &id){
 
                                             // fix loading patches with non-existent objects (older OFXVP versions)
                                             if(isObjectIDInPatchMap(toObjectID)){
-                                                if(connect(fromID,j,toObjectID,toInletID,linkType)){
-                                                    //ofLog(OF_LOG_NOTICE,"Connected object %s, outlet %i TO object %s, inlet %i",patchObjects[fromID]->getName().c_str(),z,patchObjects[toObjectID]->getName().c_str(),toInletID);
-                                                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                                                }
+                                                connect(fromID,j,toObjectID,toInletID,linkType);
                                             }
 
                                             XML.popTag();
@@ -1101,6 +1442,7 @@ void ofxVisualProgramming::clearObjectsMap(){
             if(!clearingObjectsMap){
                 for(int p=0;p<static_cast<int>(patchObjects.at(eraseIndexes.at(x))->outPut.size());p++){
                     patchObjects[patchObjects.at(eraseIndexes.at(x))->outPut.at(p)->toObjectID]->inletsConnected.at(patchObjects.at(eraseIndexes.at(x))->outPut.at(p)->toInletID) = false;
+                    patchObjects[patchObjects.at(eraseIndexes.at(x))->outPut.at(p)->toObjectID]->setNeedsUpdate(true);
                 }
             }
 
@@ -1134,9 +1476,14 @@ void ofxVisualProgramming::clearObjectsMap(){
                 }
             }
 
-            patchObjects.at(eraseIndexes.at(x))->removeObjectContent(true);
-            patchObjects.erase(eraseIndexes.at(x));
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            {
+                // the audio thread may still run the object ( until the next audio plan ), willErase skips it
+                std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
+                patchObjects.at(eraseIndexes.at(x))->removeObjectContent(true);
+                patchObjects.erase(eraseIndexes.at(x));
+            }
+            executionPlanDirty = true;
+            getWirelessBus().invalidate();
         }
 
         if(clearingObjectsMap){
@@ -1161,33 +1508,55 @@ bool ofxVisualProgramming::isObjectInLibrary(string name){
 }
 
 //--------------------------------------------------------------
-bool ofxVisualProgramming::isObjectIDInPatchMap(int id){
-    bool exists = false;
+bool ofxVisualProgramming::isHeadlessCompatible(shared_ptr<PatchObject> &obj, ofxXmlSettings &XML){
 
-    for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-        if(it->second != nullptr){
-            if(it->first == id){
-                exists = true;
-                break;
+    // the audio device system object is the offline audio backend output
+    if(obj->getIsSystemObject()){
+        return true;
+    }
+
+    // GL, shared context and hardware objects need a window or a device
+    if(obj->getIsTextureObject() || obj->getIsSharedContextObject() || obj->getIsHardwareObject()){
+        return false;
+    }
+
+    // same for objects with GL pins ( from the patch file, the object is not configured yet )
+    const string pinsTags[2] = {"inlets","outlets"};
+    for(int p=0;p<2;p++){
+        if(XML.pushTag(pinsTags[p])){
+            int totalPins = XML.getNumTags("link");
+            bool glPin = false;
+            for(int i=0;i<totalPins && !glPin;i++){
+                if(XML.pushTag("link",i)){
+                    int pinType = XML.getValue("type",0);
+                    glPin = pinType == VP_LINK_TEXTURE || pinType == VP_LINK_PIXELS || pinType == VP_LINK_FBO;
+                    XML.popTag();
+                }
+            }
+            XML.popTag();
+            if(glPin){
+                return false;
             }
         }
     }
 
-    return exists;
+    return true;
+}
+
+//--------------------------------------------------------------
+bool ofxVisualProgramming::isObjectIDInPatchMap(int id){
+    map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.find(id);
+    return it != patchObjects.end() && it->second != nullptr;
 }
 
 //--------------------------------------------------------------
 string ofxVisualProgramming::getObjectNameFromID(int id){
-    string name = "";
-    for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-        if(it->second != nullptr){
-            if(it->first == id){
-                name = it->second->getName();
-            }
-        }
+    map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.find(id);
+    if(it != patchObjects.end() && it->second != nullptr){
+        return it->second->getName();
     }
 
-    return name;
+    return "";
 }
 
 //--------------------------------------------------------------
@@ -1215,6 +1584,10 @@ void ofxVisualProgramming::removeObject(int &id){
 
         if(targetID == lastAddedObjectID) lastAddedObjectID=0;
 
+        // pending vars of the removed object are not needed anymore
+        getPatchPersistence().discardObject(currentPatchFile,targetID);
+        std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
         ofxXmlSettings XML;
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
         if (XML.loadFile(currentPatchFile)){
@@ -1270,11 +1643,7 @@ void ofxVisualProgramming::removeObject(int &id){
             // remove object
             if(found){
                 XML.removeTag("object", targetID);
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-                XML.saveFile();
-#else
-                XML.save();
-#endif
+                ofxVPPatchPersistence::saveXml(XML,currentPatchFile);
             }
         }
 
@@ -1287,11 +1656,13 @@ void ofxVisualProgramming::removeObject(int &id){
                     }else{
                         it->second->outPut[j]->isDisabled = true;
                         patchObjects[it->second->outPut[j]->toObjectID]->inletsConnected[it->second->outPut[j]->toInletID] = false;
+                        patchObjects[it->second->outPut[j]->toObjectID]->setNeedsUpdate(true);
                     }
                 }
                 it->second->outPut = tempBuffer;
             }
         }
+        executionPlanDirty = true;
 
         // check reference from subpatches map ( if the object was a wireless one ,sender or receiver )
         for(map<string,vector<SubpatchConnection>>::iterator it = subpatchesMap.begin(); it != subpatchesMap.end(); it++ ){
@@ -1337,6 +1708,8 @@ void ofxVisualProgramming::disconnectObject(int id){
 
         bool found = false;
 
+        std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
         ofxXmlSettings XML;
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
         if (XML.loadFile(currentPatchFile)){
@@ -1395,11 +1768,7 @@ void ofxVisualProgramming::disconnectObject(int id){
             }
             // save patch
             if(found){
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-                XML.saveFile();
-#else
-                XML.save();
-#endif
+                ofxVPPatchPersistence::saveXml(XML,currentPatchFile);
             }
         }
 
@@ -1412,11 +1781,13 @@ void ofxVisualProgramming::disconnectObject(int id){
                     }else{
                         it->second->outPut[j]->isDisabled = true;
                         patchObjects[it->second->outPut[j]->toObjectID]->inletsConnected[it->second->outPut[j]->toInletID] = false;
+                        patchObjects[it->second->outPut[j]->toObjectID]->setNeedsUpdate(true);
                     }
                 }
                 it->second->outPut = tempBuffer;
             }
         }
+        executionPlanDirty = true;
 
         // check reference from subpatches map ( if the object was a wireless one ,sender or receiver )
         for(map<string,vector<SubpatchConnection>>::iterator it = subpatchesMap.begin(); it != subpatchesMap.end(); it++ ){
@@ -1441,7 +1812,7 @@ bool ofxVisualProgramming::connect(int fromID, int fromOutlet, int toID,int toIn
 
         //std::cout << "Mosaic :: "<< "Connect object " << patchObjects[fromID]->getName().c_str() << ":" << ofToString(fromID) << " to object " << patchObjects[toID]->getName().c_str() << ":" << ofToString(toID) << std::endl;
 
-        shared_ptr<PatchLink> tempLink = shared_ptr<PatchLink>(new PatchLink());
+        shared_ptr<PatchLink> tempLink = makePatchLink();
 
         string tmpID = ofToString(fromID)+ofToString(fromOutlet)+ofToString(toID)+ofToString(toInlet);
 
@@ -1452,12 +1823,15 @@ bool ofxVisualProgramming::connect(int fromID, int fromOutlet, int toID,int toIn
         tempLink->fromOutletID  = fromOutlet;
         tempLink->toObjectID    = toID;
         tempLink->toInletID     = toInlet;
+        tempLink->generation    = 0;
         tempLink->isDisabled    = false;
         tempLink->isDeactivated = false;
 
         patchObjects[fromID]->outPut.push_back(tempLink);
+        executionPlanDirty = true;
 
         patchObjects[toID]->inletsConnected[toInlet] = true;
+        patchObjects[toID]->setNeedsUpdate(true);
 
         if(tempLink->type == VP_LINK_NUMERIC){
             patchObjects[toID]->_inletParams[toInlet] = new float();
@@ -1472,6 +1846,7 @@ bool ofxVisualProgramming::connect(int fromID, int fromOutlet, int toID,int toIn
         }else if(tempLink->type == VP_LINK_FBO){
             patchObjects[toID]->_inletParams[toInlet] = new ofxPingPong();
         }else if(tempLink->type == VP_LINK_AUDIO){
+            std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
             patchObjects[toID]->_inletParams[toInlet] = new ofSoundBuffer();
             if(patchObjects[fromID]->getIsPDSPPatchableObject() && patchObjects[toID]->getIsPDSPPatchableObject()){
                 patchObjects[fromID]->pdspOut[fromOutlet] >> patchObjects[toID]->pdspIn[toInlet];
@@ -1508,6 +1883,8 @@ void ofxVisualProgramming::checkSpecialConnection(int fromID, int toID, int link
 
 //--------------------------------------------------------------
 void ofxVisualProgramming::resetSystemObjects(){
+    // audio devices channels layout, read by the audio thread
+    std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
     for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
         if(it->second != nullptr){
             if(it->second->getIsSystemObject()){
@@ -1525,6 +1902,8 @@ void ofxVisualProgramming::resetSystemObjects(){
 
 //--------------------------------------------------------------
 void ofxVisualProgramming::resetSpecificSystemObjects(string name){
+    // audio devices channels layout, read by the audio thread
+    std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
     for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
         if(it->second != nullptr){
             if(it->second->getIsSystemObject() && it->second->getName() == name){
@@ -1573,6 +1952,8 @@ void ofxVisualProgramming::newPatch(string release){
     ofFile fileToRead(ofToDataPath("empty_patch.xml",true));
 
     // set patch release
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
     ofxXmlSettings XML;
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
     if (XML.loadFile(fileToRead.getAbsolutePath())){
@@ -1580,11 +1961,7 @@ void ofxVisualProgramming::newPatch(string release){
     if (XML.load(fileToRead.getAbsolutePath())){
 #endif
         XML.setValue("release",release);
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-        XML.saveFile();
-#else
-        XML.save();
-#endif
+        ofxVPPatchPersistence::saveXml(XML,fileToRead.getAbsolutePath());
     }
 
     ofFile newPatchFile(ofToDataPath("temp/"+newFileName,true));
@@ -1599,6 +1976,8 @@ void ofxVisualProgramming::newPatch(string release){
 
 //--------------------------------------------------------------
 void ofxVisualProgramming::newTempPatchFromFile(string patchFile){
+    getPatchPersistence().flush();
+
     string newFileName = "patch_"+ofGetTimestampString("%y%m%d")+alphabet.at(newFileCounter)+".xml";
     ofFile fileToRead(patchFile);
     ofFile newPatchFile(ofToDataPath("temp/"+newFileName,true));
@@ -1645,6 +2024,9 @@ void ofxVisualProgramming::newTempPatchFromFile(string patchFile){
 
 //--------------------------------------------------------------
 void ofxVisualProgramming::preloadPatch(string patchFile){
+    // write pending custom vars to the previous patch
+    getPatchPersistence().flush();
+
     currentPatchFile = patchFile;
     tempPatchFile = currentPatchFile;
 
@@ -1656,6 +2038,7 @@ void ofxVisualProgramming::preloadPatch(string patchFile){
             if(it->second->getName() != "audio device"){
                 it->second->setWillErase(true);
             }else{
+                std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
                 for(int in=0;in<it->second->getNumInlets();in++){
                     it->second->inletsConnected[in] = false;
                     it->second->pdspIn[in].disconnectIn();
@@ -1663,6 +2046,7 @@ void ofxVisualProgramming::preloadPatch(string patchFile){
 
                 it->second->outPut.clear();
                 it->second->setWillErase(true);
+                executionPlanDirty = true;
             }
         }
     }
@@ -1709,6 +2093,27 @@ void ofxVisualProgramming::loadPatch(string patchFile){
 
     loadPatchTime           = ofGetElapsedTimeMillis();
 
+    getPatchPersistence().flush();
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
+    setPatchLoadingProgress(0.0f);
+
+    // stage 1: enumerate audio devices on a worker thread ( not in headless mode ), while the main thread parses the patch
+    std::future<vector<ofSoundDevice>> audioDevicesList;
+    if(!headless){
+        soundStreamIN.close();
+        audioDevicesList = std::async(std::launch::async,[]{
+            ofSoundStream tempStream;
+#if defined(TARGET_WIN32)
+            return tempStream.getDeviceList(ofSoundDevice::Api::MS_DS);
+#elif defined(TARGET_OSX)
+            return tempStream.getDeviceList(ofSoundDevice::Api::OSX_CORE);
+#else
+            return tempStream.getDeviceList(ofSoundDevice::Api::PULSE);
+#endif
+        });
+    }
+
     ofxXmlSettings XML;
     string tstr;
 
@@ -1718,6 +2123,11 @@ void ofxVisualProgramming::loadPatch(string patchFile){
     if (XML.load(patchFile)){
 #endif
 
+        // stage 2: validate and prefetch objects assets on the task pool, while the main thread builds the objects
+        prefetchPatchAssets(XML);
+
+        setPatchLoadingProgress(0.1f);
+
         // Load main settings
         if (XML.pushTag("settings")){
             // Setup projector dimension
@@ -1736,6 +2146,9 @@ void ofxVisualProgramming::loadPatch(string patchFile){
             audioSampleRate = XML.getValue("sample_rate_out",0);
             audioBufferSize = XML.getValue("buffer_size",0);
             bpm = XML.getValue("bpm",0);
+            lazyEvaluation = XML.getValue("lazy_evaluation",0);
+            parallelUpdate = XML.getValue("parallel_update",0);
+            getControlClock().setRate(XML.getValue("control_rate",OFXVP_CONTROL_RATE));
             // pre 0.4.0 patches auto fix
             if(bpm == 0){
                 bpm = 120;
@@ -1746,202 +2159,212 @@ void ofxVisualProgramming::loadPatch(string patchFile){
             engine = nullptr;
             engine = new pdsp::Engine();
 
-            soundStreamIN.close();
-#if defined(TARGET_WIN32)
-            audioDevices = soundStreamIN.getDeviceList(ofSoundDevice::Api::MS_DS);
-#elif defined(TARGET_OSX)
-            audioDevices = soundStreamIN.getDeviceList(ofSoundDevice::Api::OSX_CORE);
-#else
-            audioDevices = soundStreamIN.getDeviceList(ofSoundDevice::Api::PULSE);
-#endif
-
-            audioDevicesStringIN.clear();
-            audioDevicesID_IN.clear();
-            audioDevicesStringOUT.clear();
-            audioDevicesID_OUT.clear();
-            audioDevicesSR.clear();
-            tstr = "------------------- AUDIO DEVICES";
-            ofLog(OF_LOG_NOTICE,"%s",tstr.c_str());
-            for(size_t i=0;i<audioDevices.size();i++){
-                string tempSR = "";
-                for(size_t sr=0;sr<audioDevices[i].sampleRates.size();sr++){
-                    if(sr < audioDevices[i].sampleRates.size()-1){
-                        tempSR += ofToString(audioDevices[i].sampleRates.at(sr))+", ";
-                    }else{
-                        tempSR += ofToString(audioDevices[i].sampleRates.at(sr));
+            if(headless){
+                // offline backend, no audio devices ( see activateOfflineDSP )
+                if(offlineSampleRate > 0) audioSampleRate = offlineSampleRate;
+                if(offlineBufferSize > 0) audioBufferSize = offlineBufferSize;
+                if(audioSampleRate == 0) audioSampleRate = 44100;
+                if(audioBufferSize == 0) audioBufferSize = MOSAIC_DEFAULT_BUFFER_SIZE;
+                isInputDeviceAvailable  = false;
+                isOutputDeviceAvailable = false;
+                audioGUIINChannels      = 0;
+                audioGUIOUTChannels     = XML.getValue("output_channels",2);
+                if(audioGUIOUTChannels <= 0) audioGUIOUTChannels = 2;
+
+                // the audio device object reads its channels from the patch settings
+                XML.setValue("buffer_size",audioBufferSize);
+                XML.setValue("sample_rate_in",audioSampleRate);
+                XML.setValue("sample_rate_out",audioSampleRate);
+                XML.setValue("input_channels",audioGUIINChannels);
+                XML.setValue("output_channels",audioGUIOUTChannels);
+                ofxVPPatchPersistence::saveXml(XML,patchFile);
+            }else{
+                audioDevices = audioDevicesList.get();
+
+                audioDevicesStringIN.clear();
+                audioDevicesID_IN.clear();
+                audioDevicesStringOUT.clear();
+                audioDevicesID_OUT.clear();
+                audioDevicesSR.clear();
+                tstr = "------------------- AUDIO DEVICES";
+                ofLog(OF_LOG_NOTICE,"%s",tstr.c_str());
+                for(size_t i=0;i<audioDevices.size();i++){
+                    string tempSR = "";
+                    for(size_t sr=0;sr<audioDevices[i].sampleRates.size();sr++){
+                        if(sr < audioDevices[i].sampleRates.size()-1){
+                            tempSR += ofToString(audioDevices[i].sampleRates.at(sr))+", ";
+                        }else{
+                            tempSR += ofToString(audioDevices[i].sampleRates.at(sr));
+                        }
                     }
-                }
 
-                bool haveMinSR = false;
-                for(size_t sr=0;sr<audioDevices[i].sampleRates.size();sr++){
-                    if(audioDevices[i].sampleRates.at(sr) >= 44100){
-                        haveMinSR = true;
-                        break;
-                    }
-                }
-                if(audioDevices[i].inputChannels > 0 && haveMinSR){
-                    audioDevicesStringIN.push_back("  "+audioDevices[i].name);
-                    audioDevicesID_IN.push_back(i);
+                    bool haveMinSR = false;
                     for(size_t sr=0;sr<audioDevices[i].sampleRates.size();sr++){
                         if(audioDevices[i].sampleRates.at(sr) >= 44100){
-                            audioDevicesSR.push_back(ofToString(audioDevices[i].sampleRates.at(sr)));
+                            haveMinSR = true;
+                            break;
                         }
+                    }
+                    if(audioDevices[i].inputChannels > 0 && haveMinSR){
+                        audioDevicesStringIN.push_back("  "+audioDevices[i].name);
+                        audioDevicesID_IN.push_back(i);
+                        for(size_t sr=0;sr<audioDevices[i].sampleRates.size();sr++){
+                            if(audioDevices[i].sampleRates.at(sr) >= 44100){
+                                audioDevicesSR.push_back(ofToString(audioDevices[i].sampleRates.at(sr)));
+                            }
 
+                        }
+                        ofLog(OF_LOG_NOTICE,"INPUT Device[%zu]: %s (IN:%i - OUT:%i), Sample Rates: %s",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels,tempSR.c_str());
                     }
-                    ofLog(OF_LOG_NOTICE,"INPUT Device[%zu]: %s (IN:%i - OUT:%i), Sample Rates: %s",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels,tempSR.c_str());
-                }
-                if(audioDevices[i].outputChannels > 0 && haveMinSR){
-                    audioDevicesStringOUT.push_back("  "+audioDevices[i].name);
-                    audioDevicesID_OUT.push_back(i);
-                    for(size_t sr=0;sr<audioDevices[i].sampleRates.size();sr++){
-                        if(audioDevices[i].sampleRates.at(sr) >= 44100){
-                            audioDevicesSR.push_back(ofToString(audioDevices[i].sampleRates.at(sr)));
+                    if(audioDevices[i].outputChannels > 0 && haveMinSR){
+                        audioDevicesStringOUT.push_back("  "+audioDevices[i].name);
+                        audioDevicesID_OUT.push_back(i);
+                        for(size_t sr=0;sr<audioDevices[i].sampleRates.size();sr++){
+                            if(audioDevices[i].sampleRates.at(sr) >= 44100){
+                                audioDevicesSR.push_back(ofToString(audioDevices[i].sampleRates.at(sr)));
+                            }
                         }
+                        ofLog(OF_LOG_NOTICE,"OUTPUT Device[%zu]: %s (IN:%i - OUT:%i), Sample Rates: %s",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels,tempSR.c_str());
                     }
-                    ofLog(OF_LOG_NOTICE,"OUTPUT Device[%zu]: %s (IN:%i - OUT:%i), Sample Rates: %s",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels,tempSR.c_str());
-                }
 
-                // remove duplicates from sample rates vector
-                std::sort( audioDevicesSR.begin(), audioDevicesSR.end() );
-                audioDevicesSR.erase( std::unique( audioDevicesSR.begin(), audioDevicesSR.end() ), audioDevicesSR.end() );
-                std::sort( audioDevicesSR.begin(), audioDevicesSR.end(), [] (const std::string& lhs, const std::string& rhs) {
-                    return std::stoi(lhs) < std::stoi(rhs);
-                } );
+                    // remove duplicates from sample rates vector
+                    std::sort( audioDevicesSR.begin(), audioDevicesSR.end() );
+                    audioDevicesSR.erase( std::unique( audioDevicesSR.begin(), audioDevicesSR.end() ), audioDevicesSR.end() );
+                    std::sort( audioDevicesSR.begin(), audioDevicesSR.end(), [] (const std::string& lhs, const std::string& rhs) {
+                        return std::stoi(lhs) < std::stoi(rhs);
+                    } );
 
-                //ofLog(OF_LOG_NOTICE,"Device[%zu]: %s (IN:%i - OUT:%i), Sample Rates: %s",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels,tempSR.c_str());
-            }
+                    //ofLog(OF_LOG_NOTICE,"Device[%zu]: %s (IN:%i - OUT:%i), Sample Rates: %s",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels,tempSR.c_str());
+                }
 
-            // check audio devices index
-            audioGUIINIndex         = -1;
-            audioGUIOUTIndex        = -1;
+                // check audio devices index
+                audioGUIINIndex         = -1;
+                audioGUIOUTIndex        = -1;
 
-            audioGUIINChannels      = 0;
-            audioGUIOUTChannels     = 0;
+                audioGUIINChannels      = 0;
+                audioGUIOUTChannels     = 0;
 
-            // check input devices
-            if(!audioDevicesID_IN.empty()){
-                for(size_t i=0;i<audioDevicesID_IN.size();i++){
-                    if(audioDevicesID_IN.at(i) == audioINDev){
-                        audioGUIINIndex = i;
-                        break;
+                // check input devices
+                if(!audioDevicesID_IN.empty()){
+                    for(size_t i=0;i<audioDevicesID_IN.size();i++){
+                        if(audioDevicesID_IN.at(i) == audioINDev){
+                            audioGUIINIndex = i;
+                            break;
+                        }
                     }
                 }
-            }
-            if(audioGUIINIndex == -1){ // no configured input device available
-                // check if there is one available
-                if(!audioDevicesID_IN.empty()){
+                if(audioGUIINIndex == -1){ // no configured input device available
+                    // check if there is one available
+                    if(!audioDevicesID_IN.empty()){
+                        isInputDeviceAvailable = true;
+                        // select the first one available
+                        audioGUIINIndex = 0;
+                        audioINDev = audioDevicesID_IN.at(audioGUIINIndex);
+                    }else{
+                        isInputDeviceAvailable = false;
+                        audioGUIINIndex = 0;
+                    }
+                }else{
                     isInputDeviceAvailable = true;
-                    // select the first one available
-                    audioGUIINIndex = 0;
                     audioINDev = audioDevicesID_IN.at(audioGUIINIndex);
-                }else{
-                    isInputDeviceAvailable = false;
-                    audioGUIINIndex = 0;
                 }
-            }else{
-                isInputDeviceAvailable = true;
-                audioINDev = audioDevicesID_IN.at(audioGUIINIndex);
-            }
 
-            // check output devices
-            if(!audioDevicesID_OUT.empty()){
-                for(size_t i=0;i<audioDevicesID_OUT.size();i++){
-                    if(audioDevicesID_OUT.at(i) == audioOUTDev){
-                        audioGUIOUTIndex = i;
-                        break;
+                // check output devices
+                if(!audioDevicesID_OUT.empty()){
+                    for(size_t i=0;i<audioDevicesID_OUT.size();i++){
+                        if(audioDevicesID_OUT.at(i) == audioOUTDev){
+                            audioGUIOUTIndex = i;
+                            break;
+                        }
                     }
                 }
-            }
-            if(audioGUIOUTIndex == -1){ // no configured output device available
-                // check if there is one available
-                if(!audioDevicesID_OUT.empty()){
+                if(audioGUIOUTIndex == -1){ // no configured output device available
+                    // check if there is one available
+                    if(!audioDevicesID_OUT.empty()){
+                        isOutputDeviceAvailable = true;
+                        // select the first one available
+                        audioGUIOUTIndex = 0;
+                        audioOUTDev = audioDevicesID_OUT.at(audioGUIOUTIndex);
+                    }else{
+                        isOutputDeviceAvailable = false;
+                        audioGUIOUTIndex = 0;
+                    }
+                }else{
                     isOutputDeviceAvailable = true;
-                    // select the first one available
-                    audioGUIOUTIndex = 0;
                     audioOUTDev = audioDevicesID_OUT.at(audioGUIOUTIndex);
-                }else{
-                    isOutputDeviceAvailable = false;
-                    audioGUIOUTIndex = 0;
                 }
-            }else{
-                isOutputDeviceAvailable = true;
-                audioOUTDev = audioDevicesID_OUT.at(audioGUIOUTIndex);
-            }
 
-            // select default devices
-            if(isInputDeviceAvailable){
-                audioGUIINChannels      = static_cast<int>(audioDevices[audioINDev].inputChannels);
-                //audioSampleRate         = audioDevices[audioINDev].sampleRates[0];
-            }else{
-                audioGUIINChannels      = 0;
-            }
+                // select default devices
+                if(isInputDeviceAvailable){
+                    audioGUIINChannels      = static_cast<int>(audioDevices[audioINDev].inputChannels);
+                    //audioSampleRate         = audioDevices[audioINDev].sampleRates[0];
+                }else{
+                    audioGUIINChannels      = 0;
+                }
 
-            if(isOutputDeviceAvailable){
-                audioGUIOUTChannels     = static_cast<int>(audioDevices[audioOUTDev].outputChannels);
-                //audioSampleRate         = audioDevices[audioOUTDev].sampleRates[0];
-            }else{
-                audioGUIOUTChannels     = 0;
-            }
+                if(isOutputDeviceAvailable){
+                    audioGUIOUTChannels     = static_cast<int>(audioDevices[audioOUTDev].outputChannels);
+                    //audioSampleRate         = audioDevices[audioOUTDev].sampleRates[0];
+                }else{
+                    audioGUIOUTChannels     = 0;
+                }
 
-            XML.setValue("buffer_size",audioBufferSize);
-            XML.setValue("sample_rate_in",audioSampleRate);
-            XML.setValue("sample_rate_out",audioSampleRate);
-            XML.setValue("input_channels",audioGUIINChannels);
-            XML.setValue("output_channels",audioGUIOUTChannels);
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+                XML.setValue("buffer_size",audioBufferSize);
+                XML.setValue("sample_rate_in",audioSampleRate);
+                XML.setValue("sample_rate_out",audioSampleRate);
+                XML.setValue("input_channels",audioGUIINChannels);
+                XML.setValue("output_channels",audioGUIOUTChannels);
+                ofxVPPatchPersistence::saveXml(XML,patchFile);
 
-            for(size_t bs=0;bs<audioDevicesBS.size();bs++){
-                if(ofToInt(audioDevicesBS.at(bs)) == audioBufferSize){
-                    audioGUIBSIndex = bs;
-                    break;
+                for(size_t bs=0;bs<audioDevicesBS.size();bs++){
+                    if(ofToInt(audioDevicesBS.at(bs)) == audioBufferSize){
+                        audioGUIBSIndex = bs;
+                        break;
+                    }
                 }
-            }
 
-            // at least we need one audio device available (input or output) to start the engine
-            if(dspON && (isInputDeviceAvailable || isOutputDeviceAvailable)){
-                engine->setChannels(audioGUIINChannels, audioGUIOUTChannels);
-                this->setChannels(audioGUIINChannels,0);
+                // at least we need one audio device available (input or output) to start the engine
+                if(dspON && (isInputDeviceAvailable || isOutputDeviceAvailable)){
+                    engine->setChannels(audioGUIINChannels, audioGUIOUTChannels);
+                    this->setChannels(audioGUIINChannels,0);
 
-                for(int in=0;in<audioGUIINChannels;in++){
-                    engine->audio_in(in) >> this->in(in);
-                }
-                this->out_silent() >> engine->blackhole();
+                    for(int in=0;in<audioGUIINChannels;in++){
+                        engine->audio_in(in) >> this->in(in);
+                    }
+                    this->out_silent() >> engine->blackhole();
 
-                if(isInputDeviceAvailable){
-                    engine->setInputDeviceID(audioDevices[audioINDev].deviceID);
-                }
+                    if(isInputDeviceAvailable){
+                        engine->setInputDeviceID(audioDevices[audioINDev].deviceID);
+                    }
 
-                if(isOutputDeviceAvailable){
-                    engine->setOutputDeviceID(audioDevices[audioOUTDev].deviceID);
-                }
+                    if(isOutputDeviceAvailable){
+                        engine->setOutputDeviceID(audioDevices[audioOUTDev].deviceID);
+                    }
 
-                engine->setup(audioSampleRate, audioBufferSize, audioNumBuffers);
-                engine->sequencer.setTempo(bpm);
+                    engine->setup(audioSampleRate, audioBufferSize, audioNumBuffers);
+                    engine->sequencer.setTempo(bpm);
 
-                if(isInputDeviceAvailable){
-                    tstr = "------------------- Soundstream INPUT Started on";
-                    ofLog(OF_LOG_NOTICE,"%s",tstr.c_str());
-                    ofLog(OF_LOG_NOTICE,"Audio device: %s",audioDevices[audioINDev].name.c_str());
-                }else{
-                    tstr = "------------------------------ Soundstream INPUT OFF, no input audio device available";
-                    ofLog(OF_LOG_ERROR,"%s",tstr.c_str());
-                }
+                    if(isInputDeviceAvailable){
+                        tstr = "------------------- Soundstream INPUT Started on";
+                        ofLog(OF_LOG_NOTICE,"%s",tstr.c_str());
+                        ofLog(OF_LOG_NOTICE,"Audio device: %s",audioDevices[audioINDev].name.c_str());
+                    }else{
+                        tstr = "------------------------------ Soundstream INPUT OFF, no input audio device available";
+                        ofLog(OF_LOG_ERROR,"%s",tstr.c_str());
+                    }
 
-                if(isOutputDeviceAvailable){
-                    tstr = "------------------- Soundstream OUTPUT Started on";
-                    ofLog(OF_LOG_NOTICE,"%s",tstr.c_str());
-                    ofLog(OF_LOG_NOTICE,"Audio device: %s",audioDevices[audioOUTDev].name.c_str());
+                    if(isOutputDeviceAvailable){
+                        tstr = "------------------- Soundstream OUTPUT Started on";
+                        ofLog(OF_LOG_NOTICE,"%s",tstr.c_str());
+                        ofLog(OF_LOG_NOTICE,"Audio device: %s",audioDevices[audioOUTDev].name.c_str());
 
-                }else{
-                    tstr = "------------------------------ Soundstream OUTPUT OFF, no output audio device available";
-                    ofLog(OF_LOG_ERROR,"%s",tstr.c_str());
-                }
+                    }else{
+                        tstr = "------------------------------ Soundstream OUTPUT OFF, no output audio device available";
+                        ofLog(OF_LOG_ERROR,"%s",tstr.c_str());
+                    }
 
-                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                }
             }
 
             XML.popTag();
@@ -1952,7 +2375,7 @@ void ofxVisualProgramming::loadPatch(string patchFile){
         int totalObjects = XML.getNumTags("object");
 
         if(totalObjects > 0){
-            // load all the patch objects ( all the non GL sharing context )
+            // stage 3: load all the patch objects ( all the non GL sharing context ), GL and pdsp wiring stay on the main thread
             for(int i=0;i<totalObjects;i++){
                 if(XML.pushTag("object", i)){
                     string objname = XML.getValue("name","");
@@ -1960,8 +2383,10 @@ void ofxVisualProgramming::loadPatch(string patchFile){
 
                     if(isObjectInLibrary(objname)){
                         shared_ptr<PatchObject> tempObj = selectObject(objname);
-                        if(tempObj != nullptr && !tempObj->getIsSharedContextObject()){
-                            loaded = tempObj->loadConfig(mainWindow,*engine,i,patchFile);
+                        if(tempObj != nullptr && headless && !isHeadlessCompatible(tempObj,XML)){
+                            ofLog(OF_LOG_NOTICE,"Headless: skipping GL/hardware object %s",objname.c_str());
+                        }else if(tempObj != nullptr && !tempObj->getIsSharedContextObject()){
+                            loaded = tempObj->loadConfig(mainWindow,*engine,patchFile,XML);
                             if(loaded){
                                 tempObj->setPatchfile(currentPatchFile);
                                 tempObj->setIsRetina(isRetina,scaleFactor);
@@ -1976,10 +2401,14 @@ void ofxVisualProgramming::loadPatch(string patchFile){
                                 ofAddListener(tempObj->resetEvent ,this,&ofxVisualProgramming::resetObject);
                                 ofAddListener(tempObj->reconnectOutletsEvent ,this,&ofxVisualProgramming::reconnectObjectOutlets);
                                 ofAddListener(tempObj->duplicateEvent ,this,&ofxVisualProgramming::duplicateObject);
+                                ofAddListener(tempObj->linksChangedEvent ,this,&ofxVisualProgramming::invalidateExecutionPlan);
+                                ofAddListener(tempObj->filepathChangedEvent ,this,&ofxVisualProgramming::registerScriptObjectFile);
                                 // Insert the new object into the map
                                 patchObjects[tempObj->getId()] = tempObj;
+                                executionPlanDirty = true;
                                 actualObjectID = tempObj->getId();
                                 lastAddedObjectID = tempObj->getId();
+                                registerScriptObjectFile(lastAddedObjectID);
                                 nodeCanvas.addNodeToMap(tempObj->getId(),tempObj->getName());
                                 // if wireless object, add reference to subpatch data map
                                 if(objname == "sender"){
@@ -1997,54 +2426,47 @@ void ofxVisualProgramming::loadPatch(string patchFile){
 #ifdef OFXVP_DEBUG
                                 std::cout << "Loading "<< tempObj->getName() << std::endl;
 #endif
-
-                                std::this_thread::sleep_for(std::chrono::milliseconds(10));
                             }
                         }
                     }
                     XML.popTag();
                 }
+
+                setPatchLoadingProgress(0.1f + 0.7f*static_cast<float>(i+1)/static_cast<float>(totalObjects));
             }
 
             // Load Links ( of all the non GL sharing context )
             for(int i=0;i<totalObjects;i++){
                 if(XML.pushTag("object", i)){
-                    string objname = XML.getValue("name","");
-                    if(isObjectInLibrary(objname)){
-                        shared_ptr<PatchObject> tempObj = selectObject(objname);
-                        if(tempObj != nullptr && !tempObj->getIsSharedContextObject()){
-                            int fromID = XML.getValue("id", -1);
-                            if (XML.pushTag("outlets")){
-                                int totalOutlets = XML.getNumTags("link");
-                                for(int j=0;j<totalOutlets;j++){
-                                    if (XML.pushTag("link",j)){
-                                        int linkType = XML.getValue("type", 0);
-                                        if(linkType != VP_LINK_AUDIO){
-                                            int totalLinks = XML.getNumTags("to");
-                                            for(int z=0;z<totalLinks;z++){
-                                                if(XML.pushTag("to",z)){
-                                                    int toObjectID = XML.getValue("id", 0);
-                                                    int toInletID = XML.getValue("inlet", 0);
-
-                                                    // fix loading patches with non-existent objects (older OFXVP versions)
-                                                    if(isObjectIDInPatchMap(toObjectID)){
-                                                        if(connect(fromID,j,toObjectID,toInletID,linkType)){
-                                                            //ofLog(OF_LOG_NOTICE,"Connected object %s, outlet %i TO object %s, inlet %i",patchObjects[fromID]->getName().c_str(),z,patchObjects[toObjectID]->getName().c_str(),toInletID);
-                                                            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                                                        }
-                                                    }
-
-                                                    XML.popTag();
+                    int fromID = XML.getValue("id", -1);
+                    // only the non GL sharing context objects are in the patch map at this point
+                    if(isObjectIDInPatchMap(fromID)){
+                        if (XML.pushTag("outlets")){
+                            int totalOutlets = XML.getNumTags("link");
+                            for(int j=0;j<totalOutlets;j++){
+                                if (XML.pushTag("link",j)){
+                                    int linkType = XML.getValue("type", 0);
+                                    if(linkType != VP_LINK_AUDIO){
+                                        int totalLinks = XML.getNumTags("to");
+                                        for(int z=0;z<totalLinks;z++){
+                                            if(XML.pushTag("to",z)){
+                                                int toObjectID = XML.getValue("id", 0);
+                                                int toInletID = XML.getValue("inlet", 0);
+
+                                                // fix loading patches with non-existent objects (older OFXVP versions)
+                                                if(isObjectIDInPatchMap(toObjectID)){
+                                                    connect(fromID,j,toObjectID,toInletID,linkType);
                                                 }
+
+                                                XML.popTag();
                                             }
                                         }
-                                        XML.popTag();
                                     }
+                                    XML.popTag();
                                 }
-
-                                XML.popTag();
                             }
 
+                            XML.popTag();
                         }
                     }
                     XML.popTag();
@@ -2053,48 +2475,47 @@ void ofxVisualProgramming::loadPatch(string patchFile){
 
         }
 
+        setPatchLoadingProgress(0.9f);
+
         bPopulatingObjectsMap   = false;
 
-        activateDSP();
+        if(headless){
+            activateOfflineDSP();
+        }else{
+            activateDSP();
+        }
 
         if(totalObjects > 0){
             // activate all audio PDSP connection
             for(int i=0;i<totalObjects;i++){
                 if(XML.pushTag("object", i)){
-                    string objname = XML.getValue("name","");
-                    if(isObjectInLibrary(objname)){
-                        shared_ptr<PatchObject> tempObj = selectObject(objname);
-                        if(tempObj != nullptr && !tempObj->getIsSharedContextObject()){
-                            int fromID = XML.getValue("id", -1);
-                            if (XML.pushTag("outlets")){
-                                int totalOutlets = XML.getNumTags("link");
-                                for(int j=0;j<totalOutlets;j++){
-                                    if (XML.pushTag("link",j)){
-                                        int linkType = XML.getValue("type", 0);
-                                        if(linkType == VP_LINK_AUDIO){
-                                            int totalLinks = XML.getNumTags("to");
-                                            for(int z=0;z<totalLinks;z++){
-                                                if(XML.pushTag("to",z)){
-                                                    int toObjectID = XML.getValue("id", 0);
-                                                    int toInletID = XML.getValue("inlet", 0);
-
-                                                    if(isObjectIDInPatchMap(toObjectID)){
-                                                        if(connect(fromID,j,toObjectID,toInletID,linkType)){
-                                                            //ofLog(OF_LOG_NOTICE,"Connected object %s, outlet %i TO object %s, inlet %i",patchObjects[fromID]->getName().c_str(),z,patchObjects[toObjectID]->getName().c_str(),toInletID);
-                                                            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                                                        }
-                                                    }
-
-                                                    XML.popTag();
+                    int fromID = XML.getValue("id", -1);
+                    if(isObjectIDInPatchMap(fromID)){
+                        if (XML.pushTag("outlets")){
+                            int totalOutlets = XML.getNumTags("link");
+                            for(int j=0;j<totalOutlets;j++){
+                                if (XML.pushTag("link",j)){
+                                    int linkType = XML.getValue("type", 0);
+                                    if(linkType == VP_LINK_AUDIO){
+                                        int totalLinks = XML.getNumTags("to");
+                                        for(int z=0;z<totalLinks;z++){
+                                            if(XML.pushTag("to",z)){
+                                                int toObjectID = XML.getValue("id", 0);
+                                                int toInletID = XML.getValue("inlet", 0);
+
+                                                if(isObjectIDInPatchMap(toObjectID)){
+                                                    connect(fromID,j,toObjectID,toInletID,linkType);
                                                 }
+
+                                                XML.popTag();
                                             }
                                         }
-                                        XML.popTag();
                                     }
+                                    XML.popTag();
                                 }
-
-                                XML.popTag();
                             }
+
+                            XML.popTag();
                         }
                     }
                     XML.popTag();
@@ -2102,15 +2523,51 @@ void ofxVisualProgramming::loadPatch(string patchFile){
             }
         }
 
+        setPatchLoadingProgress(0.95f);
+
     }
 
     bLoadingNewPatch = false;
 
+    // GL sharing context objects, never loaded in headless mode
     deferredLoadTime = ofGetElapsedTimeMillis();
-    deferredLoad = true;
+    deferredLoad = !headless;
 
 }
 
+//--------------------------------------------------------------
+void ofxVisualProgramming::prefetchPatchAssets(ofxXmlSettings &XML){
+    getAssetCache().clear();
+
+    // objects files are relocated to the patch data folder ( see PatchObject::setPatchfile )
+    ofFile temp(currentPatchFile);
+    string patchDataFolder = temp.getEnclosingDirectory()+"data/";
+
+    set<int> objectsIDs;
+    int totalObjects = XML.getNumTags("object");
+    for(int i=0;i<totalObjects;i++){
+        if(XML.pushTag("object", i)){
+            int objID = XML.getValue("id", -1);
+            if(!objectsIDs.insert(objID).second){
+                ofLog(OF_LOG_WARNING,"Patch %s has more than one object with id %i",currentPatchFile.c_str(),objID);
+            }
+
+            string fp = XML.getValue("filepath","none");
+            if(fp != "none" && fp != "" && fp.back() != '/' && ofxVPAssetCache::isPrefetchable(fp)){
+                ofFile objFile(fp);
+                getAssetCache().prefetch(forceCheckMosaicDataPath(patchDataFolder+objFile.getFileName()));
+            }
+            XML.popTag();
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::setPatchLoadingProgress(float progress){
+    patchLoadingProgress = progress;
+    ofNotifyEvent(patchLoadingProgressEvent,patchLoadingProgress);
+}
+
 //--------------------------------------------------------------
 void ofxVisualProgramming::loadPatchSharedContextObjects(){
 
@@ -2136,10 +2593,11 @@ void ofxVisualProgramming::loadPatchSharedContextObjects(){
                     string objname = XML.getValue("name","");
                     bool loaded = false;
 
-                    if(isObjectInLibrary(objname)){
+                    // skip the objects already loaded with the patch
+                    if(!isObjectIDInPatchMap(XML.getValue("id", -1)) && isObjectInLibrary(objname)){
                         shared_ptr<PatchObject> tempObj = selectObject(objname);
                         if(tempObj != nullptr && tempObj->getIsSharedContextObject()){
-                            loaded = tempObj->loadConfig(mainWindow,*engine,i,currentPatchFile);
+                            loaded = tempObj->loadConfig(mainWindow,*engine,currentPatchFile,XML);
                             if(loaded){
                                 tempObj->setPatchfile(currentPatchFile);
                                 tempObj->setIsRetina(isRetina,scaleFactor);
@@ -2154,16 +2612,18 @@ void ofxVisualProgramming::loadPatchSharedContextObjects(){
                                 ofAddListener(tempObj->resetEvent ,this,&ofxVisualProgramming::resetObject);
                                 ofAddListener(tempObj->reconnectOutletsEvent ,this,&ofxVisualProgramming::reconnectObjectOutlets);
                                 ofAddListener(tempObj->duplicateEvent ,this,&ofxVisualProgramming::duplicateObject);
+                                ofAddListener(tempObj->linksChangedEvent ,this,&ofxVisualProgramming::invalidateExecutionPlan);
+                                ofAddListener(tempObj->filepathChangedEvent ,this,&ofxVisualProgramming::registerScriptObjectFile);
                                 // Insert the new patch into the map
                                 patchObjects[tempObj->getId()] = tempObj;
+                                executionPlanDirty = true;
                                 actualObjectID = tempObj->getId();
                                 lastAddedObjectID = tempObj->getId();
+                                registerScriptObjectFile(lastAddedObjectID);
                                 nodeCanvas.addNodeToMap(tempObj->getId(),tempObj->getName());
 #ifdef OFXVP_DEBUG
                                 std::cout << "Loading "<< tempObj->getName() << std::endl;
 #endif
-
-                                std::this_thread::sleep_for(std::chrono::milliseconds(10));
                             }
                         }
                     }
@@ -2187,19 +2647,9 @@ void ofxVisualProgramming::loadPatchSharedContextObjects(){
                                         if(XML.pushTag("to",z)){
                                             int toObjectID = XML.getValue("id", 0);
                                             int toInletID = XML.getValue("inlet", 0);
-                                            string toObjName = getObjectNameFromID(toObjectID);
-
-                                            if(toObjName != ""){
-                                                shared_ptr<PatchObject> _tempToObj = selectObject(toObjName);
-                                                if(_tempToObj != nullptr && _tempToObj->getIsSharedContextObject()){
-                                                    // fix loading patches with non-existent objects (older OFXVP versions)
-                                                    if(isObjectIDInPatchMap(toObjectID)){
-                                                        if(connect(fromID,j,toObjectID,toInletID,linkType)){
-                                                            //ofLog(OF_LOG_NOTICE,"Connected object %s, outlet %i TO object %s, inlet %i",patchObjects[fromID]->getName().c_str(),z,patchObjects[toObjectID]->getName().c_str(),toInletID);
-                                                            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                                                        }
-                                                    }
-                                                }
+                                            // fix loading patches with non-existent objects (older OFXVP versions)
+                                            if(isObjectIDInPatchMap(toObjectID) && patchObjects[toObjectID]->getIsSharedContextObject()){
+                                                connect(fromID,j,toObjectID,toInletID,linkType);
                                             }
 
                                             XML.popTag();
@@ -2221,20 +2671,33 @@ void ofxVisualProgramming::loadPatchSharedContextObjects(){
         //nodeCanvas.debugNodeMap();
 
     }
+
+    setPatchLoadingProgress(1.0f);
 }
 
 //--------------------------------------------------------------
 void ofxVisualProgramming::reloadPatch(){
     bLoadingNewPatch = true;
 
-    // clear previous patch
-    for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
-        if(it->second != nullptr){
-            it->second->removeObjectContent();
+    {
+        // wait for the audio block in progress, the audio thread skips the objects until the patch is loaded
+        std::lock_guard<std::recursive_mutex> lck(getAudioGraphMutex());
+
+        // clear previous patch
+        for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
+            if(it->second != nullptr){
+                it->second->removeObjectContent();
+            }
         }
-    }
 
-    patchObjects.clear();
+        patchObjects.clear();
+        executionPlan.clear();
+        executionPlanDirty = true;
+        getWirelessBus().clear();
+        audioExecutionPlan.getWriteBuffer().clear();
+        audioExecutionPlan.publish();
+        audioExecutionPlan.getWriteBuffer().clear();
+    }
 
     // clear subpatch navigation data
     subpatchesMap.clear();
@@ -2266,6 +2729,9 @@ void ofxVisualProgramming::savePatchAs(string patchFile){
     //ofLog(OF_LOG_NOTICE,"%s",patchFile.c_str());
     //ofLog(OF_LOG_NOTICE,"%s",sanitizedPatchFile.c_str());
 
+    // write pending custom vars before copying the patch file
+    getPatchPersistence().flush();
+
     // copy patch file & patch data folder
     ofFile tempFile(sanitizedPatchFile);
     string tempFileName = tempFile.getFileName();
@@ -2298,6 +2764,8 @@ void ofxVisualProgramming::savePatchAs(string patchFile){
 
 //--------------------------------------------------------------
 void ofxVisualProgramming::setPatchVariable(string var, int value){
+    std::lock_guard<std::recursive_mutex> lck(getPatchPersistence().getFileMutex());
+
     ofxXmlSettings XML;
 
 #if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
@@ -2307,16 +2775,40 @@ void ofxVisualProgramming::setPatchVariable(string var, int value){
 #endif
         if (XML.pushTag("settings")){
             XML.setValue(var,value);
-#if OF_VERSION_MAJOR == 0 && OF_VERSION_MINOR < 12
-            XML.saveFile();
-#else
-            XML.save();
-#endif
+            ofxVPPatchPersistence::saveXml(XML,currentPatchFile);
             XML.popTag();
         }
     }
 }
 
+//--------------------------------------------------------------
+void ofxVisualProgramming::setLazyEvaluation(bool lazy){
+    lazyEvaluation = lazy;
+
+    // recompute everything once when switching mode
+    for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
+        if(it->second != nullptr){
+            it->second->setNeedsUpdate(true);
+        }
+    }
+
+    setPatchVariable("lazy_evaluation",static_cast<int>(lazyEvaluation));
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::setParallelUpdate(bool parallel){
+    parallelUpdate = parallel;
+
+    setPatchVariable("parallel_update",static_cast<int>(parallelUpdate));
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::setControlRate(int hz){
+    getControlClock().setRate(hz);
+
+    setPatchVariable("control_rate",getControlClock().getRate());
+}
+
 //--------------------------------------------------------------
 void ofxVisualProgramming::setAudioInDevice(int ind){
 
@@ -2414,6 +2906,10 @@ void ofxVisualProgramming::activateDSP(){
             ofLog(OF_LOG_ERROR,"%s",tstr.c_str());
         }
 
+        // allocated before the stream starts, the audio thread only reads it
+        silenceBuffer.allocate(static_cast<size_t>(audioBufferSize),1);
+        silenceBuffer.setSampleRate(static_cast<unsigned int>(audioSampleRate));
+
         engine->setup(audioSampleRate, audioBufferSize, audioNumBuffers);
         engine->sequencer.setTempo(bpm);
 
@@ -2434,6 +2930,57 @@ void ofxVisualProgramming::activateDSP(){
 
 }
 
+//--------------------------------------------------------------
+void ofxVisualProgramming::activateOfflineDSP(){
+
+    // no soundstreams, the pdsp graph is pulled by processOfflineAudio
+    engine->setChannels(audioGUIINChannels, audioGUIOUTChannels);
+    this->setChannels(audioGUIINChannels,0);
+    this->out_silent() >> engine->blackhole();
+
+    silenceBuffer.allocate(static_cast<size_t>(audioBufferSize),1);
+    silenceBuffer.setSampleRate(static_cast<unsigned int>(audioSampleRate));
+
+    pdsp::prepareAllToPlay(audioBufferSize, static_cast<double>(audioSampleRate));
+    engine->sequencer.setTempo(bpm);
+
+    // audio device object outputs to the engine outputs
+    resetSystemObjects();
+
+    dspON = true;
+
+    // offline blocks time restarts from the control clock time at the first block
+    offlineSamples = 0;
+    offlineStartNs = 0;
+    offlineAnchored = false;
+
+    ofLog(OF_LOG_NOTICE,"------------------- Offline audio: %i Hz, %i samples buffer, %i OUTPUT channels",audioSampleRate,audioBufferSize,audioGUIOUTChannels);
+
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::setOfflineAudio(int sampleRate, int bufferSize){
+    // applied on the next headless patch load ( 0 keeps the patch settings )
+    offlineSampleRate = sampleRate;
+    offlineBufferSize = bufferSize;
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::processOfflineAudio(ofSoundBuffer &outputBuffer){
+    if(!dspON || bLoadingNewPatch) return;
+
+    // block time from the rendered samples count, anchored to the driven control clock ( events land on the same samples on every run )
+    if(!offlineAnchored){
+        offlineStartNs = getControlClock().now();
+        offlineAnchored = true;
+    }
+    offlineSamples += static_cast<uint64_t>(audioBufferSize);
+    getAudioClock().beginBlockAt(offlineStartNs + offlineSamples*1000000000ULL/static_cast<uint64_t>(audioSampleRate),audioBufferSize,audioSampleRate);
+
+    // one audio block, same path as the soundstream callback ( pdsp graph + audio objects plan )
+    engine->audioOut(outputBuffer);
+}
+
 //--------------------------------------------------------------
 void ofxVisualProgramming::deactivateDSP(){
     setPatchVariable("dsp",0);
@@ -36,6 +36,10 @@
 
 #include "ofxVPConfig.h"
 #include "ofxVPXmlEngine.h"
+#include "ofxVPAssetCache.h"
+#include "ofxVPAudioGraphLock.h"
+#include "ofxVPTripleBuffer.h"
+#include "ofxVPGraphScheduler.h"
 
 #include "ofxPDSP.h"
 #include "ofxImGui.h"
@@ -65,6 +69,7 @@ public:
     void            setRetina(bool retina, float retinaScale=1);
     void            setup(ofxImGui::Gui* guiRef = nullptr, string release="");
     void            setupFailsafeWindow();
+    void            setupHeadless(string release="");
     void            update();
     void            updateRetina(float scale);
     void            updateCanvasViewport();
@@ -74,6 +79,8 @@ public:
     void            drawInspector();
     void            drawLivePatchingSession();
     void            drawSubpatchNavigation();
+    void            drawProfilerObjectsTimings();
+    bool            exportProfilerTimings(string path, bool json);
     void            resetTempFolder();
     void            cleanPatchDataFolder();
     void            reloadFont();
@@ -101,6 +108,10 @@ public:
     void            duplicateObject(int &id);
     void            disconnectObject(int id);
 
+    void            compileExecutionPlan();
+    void            invalidateExecutionPlan(int &id);
+    void            registerScriptObjectFile(int &id);
+
     bool            connect(int fromID, int fromOutlet, int toID,int toInlet, int linkType);
     void            checkSpecialConnection(int fromID, int toID, int linkType);
     void            resetSystemObjects();
@@ -109,6 +120,7 @@ public:
     void            clearObjectsMap();
     bool            isObjectInLibrary(string name);
     bool            isObjectIDInPatchMap(int id);
+    bool            isHeadlessCompatible(shared_ptr<PatchObject> &obj, ofxXmlSettings &XML);
     string          getObjectNameFromID(int id);
     int             getSubpatchIndex(string name);
 
@@ -118,9 +130,14 @@ public:
     void            openPatch(string patchFile);
     void            loadPatch(string patchFile);
     void            loadPatchSharedContextObjects();
+    void            prefetchPatchAssets(ofxXmlSettings &XML);
+    void            setPatchLoadingProgress(float progress);
     void            reloadPatch();
     void            savePatchAs(string patchFile);
     void            setPatchVariable(string var, int value);
+    void            setLazyEvaluation(bool lazy);
+    void            setParallelUpdate(bool parallel);
+    void            setControlRate(int hz);
 
     void            setAudioInDevice(int ind);
     void            setAudioOutDevice(int ind);
@@ -129,6 +146,10 @@ public:
     void            setAudioBufferSize(int bs);
     void            activateDSP();
     void            deactivateDSP();
+    void            activateOfflineDSP();
+    void            setOfflineAudio(int sampleRate, int bufferSize);
+    void            processOfflineAudio(ofSoundBuffer &outputBuffer);
+    uint64_t        getAudioBlocksSkipped() const { return audioBlocksSkipped; }
 
     void            resetCanvas();
 
@@ -140,7 +161,9 @@ public:
     ofxImGui::Gui*                      ofxVPGui;
     ImGuiEx::NodeCanvas                 nodeCanvas;
     ImGuiEx::ProfilersWindow            profiler;
-    ImGuiEx::ProfilerTask               *pt;
+    vector<ImGuiEx::ProfilerTask>       updateProfilerTasks;    // by execution plan index
+    vector<ImGuiEx::ProfilerTask>       drawProfilerTasks;
+    vector<uint64_t>                    profilerScratch;
     bool                                isCanvasVisible;
     bool                                isCanvasActive;
 
@@ -157,7 +180,12 @@ public:
     // PATCH OBJECTS
     map<int,shared_ptr<PatchObject>>    patchObjects;
     map<string,string>                  scriptsObjectsFilesPaths;
-    vector<pair<int,int>>               leftToRightIndexOrder;
+    vector<PatchObject*>                executionPlan;
+    ofxVPTripleBuffer<vector<shared_ptr<PatchObject>>> audioExecutionPlan;
+    bool                                executionPlanDirty;
+    vector<vector<size_t>>              executionPlanSuccessors;    // by execution plan index
+    vector<int>                         executionPlanInDegree;
+    vector<bool>                        executionPlanMainThread;
     vector<int>                         eraseIndexes;
     ofPoint                             nextObjectPosition;
 
@@ -181,6 +209,8 @@ public:
     int                                 output_height;
     string                              alphabet;
     int                                 newFileCounter;
+    float                               patchLoadingProgress;
+    ofEvent<float>                      patchLoadingProgressEvent;      // 0..1, notified from inside loadPatch ( same thread, before the next frame ), 1 after the shared context objects
 
     // SYSTEM
     shared_ptr<ofAppGLFWWindow>         mainWindow;
@@ -190,7 +220,10 @@ public:
     bool                                isOverProfiler;
     bool                                isOverInspector;
     bool                                isOverSubpatchNavigator;
+    bool                                lazyEvaluation;
+    bool                                parallelUpdate;
     bool                                inited;
+    bool                                headless;
 
     // LIVE PATCHING
     int                                 livePatchingObiID;
@@ -199,6 +232,8 @@ public:
     pdsp::Engine                        *engine;
     ofSoundBuffer                       inputBuffer;
     ofSoundBuffer                       emptyBuffer;
+    ofSoundBuffer                       silenceBuffer;          // zeros, fed to the audio objects when a block can't take the audio graph lock
+    std::atomic<uint64_t>               audioBlocksSkipped;     // atomic, blocks played as silence ( main thread holding the audio graph lock )
 
     vector<ofSoundDevice>               audioDevices;
     vector<string>                      audioDevicesStringIN;
@@ -225,6 +260,11 @@ public:
     bool                                isInputDeviceAvailable;
     bool                                isOutputDeviceAvailable;
     bool                                dspON;
+    int                                 offlineSampleRate;
+    int                                 offlineBufferSize;
+    uint64_t                            offlineSamples;
+    uint64_t                            offlineStartNs;
+    bool                                offlineAnchored;
 
     // MEMORY
     uint64_t                            loadPatchTime;
@@ -236,7 +276,6 @@ public:
 private:
     void audioProcess(float *input, int bufferSize, int nChannels);
 
-    mutable ofMutex                 vp_mutex;
 
     shared_ptr<ofAppGLFWWindow>     failsafeWindow;
 
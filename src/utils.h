@@ -48,6 +48,7 @@
 #include <iostream>
 #include <fstream>
 
+#include "ofxVPConfig.h"
 #include "imgui_node_canvas.h"
 
 // MACROS
@@ -165,6 +166,33 @@ inline int nthOccurrence(const std::string& str, const std::string& findMe, int
     return pos;
 }
 
+//--------------------------------------------------------------
+// audio analysis data layout: [ signal window ][ spectrum window/2+1 ][ mel bands ][ rms, pitch, bpm, beat ][ spectral features ][ mfcc ][ chroma ][ pitch confidence ]
+// ( analysis data saved before the extended features ends after the beat )
+inline int analysisWindowFromDataSize(size_t dataSize){
+    size_t legacySize = MEL_SCALE_CRITICAL_BANDS - 1 + 4 + 1;
+    int match = 0;
+    for(size_t fixedSize : { legacySize + AUDIO_EXTENDED_FEATURES, legacySize }){
+        if(dataSize <= fixedSize) continue;
+        size_t window = (dataSize - fixedSize) * 2 / 3;
+        if(window + (window/2) + fixedSize == dataSize){
+            // some sizes match both layouts, analysis windows are powers of two
+            if((window & (window - 1)) == 0) return static_cast<int>(window);
+            if(match == 0) match = static_cast<int>(window);
+        }
+    }
+    // 0 if the size does not match the layout
+    return match;
+}
+
+// position of the spectral features in the audio analysis data ( -1 if the data has no features )
+inline int analysisFeaturesFromDataSize(size_t dataSize){
+    int window = analysisWindowFromDataSize(dataSize);
+    if(window == 0) return -1;
+    size_t position = window + (window/2) + 1 + MEL_SCALE_CRITICAL_BANDS - 1 + 4;
+    return position + AUDIO_EXTENDED_FEATURES == dataSize ? static_cast<int>(position) : -1;
+}
+
 //--------------------------------------------------------------
 static inline float hardClip(float x){
     float x1 = fabsf(x + 1.0f);